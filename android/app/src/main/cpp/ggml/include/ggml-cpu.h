@@ -34,6 +34,26 @@ extern "C" {
     GGML_BACKEND_API void    ggml_numa_init(enum ggml_numa_strategy numa); // call once for better performance on NUMA systems
     GGML_BACKEND_API bool    ggml_is_numa(void); // true if init detected that system has >1 NUMA node
 
+    // accuracy of the f32 kernels of the transcendental functions
+    // (AVX512/AVX2/SSE2/NEON vector kernels, other builds use libm in every tier)
+    enum ggml_cpu_math_tier {
+        GGML_CPU_MATH_TIER_DEFAULT = 0, // exp within 2.5 ulp, silu and tanh within 4 ulp, gelu within 1.5e-6
+        GGML_CPU_MATH_TIER_REF     = 1, // scalar libm, same results as the reference formulas
+        GGML_CPU_MATH_TIER_FAST    = 2, // cubic exp polynomial, relative error within 8.5e-5
+    };
+
+    enum ggml_cpu_math_func {
+        GGML_CPU_MATH_EXP  = 0, // exp, soft_max, flash attention
+        GGML_CPU_MATH_SILU = 1,
+        GGML_CPU_MATH_GELU = 2,
+        GGML_CPU_MATH_TANH = 3,
+        GGML_CPU_MATH_COUNT
+    };
+
+    // selects the kernels of a function for the whole process, set it before computing graphs
+    GGML_BACKEND_API void                    ggml_cpu_set_math_tier(enum ggml_cpu_math_func func, enum ggml_cpu_math_tier tier);
+    GGML_BACKEND_API enum ggml_cpu_math_tier ggml_cpu_get_math_tier(enum ggml_cpu_math_func func);
+
     GGML_BACKEND_API struct ggml_tensor * ggml_new_i32(struct ggml_context * ctx, int32_t value);
     GGML_BACKEND_API struct ggml_tensor * ggml_new_f32(struct ggml_context * ctx, float value);
 
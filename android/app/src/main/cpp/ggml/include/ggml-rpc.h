@@ -8,7 +8,7 @@ extern "C" {
 #endif
 
 #define RPC_PROTO_MAJOR_VERSION    2
-#define RPC_PROTO_MINOR_VERSION    0
+#define RPC_PROTO_MINOR_VERSION    1
 #define RPC_PROTO_PATCH_VERSION    0
 #define GGML_RPC_MAX_SERVERS       16
 
@@ -28,6 +28,16 @@ GGML_BACKEND_API ggml_backend_reg_t ggml_backend_rpc_reg(void);
 
 GGML_BACKEND_API ggml_backend_dev_t ggml_backend_rpc_add_device(const char * endpoint);
 
+// Pipelined client (default on, used with servers of protocol 2.1 and later): commands that
+// need no reply are coalesced into a single write together with the next request that has one,
+// such as the graph compute that uses the tensors just set
+GGML_BACKEND_API void ggml_backend_rpc_set_pipelining(bool enable);
+
+// Encoding of F32 compute tensors on the wire: GGML_TYPE_F32 (default, lossless),
+// GGML_TYPE_F16 or GGML_TYPE_Q8_0. Results read back use F16 for both lossy types.
+// Weights are always sent as they are.
+GGML_BACKEND_API void ggml_backend_rpc_set_wire_type(enum ggml_type type);
+
 #ifdef  __cplusplus
 }
 #endif
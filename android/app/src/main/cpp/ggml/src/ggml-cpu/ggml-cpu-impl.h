@@ -506,6 +506,23 @@ static __m256 __lasx_xvreplfr2vr_s(const float val) {
 // TODO: move to ggml-threading
 void ggml_barrier(struct ggml_threadpool * tp);
 
+// sin/cos table of rope, computed by the first rope node of a graph and reused by
+// the following ones with the same positions and parameters
+struct ggml_rope_cache {
+    const struct ggml_tensor * pos;          // positions of the table, NULL if there is none
+    const struct ggml_tensor * freq_factors;
+    int32_t op_params[GGML_MAX_OP_PARAMS / sizeof(int32_t)];
+    float   sin_sign;
+
+    float * data;
+    size_t  size;   // bytes allocated
+};
+
+struct ggml_rope_cache * ggml_threadpool_rope_cache(struct ggml_threadpool * tp);
+
+// grows the table to size bytes, only one thread at a time
+void ggml_rope_cache_reserve(struct ggml_rope_cache * cache, size_t size);
+
 #ifdef __cplusplus
 }
 #endif
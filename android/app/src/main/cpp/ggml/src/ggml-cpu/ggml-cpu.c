@@ -459,6 +459,8 @@ struct ggml_threadpool {
     uint32_t     poll;        // Polling level (0 - no polling)
 
     enum ggml_status ec;
+
+    struct ggml_rope_cache rope_cache; // shared by the rope nodes of the current graph
 };
 
 // Per-thread state
@@ -521,6 +523,22 @@ struct ggml_state {
 
 static struct ggml_state g_state = {0};
 
+struct ggml_rope_cache * ggml_threadpool_rope_cache(struct ggml_threadpool * tp) {
+    return &tp->rope_cache;
+}
+
+void ggml_rope_cache_reserve(struct ggml_rope_cache * cache, size_t size) {
+    if (cache->size >= size) {
+        return;
+    }
+
+    if (cache->data) {
+        ggml_aligned_free(cache->data, cache->size);
+    }
+    cache->data = ggml_aligned_malloc(size);
+    cache->size = size;
+}
+
 void ggml_barrier(struct ggml_threadpool * tp) {
     int n_threads = atomic_load_explicit(&tp->n_threads_cur, memory_order_relaxed);
     if (n_threads == 1) {
@@ -2619,6 +2637,10 @@ void ggml_threadpool_free(struct ggml_threadpool* threadpool) {
     ggml_cond_destroy(&threadpool->cond);
 #endif // GGML_USE_OPENMP
 
+    if (threadpool->rope_cache.data) {
+        ggml_aligned_free(threadpool->rope_cache.data, threadpool->rope_cache.size);
+    }
+
     const size_t workers_size = sizeof(struct ggml_compute_state) * n_threads;
     ggml_aligned_free(threadpool->workers, workers_size);
     ggml_aligned_free(threadpool, sizeof(struct ggml_threadpool));
@@ -2755,8 +2777,6 @@ struct ggml_cplan ggml_graph_plan(
                         }
                     } break;
                 case GGML_OP_SOFT_MAX:
-                case GGML_OP_ROPE:
-                case GGML_OP_ROPE_BACK:
                     {
                         cur = ggml_type_size(GGML_TYPE_F32) * node->ne[0] * n_tasks;
                     } break;
@@ -2801,10 +2821,7 @@ struct ggml_cplan ggml_graph_plan(
                     } break;
                 case GGML_OP_FLASH_ATTN_EXT:
                     {
-                        const int64_t ne10 = node->src[1]->ne[0]; // DK
-                        const int64_t ne20 = node->src[2]->ne[0]; // DV
-
-                        cur = sizeof(float)*(1*ne10 + 2*ne20)*n_tasks; // 1x head size K + 2x head size V (per thread)
+                        cur = ggml_flash_attn_ext_work_size(node, n_tasks);
                     } break;
                 case GGML_OP_FLASH_ATTN_BACK:
                     {
@@ -2851,6 +2868,42 @@ struct ggml_cplan ggml_graph_plan(
     return cplan;
 }
 
+// An rms_norm followed by a mul of its result with a weight row (build_norm in
+// llama.cpp) runs as one node, see ggml_compute_forward_rms_norm_mul
+static bool ggml_graph_can_fuse_rms_norm_mul(const struct ggml_cgraph * cgraph, int node_n) {
+    if (node_n + 1 >= cgraph->n_nodes) {
+        return false;
+    }
+
+    const struct ggml_tensor * norm = cgraph->nodes[node_n];
+    const struct ggml_tensor * mul  = cgraph->nodes[node_n + 1];
+
+    if (norm->op != GGML_OP_RMS_NORM || mul->op != GGML_OP_MUL || mul->src[0] != norm) {
+        return false;
+    }
+
+    const struct ggml_tensor * x = norm->src[0];
+    const struct ggml_tensor * w = mul->src[1];
+
+    if (x->type != GGML_TYPE_F32 || norm->type != GGML_TYPE_F32 || w->type != GGML_TYPE_F32 || mul->type != GGML_TYPE_F32) {
+        return false;
+    }
+
+    if (w->ne[0] != x->ne[0] || ggml_nrows(w) != 1 || w->nb[0] != sizeof(float) || x->nb[0] != sizeof(float)) {
+        return false;
+    }
+
+    // the mul may take the place of x, but not overlap it otherwise: the rows of x
+    // are still read while others are written
+    const char * px = (const char *) x->data;
+    const char * py = (const char *) mul->data;
+    if (px != py && px < py + ggml_nbytes(mul) && py < px + ggml_nbytes(x)) {
+        return false;
+    }
+
+    return true;
+}
+
 static thread_ret_t ggml_graph_compute_thread(void * data) {
     struct ggml_compute_state * state = (struct ggml_compute_state *) data;
     struct ggml_threadpool    * tp    = state->threadpool;
@@ -2871,7 +2924,12 @@ static thread_ret_t ggml_graph_compute_thread(void * data) {
     for (int node_n = 0; node_n < cgraph->n_nodes && atomic_load_explicit(&tp->abort, memory_order_relaxed) != node_n; node_n++) {
         struct ggml_tensor * node = cgraph->nodes[node_n];
 
-        ggml_compute_forward(&params, node);
+        if (ggml_graph_can_fuse_rms_norm_mul(cgraph, node_n)) {
+            ggml_compute_forward_rms_norm_mul(&params, node, cgraph->nodes[node_n + 1]);
+            node_n++;
+        } else {
+            ggml_compute_forward(&params, node);
+        }
 
         if (state->ith == 0 && cplan->abort_callback &&
                 cplan->abort_callback(cplan->abort_callback_data)) {
@@ -3061,6 +3119,8 @@ static struct ggml_threadpool * ggml_threadpool_new_impl(
         threadpool->ec               = GGML_STATUS_SUCCESS;
     }
 
+    memset(&threadpool->rope_cache, 0, sizeof(threadpool->rope_cache));
+
     // Allocate and init workers state
     const size_t workers_size = sizeof(struct ggml_compute_state) * tpp->n_threads;
     struct ggml_compute_state * workers = ggml_aligned_malloc(workers_size);
@@ -3133,6 +3193,7 @@ enum ggml_status ggml_graph_compute(struct ggml_cgraph * cgraph, struct ggml_cpl
         threadpool->current_chunk    = 0;
         threadpool->abort            = -1;
         threadpool->ec               = GGML_STATUS_SUCCESS;
+        threadpool->rope_cache.pos   = NULL; // positions of the last graph are gone
     }
 
 #ifdef GGML_USE_OPENMP
@@ -3333,6 +3333,68 @@ void ggml_compute_forward_rms_norm(
     }
 }
 
+// ggml_compute_forward_rms_norm_mul
+
+void ggml_compute_forward_rms_norm_mul(
+        const ggml_compute_params * params,
+        ggml_tensor * norm,
+        ggml_tensor * dst) {
+
+    const ggml_tensor * src0 = norm->src[0];
+    const ggml_tensor * src1 = dst->src[1]; // weight row
+
+    GGML_ASSERT(dst->src[0] == norm);
+    GGML_ASSERT(src0->type == GGML_TYPE_F32 && src1->type == GGML_TYPE_F32 && dst->type == GGML_TYPE_F32);
+    GGML_ASSERT(ggml_are_same_shape(src0, dst));
+    GGML_ASSERT(src1->ne[0] == src0->ne[0] && ggml_nrows(src1) == 1);
+
+    GGML_ASSERT(src0->nb[0] == sizeof(float));
+    GGML_ASSERT(src1->nb[0] == sizeof(float));
+
+    const int ith = params->ith;
+    const int nth = params->nth;
+
+    GGML_TENSOR_UNARY_OP_LOCALS
+
+    float eps;
+    memcpy(&eps, norm->op_params, sizeof(float));
+
+    GGML_ASSERT(eps >= 0.0f);
+
+    const float * w = (const float *) src1->data;
+
+    // the mul usually takes the place of the norm, otherwise the norm is stored as well
+    const bool store_norm = norm->data != dst->data;
+
+    for (int64_t i03 = 0; i03 < ne03; i03++) {
+        for (int64_t i02 = 0; i02 < ne02; i02++) {
+            for (int64_t i01 = ith; i01 < ne01; i01 += nth) {
+                const float * x = (float *) ((char *) src0->data + i01*nb01 + i02*nb02 + i03*nb03);
+                      float * y = (float *) ((char *)  dst->data + i01*nb1  + i02*nb2  + i03*nb3);
+
+                float sum;
+                ggml_vec_dot_f32(ne00, &sum, 0, x, 0, x, 0, 1);
+
+                const float scale = 1.0f/sqrtf(sum/ne00 + eps);
+
+                if (!store_norm) {
+                    ggml_vec_mul_scale_f32(ne00, y, x, w, scale);
+                    continue;
+                }
+
+                float * yn = (float *) ((char *) norm->data + i01*norm->nb[1] + i02*norm->nb[2] + i03*norm->nb[3]);
+
+                // the norm may take the place of x, read x[i00] before writing it
+                for (int64_t i00 = 0; i00 < ne00; i00++) {
+                    const float v = x[i00]*scale;
+                    yn[i00] = v;
+                    y[i00]  = v*w[i00];
+                }
+            }
+        }
+    }
+}
+
 static void ggml_compute_forward_rms_norm_back_f32(
         const ggml_compute_params * params,
         ggml_tensor * dst) {
@@ -5101,6 +5163,7 @@ static void rope_yarn(
     *sin_theta = sinf(theta) * mscale;
 }
 
+// cache holds the cosines of the ne0/2 pairs, then their sines
 static void ggml_rope_cache_init(
      float theta_base, float freq_scale, const float * freq_factors, float corr_dims[2], int64_t ne0, float ext_factor, float mscale,
      float * cache, float sin_sign, float theta_scale) {
@@ -5109,9 +5172,9 @@ static void ggml_rope_cache_init(
     for (int64_t i0 = 0; i0 < ne0; i0 += 2) {
         const float ff = freq_factors ? freq_factors[i0/2] : 1.0f;
         rope_yarn(
-            theta/ff, freq_scale, corr_dims, i0, ext_factor, mscale, &cache[i0 + 0], &cache[i0 + 1]
+            theta/ff, freq_scale, corr_dims, i0, ext_factor, mscale, &cache[i0/2], &cache[ne0/2 + i0/2]
         );
-        cache[i0 + 1] *= sin_sign;
+        cache[ne0/2 + i0/2] *= sin_sign;
 
         theta *= theta_scale;
     }
@@ -5129,7 +5192,6 @@ static void ggml_mrope_cache_init(
     int sect_dims = sections[0] + sections[1] + sections[2] + sections[3];
     int sec_w = sections[1] + sections[0];
     int sec_e = sections[2] + sec_w;
-    GGML_ASSERT(sect_dims <= ne0);
 
     for (int64_t i0 = 0; i0 < ne0; i0 += 2) {
         const float ff = freq_factors ? freq_factors[i0/2] : 1.0f;
@@ -5164,9 +5226,9 @@ static void ggml_mrope_cache_init(
         }
 
         rope_yarn(
-            theta/ff, freq_scale, corr_dims, i0, ext_factor, mscale, &cache[i0 + 0], &cache[i0 + 1]
+            theta/ff, freq_scale, corr_dims, i0, ext_factor, mscale, &cache[i0/2], &cache[ne0/2 + i0/2]
         );
-        cache[i0 + 1] *= sin_sign;
+        cache[ne0/2 + i0/2] *= sin_sign;
 
         theta_t *= theta_scale;
         theta_w *= theta_scale;
@@ -5175,13 +5237,79 @@ static void ggml_mrope_cache_init(
     }
 }
 
+// Sin/cos table of all positions of dst, n_pairs cosines then n_pairs sines per
+// position. The positions and parameters are the same for the Q and K rope of
+// every layer, so the first rope node of the graph computes the table (each
+// thread a range of positions) and the following ones find it in the threadpool.
+static const float * ggml_rope_table(
+        const ggml_compute_params * params, const ggml_tensor * dst, int64_t n_pairs,
+        float freq_scale, const float * freq_factors, float corr_dims[2], float ext_factor, float attn_factor,
+        float sin_sign, float theta_scale, int sections[4], bool is_mrope, bool is_vision) {
+
+    const ggml_tensor * src1 = dst->src[1];
+    const ggml_tensor * src2 = dst->src[2];
+
+    const int ith = params->ith;
+    const int nth = params->nth;
+
+    ggml_rope_cache * cache = ggml_threadpool_rope_cache(params->threadpool);
+
+    if (cache->pos == src1 && cache->freq_factors == src2 && cache->sin_sign == sin_sign &&
+            memcmp(cache->op_params, dst->op_params, sizeof(cache->op_params)) == 0) {
+        return cache->data;
+    }
+
+    const int64_t ne2 = dst->ne[2];
+
+    // every thread has compared the key before thread 0 replaces it
+    ggml_barrier(params->threadpool);
+
+    if (ith == 0) {
+        ggml_rope_cache_reserve(cache, 2*n_pairs*ne2*sizeof(float));
+
+        cache->pos          = src1;
+        cache->freq_factors = src2;
+        cache->sin_sign     = sin_sign;
+        memcpy(cache->op_params, dst->op_params, sizeof(cache->op_params));
+    }
+
+    ggml_barrier(params->threadpool);
+
+    const int32_t * pos = (const int32_t *) src1->data;
+
+    // positions per thread
+    const int64_t dp  = (ne2 + nth - 1)/nth;
+    const int64_t ip0 = dp*ith;
+    const int64_t ip1 = MIN(ip0 + dp, ne2);
+
+    for (int64_t i2 = ip0; i2 < ip1; i2++) {
+        float * row = cache->data + 2*n_pairs*i2;
+        if (!is_mrope) {
+            const int64_t p = pos[i2];
+            ggml_rope_cache_init(p, freq_scale, freq_factors, corr_dims, 2*n_pairs, ext_factor, attn_factor, row, sin_sign, theta_scale);
+        }
+        else {
+            const int64_t p_t = pos[i2];
+            const int64_t p_h = pos[i2 + ne2];
+            const int64_t p_w = pos[i2 + ne2 * 2];
+            const int64_t p_e = pos[i2 + ne2 * 3];
+            ggml_mrope_cache_init(
+                p_t, p_h, p_w, p_e, sections, is_vision,
+                freq_scale, freq_factors, corr_dims, 2*n_pairs, ext_factor, attn_factor, row, sin_sign, theta_scale);
+        }
+    }
+
+    ggml_barrier(params->threadpool);
+
+    return cache->data;
+}
+
 static void ggml_compute_forward_rope_f32(
         const ggml_compute_params * params,
         ggml_tensor * dst,
         const bool forward) {
 
     const ggml_tensor * src0 = dst->src[0];
-    const ggml_tensor * src1 = dst->src[1];
     const ggml_tensor * src2 = dst->src[2];
 
     float freq_base, freq_scale, ext_factor, attn_factor, beta_fast, beta_slow;
@@ -5237,6 +5365,7 @@ static void ggml_compute_forward_rope_f32(
 
     if (is_mrope) {
         GGML_ASSERT(sections[0] > 0 || sections[1] > 0 || sections[2] > 0);
+        GGML_ASSERT(sections[0] + sections[1] + sections[2] + sections[3] <= ne0);
     }
 
     if (is_vision) {
@@ -5255,105 +5384,40 @@ static void ggml_compute_forward_rope_f32(
     // this essentially just switches the sign of sin.
     const float sin_sign = forward ? 1.0f : -1.0f;
 
-    const int32_t * pos = (const int32_t *) src1->data;
+    // vision rotates (x[i], x[i + n_dims]) for all of ne0, the others the first n_dims
+    const int64_t n_pairs = is_vision ? n_dims : n_dims/2;
+
+    const float * table = ggml_rope_table(params, dst, n_pairs, freq_scale, freq_factors, corr_dims, ext_factor, attn_factor,
+                                          sin_sign, theta_scale, sections, is_mrope, is_vision);
 
     for (int64_t i3 = 0; i3 < ne3; i3++) { // batch
         for (int64_t i2 = 0; i2 < ne2; i2++) { // seq-len
 
-            float * cache = (float *) params->wdata + (ne0 + CACHE_LINE_SIZE_F32)*ith;
-            if (!is_mrope) {
-                const int64_t p = pos[i2];
-                ggml_rope_cache_init(p, freq_scale, freq_factors, corr_dims, ne0, ext_factor, attn_factor, cache, sin_sign, theta_scale);
-            }
-            else {
-                const int64_t p_t = pos[i2];
-                const int64_t p_h = pos[i2 + ne2];
-                const int64_t p_w = pos[i2 + ne2 * 2];
-                const int64_t p_e = pos[i2 + ne2 * 3];
-                ggml_mrope_cache_init(
-                    p_t, p_h, p_w, p_e, sections, is_vision,
-                    freq_scale, freq_factors, corr_dims, ne0, ext_factor, attn_factor, cache, sin_sign, theta_scale);
-            }
+            const float * cos_theta = table + 2*n_pairs*i2;
+            const float * sin_theta = cos_theta + n_pairs;
 
             for (int64_t i1 = 0; i1 < ne1; i1++) { // attn-heads
                 if (ir++ < ir0) continue;
                 if (ir   > ir1) break;
 
-                if (is_neox || is_mrope) {
-                    if (is_vision){
-                        for (int64_t i0 = 0; i0 < n_dims; i0 += 2) {
-                            const int64_t ic = i0/2;
-
-                            const float cos_theta = cache[i0 + 0];
-                            const float sin_theta = cache[i0 + 1];
-
-                            const float * const src = (float *)((char *) src0->data + i3*nb03 + i2*nb02 + i1*nb01 + ic*nb00);
-                            float * dst_data  = (float *)((char *)  dst->data + i3*nb3  + i2*nb2  + i1*nb1  + ic*nb0);
-
-                            const float x0 = src[0];
-                            const float x1 = src[n_dims];
-
-                            dst_data[0]      = x0*cos_theta - x1*sin_theta;
-                            dst_data[n_dims] = x0*sin_theta + x1*cos_theta;
-                        }
-                    } else {
-                        for (int64_t i0 = 0; i0 < n_dims; i0 += 2) {
-                            const int64_t ic = i0/2;
-
-                            const float cos_theta = cache[i0 + 0];
-                            const float sin_theta = cache[i0 + 1];
-
-                            const float * const src = (float *)((char *) src0->data + i3*nb03 + i2*nb02 + i1*nb01 + ic*nb00);
-                            float * dst_data  = (float *)((char *)  dst->data + i3*nb3  + i2*nb2  + i1*nb1  + ic*nb0);
-
-                            const float x0 = src[0];
-                            const float x1 = src[n_dims/2];
-
-                            dst_data[0]        = x0*cos_theta - x1*sin_theta;
-                            dst_data[n_dims/2] = x0*sin_theta + x1*cos_theta;
-                        }
-                    }
-                } else {
-                    for (int64_t i0 = 0; i0 < n_dims; i0 += 2) {
-                        const float cos_theta = cache[i0 + 0];
-                        const float sin_theta = cache[i0 + 1];
-
-                        const float * const src = (float *)((char *) src0->data + i3*nb03 + i2*nb02 + i1*nb01 + i0*nb00);
-                              float * dst_data  = (float *)((char *)  dst->data + i3*nb3  + i2*nb2  + i1*nb1  + i0*nb0);
-
-                        const float x0 = src[0];
-                        const float x1 = src[1];
-
-                        dst_data[0] = x0*cos_theta - x1*sin_theta;
-                        dst_data[1] = x0*sin_theta + x1*cos_theta;
-                    }
-                }
+                const float * const src = (float *)((char *) src0->data + i3*nb03 + i2*nb02 + i1*nb01);
+                      float * dst_data  = (float *)((char *)  dst->data + i3*nb3  + i2*nb2  + i1*nb1);
 
                 if (is_vision) {
-                    for (int64_t i0 = n_dims; i0 < ne0; i0 += 2) {
-                        const int64_t ic = i0/2;
-
-                        const float cos_theta = cache[i0 + 0];
-                        const float sin_theta = cache[i0 + 1];
-
-                        const float * const src = (float *)((char *) src0->data + i3*nb03 + i2*nb02 + i1*nb01 + ic*nb00);
-                        float * dst_data  = (float *)((char *)  dst->data + i3*nb3  + i2*nb2  + i1*nb1  + ic*nb0);
-
-                        const float x0 = src[0];
-                        const float x1 = src[n_dims];
+                    ggml_vec_rope_neox_f32(n_pairs, dst_data, dst_data + n_dims, src, src + n_dims, cos_theta, sin_theta);
+                    continue;
+                }
 
-                        dst_data[0]      = x0*cos_theta - x1*sin_theta;
-                        dst_data[n_dims] = x0*sin_theta + x1*cos_theta;
-                    }
+                if (is_neox || is_mrope) {
+                    ggml_vec_rope_neox_f32(n_pairs, dst_data, dst_data + n_dims/2, src, src + n_dims/2, cos_theta, sin_theta);
                 } else {
-                    // fill the remain channels with data from src tensor
-                    for (int64_t i0 = n_dims; i0 < ne0; i0 += 2) {
-                        const float * const src = (float *)((char *) src0->data + i3*nb03 + i2*nb02 + i1*nb01 + i0*nb00);
-                        float * dst_data  = (float *)((char *)  dst->data + i3*nb3  + i2*nb2  + i1*nb1  + i0*nb0);
+                    ggml_vec_rope_norm_f32(n_pairs, dst_data, src, cos_theta, sin_theta);
+                }
 
-                        dst_data[0] = src[0];
-                        dst_data[1] = src[1];
-                    }
+                // fill the remain channels with data from src tensor
+                for (int64_t i0 = n_dims; i0 < ne0; i0 += 2) {
+                    dst_data[i0]     = src[i0];
+                    dst_data[i0 + 1] = src[i0 + 1];
                 }
             }
         }
@@ -5367,7 +5431,6 @@ static void ggml_compute_forward_rope_f16(
         const bool forward) {
 
     const ggml_tensor * src0 = dst->src[0];
-    const ggml_tensor * src1 = dst->src[1];
     const ggml_tensor * src2 = dst->src[2];
 
     float freq_base, freq_scale, ext_factor, attn_factor, beta_fast, beta_slow;
@@ -5423,6 +5486,7 @@ static void ggml_compute_forward_rope_f16(
 
     if (is_mrope) {
         GGML_ASSERT(sections[0] > 0 || sections[1] > 0 || sections[2] > 0);
+        GGML_ASSERT(sections[0] + sections[1] + sections[2] + sections[3] <= ne0);
     }
 
     if (is_vision) {
@@ -5441,103 +5505,41 @@ static void ggml_compute_forward_rope_f16(
     // this essentially just switches the sign of sin.
     const float sin_sign = forward ? 1.0f : -1.0f;
 
-    const int32_t * pos = (const int32_t *) src1->data;
+    const int64_t n_pairs = is_vision ? n_dims : n_dims/2;
+
+    const float * table = ggml_rope_table(params, dst, n_pairs, freq_scale, freq_factors, corr_dims, ext_factor, attn_factor,
+                                          sin_sign, theta_scale, sections, is_mrope, is_vision);
 
     for (int64_t i3 = 0; i3 < ne3; i3++) {
         for (int64_t i2 = 0; i2 < ne2; i2++) {
 
-            float * cache = (float *) params->wdata + (ne0 + CACHE_LINE_SIZE_F32)*ith;
-            if (!is_mrope) {
-                const int64_t p = pos[i2];
-                ggml_rope_cache_init(p, freq_scale, freq_factors, corr_dims, ne0, ext_factor, attn_factor, cache, sin_sign, theta_scale);
-            }
-            else {
-                const int64_t p_t = pos[i2];
-                const int64_t p_h = pos[i2 + ne2];
-                const int64_t p_w = pos[i2 + ne2 * 2];
-                const int64_t p_e = pos[i2 + ne2 * 3];
-                ggml_mrope_cache_init(
-                    p_t, p_h, p_w, p_e, sections, is_vision,
-                    freq_scale, freq_factors, corr_dims, ne0, ext_factor, attn_factor, cache, sin_sign, theta_scale);
-            }
+            const float * cos_theta = table + 2*n_pairs*i2;
+            const float * sin_theta = cos_theta + n_pairs;
 
             for (int64_t i1 = 0; i1 < ne1; i1++) {
                 if (ir++ < ir0) continue;
                 if (ir   > ir1) break;
 
-                if (is_neox || is_mrope) {
-                    if (is_vision) {
-                        for (int64_t i0 = 0; i0 < n_dims; i0 += 2) {
-                            const int64_t ic = i0/2;
-
-                            const float cos_theta = cache[i0 + 0];
-                            const float sin_theta = cache[i0 + 1];
+                const char        * const src = (char *) src0->data + i3*nb03 + i2*nb02 + i1*nb01;
+                      ggml_fp16_t * dst_data  = (ggml_fp16_t *)((char *) dst->data + i3*nb3 + i2*nb2 + i1*nb1);
 
-                            const ggml_fp16_t * const src = (ggml_fp16_t *)((char *) src0->data + i3*nb03 + i2*nb02 + i1*nb01 + ic*nb00);
-                            ggml_fp16_t * dst_data  = (ggml_fp16_t *)((char *)  dst->data + i3*nb3  + i2*nb2  + i1*nb1  + ic*nb0);
+                // distance between the two values of a pair
+                const int64_t n_offs = is_vision ? n_dims : (is_neox || is_mrope) ? n_dims/2 : 1;
 
-                            const float x0 = GGML_FP16_TO_FP32(src[0]);
-                            const float x1 = GGML_FP16_TO_FP32(src[n_dims]);
+                for (int64_t ic = 0; ic < n_pairs; ic++) {
+                    const int64_t i0 = is_vision || is_neox || is_mrope ? ic : 2*ic;
 
-                            dst_data[0]      = GGML_FP32_TO_FP16(x0*cos_theta - x1*sin_theta);
-                            dst_data[n_dims] = GGML_FP32_TO_FP16(x0*sin_theta + x1*cos_theta);
-                        }
-                    } else {
-                        for (int64_t i0 = 0; i0 < n_dims; i0 += 2) {
-                            const int64_t ic = i0/2;
-
-                            const float cos_theta = cache[i0 + 0];
-                            const float sin_theta = cache[i0 + 1];
-
-                            const ggml_fp16_t * const src = (ggml_fp16_t *)((char *) src0->data + i3*nb03 + i2*nb02 + i1*nb01 + ic*nb00);
-                            ggml_fp16_t * dst_data  = (ggml_fp16_t *)((char *)  dst->data + i3*nb3  + i2*nb2  + i1*nb1  + ic*nb0);
-
-                            const float x0 = GGML_FP16_TO_FP32(src[0]);
-                            const float x1 = GGML_FP16_TO_FP32(src[n_dims/2]);
-
-                            dst_data[0]        = GGML_FP32_TO_FP16(x0*cos_theta - x1*sin_theta);
-                            dst_data[n_dims/2] = GGML_FP32_TO_FP16(x0*sin_theta + x1*cos_theta);
-                        }
-                    }
-                } else {
-                    for (int64_t i0 = 0; i0 < n_dims; i0 += 2) {
-                        const float cos_theta = cache[i0 + 0];
-                        const float sin_theta = cache[i0 + 1];
+                    const float x0 = GGML_FP16_TO_FP32(*(const ggml_fp16_t *) (src + (i0         )*nb00));
+                    const float x1 = GGML_FP16_TO_FP32(*(const ggml_fp16_t *) (src + (i0 + n_offs)*nb00));
 
-                        const ggml_fp16_t * const src = (ggml_fp16_t *)((char *) src0->data + i3*nb03 + i2*nb02 + i1*nb01 + i0*nb00);
-                              ggml_fp16_t * dst_data  = (ggml_fp16_t *)((char *)  dst->data + i3*nb3  + i2*nb2  + i1*nb1  + i0*nb0);
-
-                        const float x0 = GGML_FP16_TO_FP32(src[0]);
-                        const float x1 = GGML_FP16_TO_FP32(src[1]);
-
-                        dst_data[0] = GGML_FP32_TO_FP16(x0*cos_theta - x1*sin_theta);
-                        dst_data[1] = GGML_FP32_TO_FP16(x0*sin_theta + x1*cos_theta);
-                    }
+                    dst_data[i0]          = GGML_FP32_TO_FP16(x0*cos_theta[ic] - x1*sin_theta[ic]);
+                    dst_data[i0 + n_offs] = GGML_FP32_TO_FP16(x0*sin_theta[ic] + x1*cos_theta[ic]);
                 }
 
-                if (is_vision) {
-                    for (int64_t i0 = n_dims; i0 < ne0; i0 += 2) {
-                        const int64_t ic = i0/2;
-
-                        const float cos_theta = cache[i0 + 0];
-                        const float sin_theta = cache[i0 + 1];
-
-                        const ggml_fp16_t * const src = (ggml_fp16_t *)((char *) src0->data + i3*nb03 + i2*nb02 + i1*nb01 + ic*nb00);
-                        ggml_fp16_t * dst_data  = (ggml_fp16_t *)((char *)  dst->data + i3*nb3  + i2*nb2  + i1*nb1  + ic*nb0);
-
-                        const float x0 = GGML_FP16_TO_FP32(src[0]);
-                        const float x1 = GGML_FP16_TO_FP32(src[n_dims]);
-
-                        dst_data[0]      = GGML_FP32_TO_FP16(x0*cos_theta - x1*sin_theta);
-                        dst_data[n_dims] = GGML_FP32_TO_FP16(x0*sin_theta + x1*cos_theta);
-                    }
-                } else {
-                    for (int64_t i0 = n_dims; i0 < ne0; i0 += 2) {
-                        const ggml_fp16_t * const src = (ggml_fp16_t *)((char *) src0->data + i3*nb03 + i2*nb02 + i1*nb01 + i0*nb00);
-                        ggml_fp16_t * dst_data  = (ggml_fp16_t *)((char *)  dst->data + i3*nb3  + i2*nb2  + i1*nb1  + i0*nb0);
-
-                        dst_data[0] = src[0];
-                        dst_data[1] = src[1];
+                if (!is_vision) {
+                    // fill the remain channels with data from src tensor
+                    for (int64_t i0 = n_dims; i0 < ne0; i0++) {
+                        dst_data[i0] = *(const ggml_fp16_t *) (src + i0*nb00);
                     }
                 }
             }
@@ -6945,13 +6947,128 @@ void ggml_compute_forward_argsort(
 
 // ggml_compute_forward_flash_attn_ext
 
-static void ggml_compute_forward_flash_attn_ext_f16(
+// Query heads sharing a KV head (GQA) are processed together in groups of up to
+// GGML_FA_MAX_GROUP heads: each K row is read once for the dot products of all
+// heads of the group, and each V row is converted once and accumulated into all
+// of their outputs. KV cells are walked in tiles of GGML_FA_TILE; per tile the
+// softmax weights form a (group x tile) matrix that multiplies the V rows of
+// the tile.
+//
+// Split-KV (flash-decoding): with few groups, e.g. a single token at decode, the
+// groups do not spread evenly over the threads and the busiest thread walks the
+// whole KV cache for each of its groups. Instead every thread takes a slice of
+// the KV cache for all groups and keeps a partial result (max, sum, accumulator)
+// per q row; after a barrier the partials of each row are merged with a
+// log-sum-exp.
+
+#define GGML_FA_MAX_GROUP 8
+#define GGML_FA_TILE      32
+
+// q heads per group, a divisor of the heads per KV head
+static int64_t ggml_flash_attn_ext_group_size(const ggml_tensor * dst) {
+    const ggml_tensor * q = dst->src[0];
+    const ggml_tensor * k = dst->src[1];
+    const ggml_tensor * v = dst->src[2];
+
+    if (k->ne[2] != v->ne[2] || q->ne[2] % k->ne[2] != 0) {
+        return 1;
+    }
+
+    const int64_t rk2 = q->ne[2]/k->ne[2];
+
+    int64_t ng = MIN(rk2, GGML_FA_MAX_GROUP);
+    while (rk2 % ng != 0) {
+        --ng;
+    }
+    return ng;
+}
+
+// KV slices with n_threads, 1 = parallel over groups only
+static int64_t ggml_flash_attn_ext_n_kv_chunks(const ggml_tensor * dst, int n_threads) {
+    const ggml_tensor * q = dst->src[0];
+    const ggml_tensor * k = dst->src[1];
+
+    const int64_t nth  = n_threads;
+    const int64_t ng   = ggml_flash_attn_ext_group_size(dst);
+    const int64_t nr   = q->ne[1]*q->ne[2]*q->ne[3];
+    const int64_t nu   = nr/ng;
+    const int64_t n_kv = k->ne[1];
+
+    if (nth <= 1 || n_kv < 256) {
+        return 1;
+    }
+
+    // work of the busiest thread in group x KV cell steps: by groups it walks the
+    // KV cache for each of its groups; split, it walks its slice for all groups,
+    // then merges its share of the rows (nth partials each, about half the cost
+    // of a KV cell per partial and head) after a barrier
+    const int64_t cost_groups = ((nu + nth - 1)/nth)*n_kv;
+    const int64_t cost_split  = nu*((n_kv + nth - 1)/nth) + ((nr + nth - 1)/nth)*nth/(2*ng) + 64;
+
+    return cost_split < cost_groups ? nth : 1;
+}
+
+// floats of the per-thread block: Q converted for the K vec_dot per head, one V
+// row in F32 or the FP16 accumulators of the heads, and an output record
+// (accumulator, max, sum) per head
+static int64_t ggml_flash_attn_ext_thread_floats(const ggml_tensor * dst) {
+    const int64_t DK = dst->src[1]->ne[0];
+    const int64_t DV = dst->src[2]->ne[0];
+    const int64_t ng = ggml_flash_attn_ext_group_size(dst);
+
+    return ng*DK + ng*DV + ng*(DV + 2);
+}
+
+size_t ggml_flash_attn_ext_work_size(const ggml_tensor * dst, int n_threads) {
+    const int64_t DV = dst->src[2]->ne[0];
+
+    size_t cur = sizeof(float)*ggml_flash_attn_ext_thread_floats(dst)*n_threads;
+
+    // split-KV: an output record per q row and KV slice
+    const int64_t n_chunks = ggml_flash_attn_ext_n_kv_chunks(dst, n_threads);
+    if (n_chunks > 1) {
+        cur += sizeof(float)*(DV + 2)*ggml_nrows(dst->src[0])*n_chunks;
+    }
+
+    return cur;
+}
+
+// q row of head j of group iu, groups ordered by q position, then KV head
+static int64_t ggml_flash_attn_ext_row(const ggml_tensor * q, int64_t ng, int64_t iu, int64_t j) {
+    const int64_t neq1 = q->ne[1];
+    const int64_t nug  = q->ne[2]/ng; // groups per q position
+
+    const int64_t iq3 = iu/(nug*neq1);
+    const int64_t ig  = (iu - iq3*nug*neq1)/neq1;
+    const int64_t iq1 = (iu - iq3*nug*neq1 - ig*neq1);
+
+    return iq1 + neq1*(ig*ng + j + q->ne[2]*iq3);
+}
+
+// dst row of q row ir, permute(0, 2, 1, 3)
+static float * ggml_flash_attn_ext_dst_row(const ggml_tensor * q, ggml_tensor * dst, int64_t ir) {
+    const int64_t neq1 = q->ne[1];
+    const int64_t neq2 = q->ne[2];
+
+    const int64_t i3 = ir/(neq2*neq1);
+    const int64_t i2 = (ir - i3*neq2*neq1)/neq1;
+    const int64_t i1 = (ir - i3*neq2*neq1 - i2*neq1);
+
+    return (float *) ((char *) dst->data + (i3*dst->ne[2]*dst->ne[1] + i2 + i1*dst->ne[1])*dst->nb[1]);
+}
+
+// Online softmax of the heads of group iu over the KV cells [ic0, ic1). The record
+// of head j at out + j*out_stride holds the DV accumulators (sum of v*expf(KQ - M)),
+// M, the maximum KQ value, and S, the sum of expf(KQ - M).
+static void ggml_compute_forward_flash_attn_ext_f16_one_chunk(
         const ggml_compute_params * params,
         const ggml_tensor * q,
         const ggml_tensor * k,
         const ggml_tensor * v,
         const ggml_tensor * mask,
-        ggml_tensor * dst) {
+        ggml_tensor * dst,
+        int64_t ng, int64_t iu, int64_t ic0, int64_t ic1,
+        float * out, int64_t out_stride) {
 
     GGML_TENSOR_LOCALS(int64_t, neq, q,   ne)
     GGML_TENSOR_LOCALS(size_t,  nbq, q,   nb)
@@ -6959,35 +7076,11 @@ static void ggml_compute_forward_flash_attn_ext_f16(
     GGML_TENSOR_LOCALS(size_t,  nbk, k,   nb)
     GGML_TENSOR_LOCALS(int64_t, nev, v,   ne)
     GGML_TENSOR_LOCALS(size_t,  nbv, v,   nb)
-    GGML_TENSOR_LOCALS(int64_t, ne,  dst, ne)
-    GGML_TENSOR_LOCALS(size_t,  nb,  dst, nb)
 
     const int ith = params->ith;
-    const int nth = params->nth;
 
     const int64_t DK = nek0;
     const int64_t DV = nev0;
-    const int64_t N  = neq1;
-
-    GGML_ASSERT(ne0 == DV);
-    GGML_ASSERT(ne2 == N);
-
-    // input tensor rows must be contiguous
-    GGML_ASSERT(nbq0 == ggml_type_size(q->type));
-    GGML_ASSERT(nbk0 == ggml_type_size(k->type));
-    GGML_ASSERT(nbv0 == ggml_type_size(v->type));
-
-    GGML_ASSERT(neq0 == DK);
-    GGML_ASSERT(nek0 == DK);
-    GGML_ASSERT(nev0 == DV);
-
-    GGML_ASSERT(neq1 == N);
-
-    // dst cannot be transposed or permuted
-    GGML_ASSERT(nb0 == sizeof(float));
-    GGML_ASSERT(nb0 <= nb1);
-    GGML_ASSERT(nb1 <= nb2);
-    GGML_ASSERT(nb2 <= nb3);
 
     // broadcast factors
     const int64_t rk2 = neq2/nek2;
@@ -6996,18 +7089,6 @@ static void ggml_compute_forward_flash_attn_ext_f16(
     const int64_t rv2 = neq2/nev2;
     const int64_t rv3 = neq3/nev3;
 
-    // parallelize by q rows using ggml_vec_dot_f32
-
-    // total rows in q
-    const int nr = neq1*neq2*neq3;
-
-    // rows per thread
-    const int dr = (nr + nth - 1)/nth;
-
-    // row range for this thread
-    const int ir0 = dr*ith;
-    const int ir1 = MIN(ir0 + dr, nr);
-
     float scale         = 1.0f;
     float max_bias      = 0.0f;
     float logit_softcap = 0.0f;
@@ -7034,133 +7115,279 @@ static void ggml_compute_forward_flash_attn_ext_f16(
     GGML_ASSERT((                            q_to_vec_dot) && "fattn: unsupported K-type");
     GGML_ASSERT((v->type == GGML_TYPE_F32 || v_to_float  ) && "fattn: unsupported V-type");
 
-    // loop over n_batch and n_head
-    for (int ir = ir0; ir < ir1; ++ir) {
-        // q indices
-        const int iq3 = ir/(neq2*neq1);
-        const int iq2 = (ir - iq3*neq2*neq1)/neq1;
-        const int iq1 = (ir - iq3*neq2*neq1 - iq2*neq1);
+    // q indices of the first head of the group
+    const int64_t ir0 = ggml_flash_attn_ext_row(q, ng, iu, 0);
 
-        const uint32_t h = iq2; // head index
-        const float slope = (max_bias > 0.0f) ? h < n_head_log2 ? powf(m0, h + 1) : powf(m1, 2*(h - n_head_log2) + 1) : 1.0f;
+    const int iq3 = ir0/(neq2*neq1);
+    const int iq2 = (ir0 - iq3*neq2*neq1)/neq1;
+    const int iq1 = (ir0 - iq3*neq2*neq1 - iq2*neq1);
 
-        float S = 0.0f;      // sum
-        float M = -INFINITY; // maximum KQ value
+    // per-thread block of the work buffer
+    float       * wdata = (float *) params->wdata + ith*(ggml_flash_attn_ext_thread_floats(dst) + CACHE_LINE_SIZE_F32);
+    char        * Q_q   = (char        *) wdata;           // (temporary) Q converted to quantized/FP16, DK floats per head
+    float       * V32   =                 (wdata + ng*DK); // (temporary) FP32 V row
+    ggml_fp16_t * VKQ16 = (ggml_fp16_t *) (wdata + ng*DK); // (temporary) FP16 VKQ accumulators, DV per head
 
-        float       * VKQ32 = (float       *) params->wdata + ith*(1*DK + 2*DV + CACHE_LINE_SIZE_F32); // FP32 VKQ accumulator
-        float       * V32   =                 (VKQ32 + 1*DV); // (temporary) FP32 V buffer
-        ggml_fp16_t * VKQ16 = (ggml_fp16_t *) (VKQ32 + 1*DV); // (temporary) FP16 VKQ accumulator
-        ggml_fp16_t * Q_q   = (ggml_fp16_t *) (VKQ32 + 2*DV); // (temporary) buffer for Q converted to quantized/FP16
+    float slope[GGML_FA_MAX_GROUP];
+    float M[GGML_FA_MAX_GROUP];
+    float S[GGML_FA_MAX_GROUP];
+
+    for (int64_t j = 0; j < ng; ++j) {
+        const uint32_t h = iq2 + j; // head index
+        slope[j] = (max_bias > 0.0f) ? h < n_head_log2 ? powf(m0, h + 1) : powf(m1, 2*(h - n_head_log2) + 1) : 1.0f;
+
+        M[j] = -INFINITY;
+        S[j] = 0.0f;
 
         if (v->type == GGML_TYPE_F16) {
-            memset(VKQ16, 0, DV*sizeof(ggml_fp16_t));
+            memset(VKQ16 + j*DV, 0, DV*sizeof(ggml_fp16_t));
         } else {
-            memset(VKQ32, 0, DV*sizeof(float));
+            memset(out + j*out_stride, 0, DV*sizeof(float));
         }
 
-        const ggml_fp16_t * mp = mask ? (ggml_fp16_t *)((char *) mask->data + iq1*mask->nb[1]) : NULL;
+        const float * pq = (const float *) ((char *) q->data + (iq1*nbq1 + (iq2 + j)*nbq2 + iq3*nbq3));
+        q_to_vec_dot(pq, Q_q + j*DK*sizeof(float), DK);
+    }
+
+    const ggml_fp16_t * mp = mask ? (ggml_fp16_t *)((char *) mask->data + iq1*mask->nb[1]) : NULL;
+
+    // k indices
+    const int ik3 = iq3 / rk3;
+    const int ik2 = iq2 / rk2;
 
-        // k indices
-        const int ik3 = iq3 / rk3;
-        const int ik2 = iq2 / rk2;
+    // v indices
+    const int iv3 = iq3 / rv3;
+    const int iv2 = iq2 / rv2;
 
-        // v indices
-        const int iv3 = iq3 / rv3;
-        const int iv2 = iq2 / rv2;
+    const size_t v_row_size = ggml_row_size(v->type, DV);
 
-        const float * pq = (const float *) ((char *) q->data + (iq1*nbq1 + iq2*nbq2 + iq3*nbq3));
-        q_to_vec_dot(pq, Q_q, DK);
+    // KQ values, then softmax weights, of the group for the cells of a tile
+    float   KQ[GGML_FA_MAX_GROUP*GGML_FA_TILE];
+    int64_t cells[GGML_FA_TILE];
 
-        // online softmax / attention
-        // loop over n_kv and n_head_kv
-        // ref: https://arxiv.org/pdf/2112.05682.pdf
-        for (int64_t ic = 0; ic < nek1; ++ic) {
-            const float mv = mp ? slope*GGML_FP16_TO_FP32(mp[ic]) : 0.0f;
+    // online softmax / attention
+    // loop over n_kv and n_head_kv
+    // ref: https://arxiv.org/pdf/2112.05682.pdf
+    for (int64_t it = ic0; it < ic1; it += GGML_FA_TILE) {
+        const int64_t it1 = MIN(it + GGML_FA_TILE, ic1);
+
+        // KQ of the cells that are not masked, each K row read once for the group
+        int64_t nc = 0;
+        for (int64_t ic = it; ic < it1; ++ic) {
+            const float mv = mp ? GGML_FP16_TO_FP32(mp[ic]) : 0.0f;
             if (mv == -INFINITY) {
                 continue;
             }
 
-            float s; // KQ value
-
             const char * k_data = (const char *) k->data + ( ic*nbk1 + ik2*nbk2 + ik3*nbk3);
-            kq_vec_dot(DK, &s, 0, k_data, 0, Q_q, 0, 1);
-
-            s = s*scale; // scale KQ value
 
-            if (logit_softcap != 0.0f) {
-                s = logit_softcap*tanhf(s);
+            // start loading the V row, it is needed once the tile is done
+            const char * v_data = (const char *) v->data + ( ic*nbv1 + iv2*nbv2 + iv3*nbv3);
+            for (size_t o = 0; o < v_row_size; o += 64) {
+                __builtin_prefetch(v_data + o, 0, 1);
             }
 
-            s += mv; // apply mask
+            for (int64_t j = 0; j < ng; ++j) {
+                float s; // KQ value
+                kq_vec_dot(DK, &s, 0, k_data, 0, Q_q + j*DK*sizeof(float), 0, 1);
 
-            const float Mold = M;
+                s = s*scale; // scale KQ value
 
-            float ms = 1.0f; // upon new higher max val, scale VKQ and KQ sum with this value
-            float vs = 1.0f; // post-softmax KQ value, expf(s - M)
+                if (logit_softcap != 0.0f) {
+                    s = logit_softcap*tanhf(s);
+                }
 
-            const char * v_data = ((const char *) v->data + (ic*nbv1 + iv2*nbv2 + iv3*nbv3));
+                KQ[j*GGML_FA_TILE + nc] = s + slope[j]*mv; // apply mask
+            }
+            cells[nc++] = ic;
+        }
 
-            if (v->type == GGML_TYPE_F16) {
-                if (s > M) {
-                    // s is new maximum, ms < 1.0f, vs == expf(s - s) == 1.0f
-                    M = s;
-                    ms = expf(Mold - M);
+        if (nc == 0) {
+            continue;
+        }
 
-                    // V = V*expf(Mold - M)
-                    ggml_vec_scale_f16(DV, VKQ16, ms);
-                } else {
-                    // no new maximum, ms == 1.0f, vs != 1.0f
-                    vs = expf(s - M);
-                }
+        for (int64_t j = 0; j < ng; ++j) {
+            float * KQ_j = KQ + j*GGML_FA_TILE;
 
-                // V += v*expf(s - M)
-                ggml_vec_mad_f16(DV, VKQ16, (const ggml_fp16_t *) v_data, vs);
-            } else {
-                if (s > M) {
-                    // s is new maximum, ms < 1.0f, vs == expf(s - s) == 1.0f
-                    M = s;
-                    ms = expf(Mold - M);
+            float Mnew = M[j];
+            for (int64_t c = 0; c < nc; ++c) {
+                Mnew = MAX(Mnew, KQ_j[c]);
+            }
 
-                    // V = V*expf(Mold - M)
-                    ggml_vec_scale_f32(DV, VKQ32, ms);
+            // upon new higher max val, scale VKQ and KQ sum with expf(Mold - M)
+            if (Mnew > M[j]) {
+                const float ms = expf(M[j] - Mnew);
+                if (v->type == GGML_TYPE_F16) {
+                    ggml_vec_scale_f16(DV, VKQ16 + j*DV, ms);
                 } else {
-                    // no new maximum, ms == 1.0f, vs != 1.0f
-                    vs = expf(s - M);
+                    ggml_vec_scale_f32(DV, out + j*out_stride, ms);
                 }
+                S[j] *= ms;
+                M[j]  = Mnew;
+            }
 
-                // V += v*expf(s - M)
-                if (v_to_float) {
-                    v_to_float(v_data, V32, DV);
-                    ggml_vec_mad_f32(DV, VKQ32, V32, vs);
-                } else {
-                    // V is F32
-                    ggml_vec_mad_f32(DV, VKQ32, (const float *) v_data, vs);
+            // post-softmax KQ values, expf(s - M)
+            S[j] += (float) ggml_vec_soft_max_f32(nc, KQ_j, KQ_j, M[j]);
+        }
+
+        // V += v*expf(s - M), each V row converted once for the group
+        for (int64_t c = 0; c < nc; ++c) {
+            const char * v_data = ((const char *) v->data + (cells[c]*nbv1 + iv2*nbv2 + iv3*nbv3));
+
+            if (v->type == GGML_TYPE_F16) {
+                for (int64_t j = 0; j < ng; ++j) {
+                    ggml_vec_mad_f16(DV, VKQ16 + j*DV, (const ggml_fp16_t *) v_data, KQ[j*GGML_FA_TILE + c]);
                 }
+                continue;
             }
 
-            S = S*ms + vs; // scale and increment sum with partial sum
+            const float * v_row = (const float *) v_data;
+            if (v->type != GGML_TYPE_F32) {
+                v_to_float(v_data, V32, DV);
+                v_row = V32;
+            }
+
+            for (int64_t j = 0; j < ng; ++j) {
+                ggml_vec_mad_f32(DV, out + j*out_stride, v_row, KQ[j*GGML_FA_TILE + c]);
+            }
         }
+    }
 
+    for (int64_t j = 0; j < ng; ++j) {
         if (v->type == GGML_TYPE_F16) {
-            for (int64_t d = 0; d < DV; ++d) {
-                VKQ32[d] = GGML_FP16_TO_FP32(VKQ16[d]);
+            ggml_cpu_fp16_to_fp32(VKQ16 + j*DV, out + j*out_stride, DV);
+        }
+        out[j*out_stride + DV + 0] = M[j];
+        out[j*out_stride + DV + 1] = S[j];
+    }
+}
+
+static void ggml_compute_forward_flash_attn_ext_f16(
+        const ggml_compute_params * params,
+        const ggml_tensor * q,
+        const ggml_tensor * k,
+        const ggml_tensor * v,
+        const ggml_tensor * mask,
+        ggml_tensor * dst) {
+
+    GGML_TENSOR_LOCALS(int64_t, neq, q,   ne)
+    GGML_TENSOR_LOCALS(size_t,  nbq, q,   nb)
+    GGML_TENSOR_LOCALS(int64_t, nek, k,   ne)
+    GGML_TENSOR_LOCALS(size_t,  nbk, k,   nb)
+    GGML_TENSOR_LOCALS(int64_t, nev, v,   ne)
+    GGML_TENSOR_LOCALS(size_t,  nbv, v,   nb)
+    GGML_TENSOR_LOCALS(int64_t, ne,  dst, ne)
+    GGML_TENSOR_LOCALS(size_t,  nb,  dst, nb)
+
+    const int ith = params->ith;
+    const int nth = params->nth;
+
+    const int64_t DK = nek0;
+    const int64_t DV = nev0;
+    const int64_t N  = neq1;
+
+    GGML_ASSERT(ne0 == DV);
+    GGML_ASSERT(ne2 == N);
+
+    // input tensor rows must be contiguous
+    GGML_ASSERT(nbq0 == ggml_type_size(q->type));
+    GGML_ASSERT(nbk0 == ggml_type_size(k->type));
+    GGML_ASSERT(nbv0 == ggml_type_size(v->type));
+
+    GGML_ASSERT(neq0 == DK);
+    GGML_ASSERT(nek0 == DK);
+    GGML_ASSERT(nev0 == DV);
+
+    GGML_ASSERT(neq1 == N);
+
+    // dst cannot be transposed or permuted
+    GGML_ASSERT(nb0 == sizeof(float));
+    GGML_ASSERT(nb0 <= nb1);
+    GGML_ASSERT(nb1 <= nb2);
+    GGML_ASSERT(nb2 <= nb3);
+
+    const int64_t ng = ggml_flash_attn_ext_group_size(dst);
+
+    // total rows and head groups in q
+    const int64_t nr = neq1*neq2*neq3;
+    const int64_t nu = nr/ng;
+
+    // output records of this thread, after its temporaries
+    const int64_t n_record = DV + 2;
+    float * records = (float *) params->wdata + ith*(ggml_flash_attn_ext_thread_floats(dst) + CACHE_LINE_SIZE_F32) + ng*DK + ng*DV;
+
+    const int64_t n_chunks = ggml_flash_attn_ext_n_kv_chunks(dst, nth);
+
+    if (n_chunks == 1) {
+        // parallelize by head groups
+        const int64_t du  = (nu + nth - 1)/nth;
+        const int64_t iu0 = du*ith;
+        const int64_t iu1 = MIN(iu0 + du, nu);
+
+        for (int64_t iu = iu0; iu < iu1; ++iu) {
+            ggml_compute_forward_flash_attn_ext_f16_one_chunk(params, q, k, v, mask, dst, ng, iu, 0, nek1, records, n_record);
+
+            for (int64_t j = 0; j < ng; ++j) {
+                float * VKQ32 = records + j*n_record;
+
+                // V /= S
+                const float S_inv = 1.0f/VKQ32[DV + 1];
+                ggml_vec_scale_f32(DV, VKQ32, S_inv);
+
+                memcpy(ggml_flash_attn_ext_dst_row(q, dst, ggml_flash_attn_ext_row(q, ng, iu, j)), VKQ32, nb1);
             }
         }
+        return;
+    }
 
-        // V /= S
-        const float S_inv = 1.0f/S;
-        ggml_vec_scale_f32(DV, VKQ32, S_inv);
+    GGML_ASSERT(n_chunks == nth);
 
-        // dst indices
-        const int i1 = iq1;
-        const int i2 = iq2;
-        const int i3 = iq3;
+    // record of KV slice c for row r (rows in group order) at partials + (r*nth + c)*n_record
+    float * partials = (float *) params->wdata + nth*(ggml_flash_attn_ext_thread_floats(dst) + CACHE_LINE_SIZE_F32);
+
+    // KV slice of this thread
+    const int64_t dc  = (nek1 + nth - 1)/nth;
+    const int64_t ic0 = MIN(dc*ith, nek1);
+    const int64_t ic1 = MIN(ic0 + dc, nek1);
+
+    for (int64_t iu = 0; iu < nu; ++iu) {
+        ggml_compute_forward_flash_attn_ext_f16_one_chunk(params, q, k, v, mask, dst, ng, iu, ic0, ic1,
+                partials + (iu*ng*nth + ith)*n_record, nth*n_record);
+    }
+
+    ggml_barrier(params->threadpool);
+
+    // merge the partials of the rows of this thread
+    const int64_t dr  = (nr + nth - 1)/nth;
+    const int64_t ir0 = dr*ith;
+    const int64_t ir1 = MIN(ir0 + dr, nr);
 
-        // original
-        //memcpy((char *) dst->data + (i1*nb1 + i2*nb2 + i3*nb3), V, nev0*sizeof(float));
+    for (int64_t r = ir0; r < ir1; ++r) {
+        const float * row = partials + r*nth*n_record;
 
-        // permute(0, 2, 1, 3)
-        memcpy((char *) dst->data + (i3*ne2*ne1 + i2 + i1*ne1)*nb1, VKQ32, nb1);
+        float M = -INFINITY;
+        for (int64_t c = 0; c < nth; ++c) {
+            M = MAX(M, row[c*n_record + DV]);
+        }
+
+        float * out = ggml_flash_attn_ext_dst_row(q, dst, ggml_flash_attn_ext_row(q, ng, r/ng, r%ng));
+        memset(out, 0, DV*sizeof(float));
+
+        float S = 0.0f;
+        for (int64_t c = 0; c < nth; ++c) {
+            const float * partial = row + c*n_record;
+            if (partial[DV + 1] == 0.0f) {
+                continue; // every cell of the slice is masked
+            }
+
+            const float ms = expf(partial[DV] - M);
+            ggml_vec_mad_f32(DV, out, partial, ms);
+            S += partial[DV + 1]*ms;
+        }
+
+        // V /= S
+        const float S_inv = 1.0f/S;
+        ggml_vec_scale_f32(DV, out, S_inv);
     }
 }
 
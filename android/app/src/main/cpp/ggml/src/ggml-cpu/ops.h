@@ -39,6 +39,8 @@ void ggml_compute_forward_concat(const struct ggml_compute_params * params, stru
 void ggml_compute_forward_silu_back(const struct ggml_compute_params * params, struct ggml_tensor * dst);
 void ggml_compute_forward_norm(const struct ggml_compute_params * params, struct ggml_tensor * dst);
 void ggml_compute_forward_rms_norm(const struct ggml_compute_params * params, struct ggml_tensor * dst);
+// rms_norm node norm and the mul node dst = norm*weight row after it, in one pass
+void ggml_compute_forward_rms_norm_mul(const struct ggml_compute_params * params, struct ggml_tensor * norm, struct ggml_tensor * dst);
 void ggml_compute_forward_rms_norm_back(const struct ggml_compute_params * params, struct ggml_tensor * dst);
 void ggml_compute_forward_group_norm(const struct ggml_compute_params * params, struct ggml_tensor * dst);
 void ggml_compute_forward_l2_norm(const struct ggml_compute_params * params, struct ggml_tensor * dst);
@@ -83,6 +85,8 @@ void ggml_compute_forward_flash_attn_ext(
     const struct ggml_tensor * v,
     const struct ggml_tensor * mask,
     struct ggml_tensor * dst);
+// Work buffer of flash attention with n_threads, without the CACHE_LINE_SIZE per thread
+size_t ggml_flash_attn_ext_work_size(const struct ggml_tensor * dst, int n_threads);
 void ggml_compute_forward_flash_attn_back(
         const struct ggml_compute_params * params,
         const bool masked,
@@ -1,4 +1,5 @@
 #include "unary-ops.h"
+#include "vec.h"
 
 static inline float op_abs(float x) {
     return fabsf(x);
@@ -87,6 +88,16 @@ static void apply_unary_op(const ggml_compute_params * params, ggml_tensor * dst
 
     const auto [ir0, ir1] = get_thread_range(params, src0);
 
+    // f32 rows of the transcendental functions go through the vector kernels
+    void (*vec_op)(const int, float *, const float *) = nullptr;
+    if (src0->type == GGML_TYPE_F32 && dst->type == GGML_TYPE_F32) {
+        if (op == op_tanh) {
+            vec_op = ggml_vec_tanh_f32;
+        } else if (op == op_exp) {
+            vec_op = ggml_vec_exp_f32;
+        }
+    }
+
     for (int64_t ir = ir0; ir < ir1; ++ir) {
         const int64_t i03 = ir/(ne02*ne01);
         const int64_t i02 = (ir - i03*ne02*ne01)/ne01;
@@ -95,7 +106,11 @@ static void apply_unary_op(const ggml_compute_params * params, ggml_tensor * dst
         dst_t        * dst_ptr  = (dst_t  *)       ((char *)       dst->data  + i03*nb3  + i02*nb2  + i01*nb1 );
         const src0_t * src0_ptr = (const src0_t *) ((const char *) src0->data + i03*nb03 + i02*nb02 + i01*nb01);
 
-        vec_unary_op<op>(ne0, dst_ptr, src0_ptr);
+        if (vec_op) {
+            vec_op(ne0, (float *) dst_ptr, (const float *) src0_ptr);
+        } else {
+            vec_unary_op<op>(ne0, dst_ptr, src0_ptr);
+        }
     }
 }
 
@@ -1,5 +1,6 @@
 #include "vec.h"
 
+#include <atomic>
 #include <cassert>
 
 // precomputed gelu table for f16 (128 KB)
@@ -8,6 +9,19 @@ ggml_fp16_t ggml_table_gelu_f16[1 << 16];
 // precomputed quick gelu table for f16 (128 KB)
 ggml_fp16_t ggml_table_gelu_quick_f16[1 << 16];
 
+// kernels selected for the transcendental functions, may be changed while other threads compute
+static std::atomic<ggml_cpu_math_tier> ggml_vec_math_tier[GGML_CPU_MATH_COUNT];
+
+void ggml_cpu_set_math_tier(enum ggml_cpu_math_func func, enum ggml_cpu_math_tier tier) {
+    GGML_ASSERT(func >= 0 && func < GGML_CPU_MATH_COUNT);
+    ggml_vec_math_tier[func].store(tier, std::memory_order_relaxed);
+}
+
+enum ggml_cpu_math_tier ggml_cpu_get_math_tier(enum ggml_cpu_math_func func) {
+    GGML_ASSERT(func >= 0 && func < GGML_CPU_MATH_COUNT);
+    return ggml_vec_math_tier[func].load(std::memory_order_relaxed);
+}
+
 void ggml_vec_dot_f32(int n, float * GGML_RESTRICT s, size_t bs, const float * GGML_RESTRICT x, size_t bx, const float * GGML_RESTRICT y, size_t by, int nrc) {
    assert(nrc == 1);
    GGML_UNUSED(nrc);
@@ -231,74 +245,195 @@ void ggml_vec_dot_f16(int n, float * GGML_RESTRICT s, size_t bs, ggml_fp16_t * G
 }
 
 void ggml_vec_silu_f32(const int n, float * y, const float * x) {
+    const enum ggml_cpu_math_tier tier = ggml_vec_math_tier[GGML_CPU_MATH_SILU].load(std::memory_order_relaxed);
+    const bool fast = tier == GGML_CPU_MATH_TIER_FAST;
     int i = 0;
+    if (tier != GGML_CPU_MATH_TIER_REF) {
 #if defined(__AVX512F__) && defined(__AVX512DQ__)
-    for (; i + 15 < n; i += 16) {
-        _mm512_storeu_ps(y + i, ggml_v_silu(_mm512_loadu_ps(x + i)));
-    }
+        for (; i + 15 < n; i += 16) {
+            _mm512_storeu_ps(y + i, ggml_v_silu(_mm512_loadu_ps(x + i), fast));
+        }
 #elif defined(__AVX2__) && defined(__FMA__)
-    for (; i + 7 < n; i += 8) {
-        _mm256_storeu_ps(y + i, ggml_v_silu(_mm256_loadu_ps(x + i)));
+        for (; i + 7 < n; i += 8) {
+            _mm256_storeu_ps(y + i, ggml_v_silu(_mm256_loadu_ps(x + i), fast));
+        }
+#elif defined(__SSE2__)
+        for (; i + 3 < n; i += 4) {
+            _mm_storeu_ps(y + i, ggml_v_silu(_mm_loadu_ps(x + i), fast));
+        }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+        for (; i + 3 < n; i += 4) {
+            vst1q_f32(y + i, ggml_v_silu(vld1q_f32(x + i), fast));
+        }
+#else
+        GGML_UNUSED(fast);
+#endif
     }
+    for (; i < n; ++i) {
+        y[i] = ggml_silu_f32(x[i]);
+    }
+}
+
+void ggml_vec_gelu_f32(const int n, float * y, const float * x) {
+    const enum ggml_cpu_math_tier tier = ggml_vec_math_tier[GGML_CPU_MATH_GELU].load(std::memory_order_relaxed);
+    const bool fast = tier == GGML_CPU_MATH_TIER_FAST;
+    int i = 0;
+    if (tier != GGML_CPU_MATH_TIER_REF) {
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+        for (; i + 15 < n; i += 16) {
+            _mm512_storeu_ps(y + i, ggml_v_gelu(_mm512_loadu_ps(x + i), fast));
+        }
+#elif defined(__AVX2__) && defined(__FMA__)
+        for (; i + 7 < n; i += 8) {
+            _mm256_storeu_ps(y + i, ggml_v_gelu(_mm256_loadu_ps(x + i), fast));
+        }
 #elif defined(__SSE2__)
-    for (; i + 3 < n; i += 4) {
-        _mm_storeu_ps(y + i, ggml_v_silu(_mm_loadu_ps(x + i)));
+        for (; i + 3 < n; i += 4) {
+            _mm_storeu_ps(y + i, ggml_v_gelu(_mm_loadu_ps(x + i), fast));
+        }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+        for (; i + 3 < n; i += 4) {
+            vst1q_f32(y + i, ggml_v_gelu(vld1q_f32(x + i), fast));
+        }
+#elif defined(GGML_GELU_FP16)
+        // no vector kernel, look the rows up in the f16 table
+        GGML_UNUSED(fast);
+        uint16_t t;
+        for (; i < n; ++i) {
+            if (x[i] <= -10.0f) {
+                y[i] = 0.0f;
+            } else if (x[i] >= 10.0f) {
+                y[i] = x[i];
+            } else {
+                ggml_fp16_t fp16 = GGML_FP32_TO_FP16(x[i]);
+                memcpy(&t, &fp16, sizeof(uint16_t));
+                y[i] = GGML_FP16_TO_FP32(ggml_table_gelu_f16[t]);
+            }
+        }
+#else
+        GGML_UNUSED(fast);
+#endif
     }
+    for (; i < n; ++i) {
+        y[i] = ggml_gelu_f32(x[i]);
+    }
+}
+
+void ggml_vec_tanh_f32(const int n, float * y, const float * x) {
+    const enum ggml_cpu_math_tier tier = ggml_vec_math_tier[GGML_CPU_MATH_TANH].load(std::memory_order_relaxed);
+    const bool fast = tier == GGML_CPU_MATH_TIER_FAST;
+    int i = 0;
+    if (tier != GGML_CPU_MATH_TIER_REF) {
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+        for (; i + 15 < n; i += 16) {
+            _mm512_storeu_ps(y + i, ggml_v_tanh(_mm512_loadu_ps(x + i), fast));
+        }
+#elif defined(__AVX2__) && defined(__FMA__)
+        for (; i + 7 < n; i += 8) {
+            _mm256_storeu_ps(y + i, ggml_v_tanh(_mm256_loadu_ps(x + i), fast));
+        }
+#elif defined(__SSE2__)
+        for (; i + 3 < n; i += 4) {
+            _mm_storeu_ps(y + i, ggml_v_tanh(_mm_loadu_ps(x + i), fast));
+        }
 #elif defined(__ARM_NEON) && defined(__aarch64__)
-    for (; i + 3 < n; i += 4) {
-        vst1q_f32(y + i, ggml_v_silu(vld1q_f32(x + i)));
+        for (; i + 3 < n; i += 4) {
+            vst1q_f32(y + i, ggml_v_tanh(vld1q_f32(x + i), fast));
+        }
+#else
+        GGML_UNUSED(fast);
+#endif
     }
+    for (; i < n; ++i) {
+        y[i] = tanhf(x[i]);
+    }
+}
+
+void ggml_vec_exp_f32(const int n, float * y, const float * x) {
+    const enum ggml_cpu_math_tier tier = ggml_vec_math_tier[GGML_CPU_MATH_EXP].load(std::memory_order_relaxed);
+    const bool fast = tier == GGML_CPU_MATH_TIER_FAST;
+    int i = 0;
+    if (tier != GGML_CPU_MATH_TIER_REF) {
+#if defined(__AVX512F__) && defined(__AVX512DQ__)
+        for (; i + 15 < n; i += 16) {
+            const __m512 v = _mm512_loadu_ps(x + i);
+            _mm512_storeu_ps(y + i, fast ? ggml_v_expf_fast(v) : ggml_v_expf(v));
+        }
+#elif defined(__AVX2__) && defined(__FMA__)
+        for (; i + 7 < n; i += 8) {
+            const __m256 v = _mm256_loadu_ps(x + i);
+            _mm256_storeu_ps(y + i, fast ? ggml_v_expf_fast(v) : ggml_v_expf(v));
+        }
+#elif defined(__SSE2__)
+        for (; i + 3 < n; i += 4) {
+            const __m128 v = _mm_loadu_ps(x + i);
+            _mm_storeu_ps(y + i, fast ? ggml_v_expf_fast(v) : ggml_v_expf(v));
+        }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+        for (; i + 3 < n; i += 4) {
+            const float32x4_t v = vld1q_f32(x + i);
+            vst1q_f32(y + i, fast ? ggml_v_expf_fast(v) : ggml_v_expf(v));
+        }
+#else
+        GGML_UNUSED(fast);
 #endif
+    }
     for (; i < n; ++i) {
-        y[i] = ggml_silu_f32(x[i]);
+        y[i] = expf(x[i]);
     }
 }
 
 ggml_float ggml_vec_soft_max_f32(const int n, float * y, const float * x, float max) {
+    const enum ggml_cpu_math_tier tier = ggml_vec_math_tier[GGML_CPU_MATH_EXP].load(std::memory_order_relaxed);
+    const bool fast = tier == GGML_CPU_MATH_TIER_FAST;
     int i = 0;
     ggml_float sum = 0;
+    if (tier != GGML_CPU_MATH_TIER_REF) {
 #if defined(__AVX512F__) && defined(__AVX512DQ__)
-    for (; i + 15 < n; i += 16) {
-        __m512 val = ggml_v_expf(_mm512_sub_ps(_mm512_loadu_ps(x + i),
-                                               _mm512_set1_ps(max)));
-        _mm512_storeu_ps(y + i, val);
-        sum += (ggml_float)_mm512_reduce_add_ps(val);
-    }
+        for (; i + 15 < n; i += 16) {
+            const __m512 v = _mm512_sub_ps(_mm512_loadu_ps(x + i), _mm512_set1_ps(max));
+            __m512 val = fast ? ggml_v_expf_fast(v) : ggml_v_expf(v);
+            _mm512_storeu_ps(y + i, val);
+            sum += (ggml_float)_mm512_reduce_add_ps(val);
+        }
 #elif defined(__AVX2__) && defined(__FMA__)
-    for (; i + 7 < n; i += 8) {
-        __m256 val = ggml_v_expf(_mm256_sub_ps(_mm256_loadu_ps(x + i),
-                                               _mm256_set1_ps(max)));
-        _mm256_storeu_ps(y + i, val);
-        __m128 val2 = _mm_add_ps(_mm256_extractf128_ps(val, 1),
-                                 _mm256_castps256_ps128(val));
-        val2 = _mm_add_ps(val2, _mm_movehl_ps(val2, val2));
-        val2 = _mm_add_ss(val2, _mm_movehdup_ps(val2));
-        sum += (ggml_float)_mm_cvtss_f32(val2);
-    }
+        for (; i + 7 < n; i += 8) {
+            const __m256 v = _mm256_sub_ps(_mm256_loadu_ps(x + i), _mm256_set1_ps(max));
+            __m256 val = fast ? ggml_v_expf_fast(v) : ggml_v_expf(v);
+            _mm256_storeu_ps(y + i, val);
+            __m128 val2 = _mm_add_ps(_mm256_extractf128_ps(val, 1),
+                                     _mm256_castps256_ps128(val));
+            val2 = _mm_add_ps(val2, _mm_movehl_ps(val2, val2));
+            val2 = _mm_add_ss(val2, _mm_movehdup_ps(val2));
+            sum += (ggml_float)_mm_cvtss_f32(val2);
+        }
 #elif defined(__SSE2__)
-    for (; i + 3 < n; i += 4) {
-        __m128 val = ggml_v_expf(_mm_sub_ps(_mm_loadu_ps(x + i),
-                                            _mm_set1_ps(max)));
-        _mm_storeu_ps(y + i, val);
+        for (; i + 3 < n; i += 4) {
+            const __m128 v = _mm_sub_ps(_mm_loadu_ps(x + i), _mm_set1_ps(max));
+            __m128 val = fast ? ggml_v_expf_fast(v) : ggml_v_expf(v);
+            _mm_storeu_ps(y + i, val);
 #if defined(__AVX__) || defined(__AVX2__) || defined(__AVX512F__)
-        val = _mm_add_ps(val, _mm_movehl_ps(val, val));
-        val = _mm_add_ss(val, _mm_movehdup_ps(val));
+            val = _mm_add_ps(val, _mm_movehl_ps(val, val));
+            val = _mm_add_ss(val, _mm_movehdup_ps(val));
 #else
-        __m128 tmp = _mm_shuffle_ps(val, val, _MM_SHUFFLE(2, 3, 0, 1));
-        val = _mm_add_ps(val, tmp);
-        tmp = _mm_movehl_ps(tmp, val);
-        val = _mm_add_ss(val, tmp);
+            __m128 tmp = _mm_shuffle_ps(val, val, _MM_SHUFFLE(2, 3, 0, 1));
+            val = _mm_add_ps(val, tmp);
+            tmp = _mm_movehl_ps(tmp, val);
+            val = _mm_add_ss(val, tmp);
 #endif
-        sum += (ggml_float)_mm_cvtss_f32(val);
-    }
+            sum += (ggml_float)_mm_cvtss_f32(val);
+        }
 #elif defined(__ARM_NEON) && defined(__aarch64__)
-    for (; i + 3 < n; i += 4) {
-        float32x4_t val = ggml_v_expf(vsubq_f32(vld1q_f32(x + i),
-                                                vdupq_n_f32(max)));
-        vst1q_f32(y + i, val);
-        sum += (ggml_float)vaddvq_f32(val);
-    }
+        for (; i + 3 < n; i += 4) {
+            const float32x4_t v = vsubq_f32(vld1q_f32(x + i), vdupq_n_f32(max));
+            float32x4_t val = fast ? ggml_v_expf_fast(v) : ggml_v_expf(v);
+            vst1q_f32(y + i, val);
+            sum += (ggml_float)vaddvq_f32(val);
+        }
+#else
+        GGML_UNUSED(fast);
 #endif
+    }
     for (; i < n; ++i) {
         float val = expf(x[i] - max);
         sum += (ggml_float)val;
@@ -44,6 +44,9 @@ void ggml_vec_dot_bf16(int n, float * GGML_RESTRICT s, size_t bs, ggml_bf16_t *
 void ggml_vec_dot_f16(int n, float * GGML_RESTRICT s, size_t bs, ggml_fp16_t * GGML_RESTRICT x, size_t bx, ggml_fp16_t * GGML_RESTRICT y, size_t by, int nrc);
 
 void ggml_vec_silu_f32(const int n, float * y, const float * x);
+void ggml_vec_gelu_f32(const int n, float * y, const float * x);
+void ggml_vec_tanh_f32(const int n, float * y, const float * x);
+void ggml_vec_exp_f32 (const int n, float * y, const float * x);
 ggml_float ggml_vec_soft_max_f32(const int n, float * y, const float * x, float max);
 ggml_float ggml_vec_log_soft_max_f32(const int n, float * y, const float * x, float max);
 
@@ -440,6 +443,92 @@ inline static void ggml_vec_scale_f16(const int n, ggml_fp16_t * y, const float
 #endif
 }
 
+// y = x*w*v, y may be x
+inline static void ggml_vec_mul_scale_f32(const int n, float * y, const float * x, const float * w, const float v) {
+#if defined(GGML_SIMD) && !defined(__ARM_FEATURE_SVE)
+    const int np = (n & ~(GGML_F32_STEP - 1));
+
+    GGML_F32_VEC vv = GGML_F32_VEC_SET1(v);
+
+    GGML_F32_VEC ax[GGML_F32_ARR];
+    GGML_F32_VEC aw[GGML_F32_ARR];
+
+    for (int i = 0; i < np; i += GGML_F32_STEP) {
+        for (int j = 0; j < GGML_F32_ARR; j++) {
+            ax[j] = GGML_F32_VEC_LOAD(x + i + j*GGML_F32_EPR);
+            aw[j] = GGML_F32_VEC_LOAD(w + i + j*GGML_F32_EPR);
+            ax[j] = GGML_F32_VEC_MUL(GGML_F32_VEC_MUL(ax[j], aw[j]), vv);
+
+            GGML_F32_VEC_STORE(y + i + j*GGML_F32_EPR, ax[j]);
+        }
+    }
+
+    // leftovers
+    for (int i = np; i < n; ++i) {
+        y[i] = x[i]*w[i]*v;
+    }
+#else
+    // scalar
+    for (int i = 0; i < n; ++i) {
+        y[i] = x[i]*w[i]*v;
+    }
+#endif
+}
+
+// rotates the n pairs (x0[i], x1[i]) by the angles with cosine c[i] and sine s[i]
+// y0 and y1 may be x0 and x1 (in-place)
+inline static void ggml_vec_rope_neox_f32(const int n, float * y0, float * y1, const float * x0, const float * x1, const float * c, const float * s) {
+#if defined(GGML_SIMD) && !defined(__ARM_FEATURE_SVE)
+    const int np = (n & ~(GGML_F32_EPR - 1));
+
+    GGML_F32_VEC neg = GGML_F32_VEC_SET1(-1.0f);
+
+    for (int i = 0; i < np; i += GGML_F32_EPR) {
+        GGML_F32_VEC a  = GGML_F32_VEC_LOAD(x0 + i);
+        GGML_F32_VEC b  = GGML_F32_VEC_LOAD(x1 + i);
+        GGML_F32_VEC vc = GGML_F32_VEC_LOAD(c  + i);
+        GGML_F32_VEC vs = GGML_F32_VEC_LOAD(s  + i);
+
+        // y0 = a*c - b*s, y1 = a*s + b*c
+        GGML_F32_VEC r0 = GGML_F32_VEC_FMA(GGML_F32_VEC_MUL(a, vc), b, GGML_F32_VEC_MUL(vs, neg));
+        GGML_F32_VEC r1 = GGML_F32_VEC_FMA(GGML_F32_VEC_MUL(a, vs), b, vc);
+
+        GGML_F32_VEC_STORE(y0 + i, r0);
+        GGML_F32_VEC_STORE(y1 + i, r1);
+    }
+
+    // leftovers
+    for (int i = np; i < n; ++i) {
+        const float a = x0[i];
+        const float b = x1[i];
+
+        y0[i] = a*c[i] - b*s[i];
+        y1[i] = a*s[i] + b*c[i];
+    }
+#else
+    // scalar
+    for (int i = 0; i < n; ++i) {
+        const float a = x0[i];
+        const float b = x1[i];
+
+        y0[i] = a*c[i] - b*s[i];
+        y1[i] = a*s[i] + b*c[i];
+    }
+#endif
+}
+
+// rotates the n pairs (x[2*i], x[2*i + 1]), y may be x
+// compilers vectorize the loop with de-interleaving loads (ld2/st2 on arm64)
+inline static void ggml_vec_rope_norm_f32(const int n, float * y, const float * x, const float * c, const float * s) {
+    for (int i = 0; i < n; ++i) {
+        const float a = x[2*i + 0];
+        const float b = x[2*i + 1];
+
+        y[2*i + 0] = a*c[i] - b*s[i];
+        y[2*i + 1] = a*s[i] + b*c[i];
+    }
+}
+
 inline static void ggml_vec_norm_f32 (const int n, float * s, const float * x) { ggml_vec_dot_f32(n, s, 0, x, 0, x, 0, 1); *s = sqrtf(*s);   }
 inline static void ggml_vec_sqr_f32  (const int n, float * y, const float * x) { for (int i = 0; i < n; ++i) y[i] = x[i]*x[i];   }
 inline static void ggml_vec_sqr_f16 (const int n, ggml_fp16_t * y, const ggml_fp16_t * x) {
@@ -491,7 +580,6 @@ inline static void ggml_vec_step_f16 (const int n, ggml_fp16_t * y, const ggml_f
         y[i] = GGML_FP32_TO_FP16((GGML_FP16_TO_FP32(x[i]) > 0.f) ? 1.f : 0.f);
     }
 }
-inline static void ggml_vec_tanh_f32 (const int n, float * y, const float * x) { for (int i = 0; i < n; ++i) y[i] = tanhf(x[i]);  }
 inline static void ggml_vec_tanh_f16 (const int n, ggml_fp16_t * y, const ggml_fp16_t * x) {
     for (int i = 0; i < n; ++i) {
         y[i] = GGML_FP32_TO_FP16(tanhf(GGML_FP16_TO_FP32(x[i])));
@@ -537,7 +625,6 @@ inline static void ggml_vec_hardsigmoid_f16 (const int n, ggml_fp16_t * y, const
         y[i] = GGML_FP32_TO_FP16(fminf(1.0f, fmaxf(0.0f, (GGML_FP16_TO_FP32(x[i]) + 3.0f) / 6.0f)));
     }
 }
-inline static void ggml_vec_exp_f32 (const int n, float * y, const float * x) { for (int i = 0; i < n; ++i) y[i] = expf(x[i]); }
 inline static void ggml_vec_exp_f16 (const int n, ggml_fp16_t * y, const ggml_fp16_t * x) {
     for (int i = 0; i < n; ++i) {
         y[i] = GGML_FP32_TO_FP16(expf(GGML_FP16_TO_FP32(x[i])));
@@ -568,29 +655,6 @@ inline static void ggml_vec_gelu_erf_f16(const int n, ggml_fp16_t * y, const ggm
     }
 }
 
-#ifdef GGML_GELU_FP16
-inline static void ggml_vec_gelu_f32(const int n, float * y, const float * x) {
-    uint16_t t;
-    for (int i = 0; i < n; ++i) {
-        if (x[i] <= -10.0f) {
-            y[i] = 0.0f;
-        } else if (x[i] >= 10.0f) {
-            y[i] = x[i];
-        } else {
-            ggml_fp16_t fp16 = GGML_FP32_TO_FP16(x[i]);
-            memcpy(&t, &fp16, sizeof(uint16_t));
-            y[i] = GGML_FP16_TO_FP32(ggml_table_gelu_f16[t]);
-        }
-    }
-}
-#else
-inline static void ggml_vec_gelu_f32(const int n, float * y, const float * x) {
-    for (int i = 0; i < n; ++i) {
-        y[i] = ggml_gelu_f32(x[i]);
-    }
-}
-#endif
-
 inline static void ggml_vec_gelu_erf_f32(const int n, float * y, const float * x) {
     for (int i = 0; i < n; ++i) {
         float xi = x[i];
@@ -712,16 +776,61 @@ inline static float32x4_t ggml_v_expf(float32x4_t x) {
                      vbslq_f32(c, vmulq_f32(vfmaq_f32(s2, s2, j), s1), vfmaq_f32(k, k, j)));
 }
 
+// same range reduction as ggml_v_expf with a cubic polynomial
+// the maximum relative error is 7.5e-5
+// numbers above 88.37 saturate at 2^127
+// numbers beneath -87.33 flush to zero
+inline static float32x4_t ggml_v_expf_fast(float32x4_t x) {
+    const float32x4_t r = vdupq_n_f32(0x1.8p23f);
+    const float32x4_t v = vminq_f32(vdupq_n_f32(88.37f), vmaxq_f32(vdupq_n_f32(-87.33f), x));
+    const float32x4_t z = vfmaq_f32(r, v, vdupq_n_f32(0x1.715476p+0f));
+    const float32x4_t n = vsubq_f32(z, r);
+    const float32x4_t b = vfmsq_f32(v, n, vdupq_n_f32(0x1.62e43p-1f));
+    const uint32x4_t e = vshlq_n_u32(vreinterpretq_u32_f32(z), 23);
+    const float32x4_t k = vreinterpretq_f32_u32(vaddq_u32(e, vreinterpretq_u32_f32(vdupq_n_f32(1))));
+    const float32x4_t j = vfmaq_f32(vdupq_n_f32(0x1.fff692p-1f), b,
+                          vfmaq_f32(vdupq_n_f32(0x1.000ac2p+0f), b,
+                          vfmaq_f32(vdupq_n_f32(0x1.028a8cp-1f), b, vdupq_n_f32(0x1.5349f8p-3f))));
+    return vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(vmulq_f32(j, k)),
+                                           vcltq_f32(x, vdupq_n_f32(-87.33f))));
+}
+
 // computes silu x/(1+exp(-x)) in single precision vector
-inline static float32x4_t ggml_v_silu(float32x4_t x) {
+inline static float32x4_t ggml_v_silu(float32x4_t x, bool fast) {
     const float32x4_t one = vdupq_n_f32(1.0f);
     const float32x4_t zero = vdupq_n_f32(0.0f);
     const float32x4_t neg_x = vsubq_f32(zero, x);
-    const float32x4_t exp_neg_x = ggml_v_expf(neg_x);
+    const float32x4_t exp_neg_x = fast ? ggml_v_expf_fast(neg_x) : ggml_v_expf(neg_x);
     const float32x4_t one_plus_exp_neg_x = vaddq_f32(one, exp_neg_x);
     return vdivq_f32(x, one_plus_exp_neg_x);
 }
 
+// computes gelu 0.5*x*(1+tanh(u)) as x/(1+exp(-2u)) in single precision vector
+inline static float32x4_t ggml_v_gelu(float32x4_t x, bool fast) {
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t u = vmulq_f32(vmulq_f32(x, vdupq_n_f32(-2.0f*SQRT_2_OVER_PI)),
+                                    vfmaq_f32(one, vmulq_f32(x, x), vdupq_n_f32(GELU_COEF_A)));
+    const float32x4_t exp_u = fast ? ggml_v_expf_fast(u) : ggml_v_expf(u);
+    return vdivq_f32(x, vaddq_f32(one, exp_u));
+}
+
+// computes tanh in single precision vector, with an odd polynomial below 0.5
+// and (1-exp(-2|x|))/(1+exp(-2|x|)) above
+inline static float32x4_t ggml_v_tanh(float32x4_t x, bool fast) {
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t ax = vabsq_f32(x);
+    const float32x4_t neg_2ax = vmulq_f32(ax, vdupq_n_f32(-2.0f));
+    const float32x4_t e = fast ? ggml_v_expf_fast(neg_2ax) : ggml_v_expf(neg_2ax);
+    const float32x4_t big = vdivq_f32(vsubq_f32(one, e), vaddq_f32(one, e));
+    const float32x4_t s = vmulq_f32(ax, ax);
+    const float32x4_t p = vfmaq_f32(vdupq_n_f32(-0x1.5554e4p-2f), s,
+                          vfmaq_f32(vdupq_n_f32(0x1.10e994p-3f), s,
+                          vfmaq_f32(vdupq_n_f32(-0x1.b24cb0p-5f), s, vdupq_n_f32(0x1.18d7e8p-6f))));
+    const float32x4_t small = vfmaq_f32(ax, vmulq_f32(ax, s), p);
+    const float32x4_t t = vbslq_f32(vcltq_f32(ax, vdupq_n_f32(0.5f)), small, big);
+    return vbslq_f32(vdupq_n_u32(0x80000000u), x, t);
+}
+
 #elif defined(__AVX512F__) && defined(__AVX512DQ__)
 
 // adapted from arm limited optimized routine
@@ -755,16 +864,66 @@ inline static __m512 ggml_v_expf(__m512 x) {
   return _mm512_mask_blend_ps(d, res, alt);
 }
 
+// same range reduction as ggml_v_expf with a cubic polynomial
+// the maximum relative error is 7.5e-5
+// numbers above 88.37 saturate at 2^127
+// numbers beneath -87.33 flush to zero
+inline static __m512 ggml_v_expf_fast(__m512 x) {
+  const __m512 r = _mm512_set1_ps(0x1.8p23f);
+  const __m512 v = _mm512_min_ps(_mm512_set1_ps(88.37f), _mm512_max_ps(_mm512_set1_ps(-87.33f), x));
+  const __m512 z = _mm512_fmadd_ps(v, _mm512_set1_ps(0x1.715476p+0f), r);
+  const __m512 n = _mm512_sub_ps(z, r);
+  const __m512 b = _mm512_fnmadd_ps(n, _mm512_set1_ps(0x1.62e43p-1f), v);
+  const __m512 k = _mm512_castsi512_ps(
+      _mm512_add_epi32(_mm512_slli_epi32(_mm512_castps_si512(z), 23),
+                       _mm512_castps_si512(_mm512_set1_ps(1))));
+  const __m512 j = _mm512_fmadd_ps(
+      _mm512_fmadd_ps(_mm512_fmadd_ps(_mm512_set1_ps(0x1.5349f8p-3f), b,
+                                      _mm512_set1_ps(0x1.028a8cp-1f)),
+                      b, _mm512_set1_ps(0x1.000ac2p+0f)),
+      b, _mm512_set1_ps(0x1.fff692p-1f));
+  return _mm512_maskz_mov_ps(_mm512_cmp_ps_mask(x, _mm512_set1_ps(-87.33f), _CMP_NLT_UQ),
+                             _mm512_mul_ps(j, k));
+}
+
 // computes silu x/(1+exp(-x)) in single precision vector
-inline static __m512 ggml_v_silu(__m512 x) {
+inline static __m512 ggml_v_silu(__m512 x, bool fast) {
     const __m512 one = _mm512_set1_ps(1);
     const __m512 zero = _mm512_setzero_ps();
     const __m512 neg_x = _mm512_sub_ps(zero, x);
-    const __m512 exp_neg_x = ggml_v_expf(neg_x);
+    const __m512 exp_neg_x = fast ? ggml_v_expf_fast(neg_x) : ggml_v_expf(neg_x);
     const __m512 one_plus_exp_neg_x = _mm512_add_ps(one, exp_neg_x);
     return _mm512_div_ps(x, one_plus_exp_neg_x);
 }
 
+// computes gelu 0.5*x*(1+tanh(u)) as x/(1+exp(-2u)) in single precision vector
+inline static __m512 ggml_v_gelu(__m512 x, bool fast) {
+    const __m512 one = _mm512_set1_ps(1);
+    const __m512 u = _mm512_mul_ps(_mm512_mul_ps(x, _mm512_set1_ps(-2.0f*SQRT_2_OVER_PI)),
+                                   _mm512_fmadd_ps(_mm512_mul_ps(x, x), _mm512_set1_ps(GELU_COEF_A), one));
+    const __m512 exp_u = fast ? ggml_v_expf_fast(u) : ggml_v_expf(u);
+    return _mm512_div_ps(x, _mm512_add_ps(one, exp_u));
+}
+
+// computes tanh in single precision vector, with an odd polynomial below 0.5
+// and (1-exp(-2|x|))/(1+exp(-2|x|)) above
+inline static __m512 ggml_v_tanh(__m512 x, bool fast) {
+    const __m512 one = _mm512_set1_ps(1);
+    const __m512 ax = _mm512_abs_ps(x);
+    const __m512 neg_2ax = _mm512_mul_ps(ax, _mm512_set1_ps(-2.0f));
+    const __m512 e = fast ? ggml_v_expf_fast(neg_2ax) : ggml_v_expf(neg_2ax);
+    const __m512 big = _mm512_div_ps(_mm512_sub_ps(one, e), _mm512_add_ps(one, e));
+    const __m512 s = _mm512_mul_ps(ax, ax);
+    const __m512 p = _mm512_fmadd_ps(
+        _mm512_fmadd_ps(_mm512_fmadd_ps(_mm512_set1_ps(0x1.18d7e8p-6f), s,
+                                        _mm512_set1_ps(-0x1.b24cb0p-5f)),
+                        s, _mm512_set1_ps(0x1.10e994p-3f)),
+        s, _mm512_set1_ps(-0x1.5554e4p-2f));
+    const __m512 small = _mm512_fmadd_ps(_mm512_mul_ps(ax, s), p, ax);
+    const __m512 t = _mm512_mask_blend_ps(_mm512_cmp_ps_mask(ax, _mm512_set1_ps(0.5f), _CMP_LT_OQ), big, small);
+    return _mm512_or_ps(t, _mm512_and_ps(_mm512_set1_ps(-0.f), x));
+}
+
 #elif defined(__AVX2__) && defined(__FMA__)
 
 // adapted from arm limited optimized routine
@@ -810,16 +969,65 @@ inline static __m256 ggml_v_expf(__m256 x) {
               _mm256_andnot_ps(_mm256_castsi256_ps(c), _mm256_fmadd_ps(k, j, k)))));
 }
 
+// same range reduction as ggml_v_expf with a cubic polynomial
+// the maximum relative error is 7.5e-5
+// numbers above 88.37 saturate at 2^127
+// numbers beneath -87.33 flush to zero
+inline static __m256 ggml_v_expf_fast(__m256 x) {
+  const __m256 r = _mm256_set1_ps(0x1.8p23f);
+  const __m256 v = _mm256_min_ps(_mm256_set1_ps(88.37f), _mm256_max_ps(_mm256_set1_ps(-87.33f), x));
+  const __m256 z = _mm256_fmadd_ps(v, _mm256_set1_ps(0x1.715476p+0f), r);
+  const __m256 n = _mm256_sub_ps(z, r);
+  const __m256 b = _mm256_fnmadd_ps(n, _mm256_set1_ps(0x1.62e43p-1f), v);
+  const __m256 k = _mm256_castsi256_ps(
+      _mm256_add_epi32(_mm256_slli_epi32(_mm256_castps_si256(z), 23),
+                       _mm256_castps_si256(_mm256_set1_ps(1))));
+  const __m256 j = _mm256_fmadd_ps(_mm256_fmadd_ps(_mm256_fmadd_ps(_mm256_set1_ps(0x1.5349f8p-3f), b,
+                                                                   _mm256_set1_ps(0x1.028a8cp-1f)),
+                                                   b, _mm256_set1_ps(0x1.000ac2p+0f)),
+                                   b, _mm256_set1_ps(0x1.fff692p-1f));
+  return _mm256_andnot_ps(_mm256_cmp_ps(x, _mm256_set1_ps(-87.33f), _CMP_LT_OQ),
+                          _mm256_mul_ps(j, k));
+}
+
 // computes silu x/(1+exp(-x)) in single precision vector
-inline static __m256 ggml_v_silu(__m256 x) {
+inline static __m256 ggml_v_silu(__m256 x, bool fast) {
     const __m256 one = _mm256_set1_ps(1);
     const __m256 zero = _mm256_setzero_ps();
     const __m256 neg_x = _mm256_sub_ps(zero, x);
-    const __m256 exp_neg_x = ggml_v_expf(neg_x);
+    const __m256 exp_neg_x = fast ? ggml_v_expf_fast(neg_x) : ggml_v_expf(neg_x);
     const __m256 one_plus_exp_neg_x = _mm256_add_ps(one, exp_neg_x);
     return _mm256_div_ps(x, one_plus_exp_neg_x);
 }
 
+// computes gelu 0.5*x*(1+tanh(u)) as x/(1+exp(-2u)) in single precision vector
+inline static __m256 ggml_v_gelu(__m256 x, bool fast) {
+    const __m256 one = _mm256_set1_ps(1);
+    const __m256 u = _mm256_mul_ps(_mm256_mul_ps(x, _mm256_set1_ps(-2.0f*SQRT_2_OVER_PI)),
+                                   _mm256_fmadd_ps(_mm256_mul_ps(x, x), _mm256_set1_ps(GELU_COEF_A), one));
+    const __m256 exp_u = fast ? ggml_v_expf_fast(u) : ggml_v_expf(u);
+    return _mm256_div_ps(x, _mm256_add_ps(one, exp_u));
+}
+
+// computes tanh in single precision vector, with an odd polynomial below 0.5
+// and (1-exp(-2|x|))/(1+exp(-2|x|)) above
+inline static __m256 ggml_v_tanh(__m256 x, bool fast) {
+    const __m256 one = _mm256_set1_ps(1);
+    const __m256 sign = _mm256_set1_ps(-0.f);
+    const __m256 ax = _mm256_andnot_ps(sign, x);
+    const __m256 neg_2ax = _mm256_mul_ps(ax, _mm256_set1_ps(-2.0f));
+    const __m256 e = fast ? ggml_v_expf_fast(neg_2ax) : ggml_v_expf(neg_2ax);
+    const __m256 big = _mm256_div_ps(_mm256_sub_ps(one, e), _mm256_add_ps(one, e));
+    const __m256 s = _mm256_mul_ps(ax, ax);
+    const __m256 p = _mm256_fmadd_ps(_mm256_fmadd_ps(_mm256_fmadd_ps(_mm256_set1_ps(0x1.18d7e8p-6f), s,
+                                                                     _mm256_set1_ps(-0x1.b24cb0p-5f)),
+                                                     s, _mm256_set1_ps(0x1.10e994p-3f)),
+                                     s, _mm256_set1_ps(-0x1.5554e4p-2f));
+    const __m256 small = _mm256_fmadd_ps(_mm256_mul_ps(ax, s), p, ax);
+    const __m256 t = _mm256_blendv_ps(big, small, _mm256_cmp_ps(ax, _mm256_set1_ps(0.5f), _CMP_LT_OQ));
+    return _mm256_or_ps(t, _mm256_and_ps(sign, x));
+}
+
 #elif defined(__SSE2__) // __AVX2__ / __ARM_NEON
 
 #if defined(__FMA__)
@@ -864,16 +1072,64 @@ inline static __m128 ggml_v_expf(__m128 x) {
                                 _mm_andnot_ps(_mm_castsi128_ps(c), MADD128(k, j, k)))));
 }
 
+// same range reduction as ggml_v_expf with a cubic polynomial
+// the maximum relative error is 7.5e-5
+// numbers above 88.37 saturate at 2^127
+// numbers beneath -87.33 flush to zero
+inline static __m128 ggml_v_expf_fast(__m128 x) {
+    const __m128 r = _mm_set1_ps(0x1.8p23f);
+    const __m128 v = _mm_min_ps(_mm_set1_ps(88.37f), _mm_max_ps(_mm_set1_ps(-87.33f), x));
+    const __m128 z = MADD128(v, _mm_set1_ps(0x1.715476p+0f), r);
+    const __m128 n = _mm_sub_ps(z, r);
+    const __m128 b = NMADD128(n, _mm_set1_ps(0x1.62e43p-1f), v);
+    const __m128 k = _mm_castsi128_ps(_mm_add_epi32(_mm_slli_epi32(_mm_castps_si128(z), 23),
+                                                    _mm_castps_si128(_mm_set1_ps(1))));
+    const __m128 j =
+        MADD128(MADD128(MADD128(_mm_set1_ps(0x1.5349f8p-3f), b, _mm_set1_ps(0x1.028a8cp-1f)), b,
+                        _mm_set1_ps(0x1.000ac2p+0f)),
+                b, _mm_set1_ps(0x1.fff692p-1f));
+    return _mm_andnot_ps(_mm_cmplt_ps(x, _mm_set1_ps(-87.33f)), _mm_mul_ps(j, k));
+}
+
 // computes silu x/(1+exp(-x)) in single precision vector
-inline static __m128 ggml_v_silu(__m128 x) {
+inline static __m128 ggml_v_silu(__m128 x, bool fast) {
     const __m128 one = _mm_set1_ps(1);
     const __m128 zero = _mm_setzero_ps();
     const __m128 neg_x = _mm_sub_ps(zero, x);
-    const __m128 exp_neg_x = ggml_v_expf(neg_x);
+    const __m128 exp_neg_x = fast ? ggml_v_expf_fast(neg_x) : ggml_v_expf(neg_x);
     const __m128 one_plus_exp_neg_x = _mm_add_ps(one, exp_neg_x);
     return _mm_div_ps(x, one_plus_exp_neg_x);
 }
 
+// computes gelu 0.5*x*(1+tanh(u)) as x/(1+exp(-2u)) in single precision vector
+inline static __m128 ggml_v_gelu(__m128 x, bool fast) {
+    const __m128 one = _mm_set1_ps(1);
+    const __m128 u = _mm_mul_ps(_mm_mul_ps(x, _mm_set1_ps(-2.0f*SQRT_2_OVER_PI)),
+                                MADD128(_mm_mul_ps(x, x), _mm_set1_ps(GELU_COEF_A), one));
+    const __m128 exp_u = fast ? ggml_v_expf_fast(u) : ggml_v_expf(u);
+    return _mm_div_ps(x, _mm_add_ps(one, exp_u));
+}
+
+// computes tanh in single precision vector, with an odd polynomial below 0.5
+// and (1-exp(-2|x|))/(1+exp(-2|x|)) above
+inline static __m128 ggml_v_tanh(__m128 x, bool fast) {
+    const __m128 one = _mm_set1_ps(1);
+    const __m128 sign = _mm_set1_ps(-0.f);
+    const __m128 ax = _mm_andnot_ps(sign, x);
+    const __m128 neg_2ax = _mm_mul_ps(ax, _mm_set1_ps(-2.0f));
+    const __m128 e = fast ? ggml_v_expf_fast(neg_2ax) : ggml_v_expf(neg_2ax);
+    const __m128 big = _mm_div_ps(_mm_sub_ps(one, e), _mm_add_ps(one, e));
+    const __m128 s = _mm_mul_ps(ax, ax);
+    const __m128 p =
+        MADD128(MADD128(MADD128(_mm_set1_ps(0x1.18d7e8p-6f), s, _mm_set1_ps(-0x1.b24cb0p-5f)), s,
+                        _mm_set1_ps(0x1.10e994p-3f)),
+                s, _mm_set1_ps(-0x1.5554e4p-2f));
+    const __m128 small = MADD128(_mm_mul_ps(ax, s), p, ax);
+    const __m128 m = _mm_cmplt_ps(ax, _mm_set1_ps(0.5f));
+    const __m128 t = _mm_or_ps(_mm_and_ps(m, small), _mm_andnot_ps(m, big));
+    return _mm_or_ps(t, _mm_and_ps(sign, x));
+}
+
 #endif // __ARM_NEON / __AVX2__ / __SSE2__
 
 inline static void ggml_vec_silu_f16(const int n, ggml_fp16_t * y, const ggml_fp16_t * x) {
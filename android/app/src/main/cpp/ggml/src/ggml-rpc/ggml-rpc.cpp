@@ -3,6 +3,7 @@
 #include "ggml-backend-impl.h"
 #include "ggml-cpp.h"
 
+#include <atomic>
 #include <cinttypes>
 #include <string>
 #include <vector>
@@ -42,6 +43,11 @@ typedef int sockfd_t;
 // cross-platform socket
 struct socket_t {
     sockfd_t fd;
+
+    // client side, pipelined mode
+    uint8_t              server_minor    = 0;      // protocol minor version of the server
+    std::vector<uint8_t> pending;                  // queued commands without reply, sent with the next flush
+
     socket_t(sockfd_t fd) : fd(fd) {}
     ~socket_t() {
         GGML_PRINT_DEBUG("[%s] closing socket %d\n", __func__, this->fd);
@@ -96,12 +102,22 @@ enum rpc_cmd {
     RPC_CMD_INIT_TENSOR,
     RPC_CMD_GET_ALLOC_SIZE,
     RPC_CMD_HELLO,
+    RPC_CMD_GRAPH_COMPUTE_ASYNC,
+    RPC_CMD_SYNC,
+    RPC_CMD_SET_TENSOR_WIRE,
+    RPC_CMD_GET_TENSOR_F16,
     RPC_CMD_COUNT,
 };
 
 // Try RPC_CMD_SET_TENSOR_HASH first when data size is larger than this threshold
 const size_t HASH_THRESHOLD = 10 * 1024 * 1024;
 
+// Queued commands are written out once they reach this size
+const size_t PENDING_FLUSH_SIZE = 1024 * 1024;
+
+static std::atomic<bool> rpc_pipelining { true };
+static std::atomic<int>  rpc_wire_type  { GGML_TYPE_F32 };
+
 struct rpc_msg_hello_rsp {
     uint8_t major;
     uint8_t minor;
@@ -183,6 +199,10 @@ struct rpc_msg_graph_compute_rsp {
     uint8_t result;
 };
 
+struct rpc_msg_sync_rsp {
+    uint8_t result;
+};
+
 struct rpc_msg_get_device_memory_rsp {
     uint64_t free_mem;
     uint64_t total_mem;
@@ -345,6 +365,16 @@ static bool recv_data(sockfd_t sockfd, void * data, size_t size) {
 }
 
 static bool send_msg(sockfd_t sockfd, const void * msg, size_t msg_size) {
+    // small replies go out in one write, so that the size and the payload share a packet
+    if (msg_size <= 4096) {
+        uint8_t buf[sizeof(uint64_t) + 4096];
+        const uint64_t size = msg_size;
+        memcpy(buf, &size, sizeof(size));
+        if (msg_size > 0) {
+            memcpy(buf + sizeof(size), msg, msg_size);
+        }
+        return send_data(sockfd, buf, sizeof(size) + msg_size);
+    }
     if (!send_data(sockfd, &msg_size, sizeof(msg_size))) {
         return false;
     }
@@ -386,9 +416,61 @@ static bool parse_endpoint(const std::string & endpoint, std::string & host, int
     return true;
 }
 
+static bool rpc_is_pipelined(const std::shared_ptr<socket_t> & sock) {
+    return rpc_pipelining.load() && sock->server_minor >= 1;
+}
+
+static void queue_rpc_cmd(const std::shared_ptr<socket_t> & sock, enum rpc_cmd cmd, const void * input, size_t input_size) {
+    const uint8_t  cmd_byte = cmd;
+    const uint64_t size     = input_size;
+
+    std::vector<uint8_t> & pending = sock->pending;
+    pending.insert(pending.end(), &cmd_byte, &cmd_byte + 1);
+    pending.insert(pending.end(), (const uint8_t *) &size, (const uint8_t *) &size + sizeof(size));
+    if (input_size > 0) {
+        pending.insert(pending.end(), (const uint8_t *) input, (const uint8_t *) input + input_size);
+    }
+}
+
+static bool flush_rpc_cmds(const std::shared_ptr<socket_t> & sock) {
+    if (sock->pending.empty()) {
+        return true;
+    }
+    const bool status = send_data(sock->fd, sock->pending.data(), sock->pending.size());
+    sock->pending.clear();
+    return status;
+}
+
+static bool recv_rpc_rsp(const std::shared_ptr<socket_t> & sock, void * output, size_t output_size) {
+    // TODO: currently the output_size is always known, do we need support for commands with variable output size?
+    // even if we do, we can skip sending output_size from the server for commands with known output size
+    uint64_t out_size;
+    if (!recv_data(sock->fd, &out_size, sizeof(out_size))) {
+        return false;
+    }
+    if (out_size != output_size) {
+        return false;
+    }
+    if (!recv_data(sock->fd, output, output_size)) {
+        return false;
+    }
+    return true;
+}
+
 // RPC request : | rpc_cmd (1 byte) | request_size (8 bytes) | request_data (request_size bytes) |
 // No response
 static bool send_rpc_cmd(const std::shared_ptr<socket_t> & sock, enum rpc_cmd cmd, const void * input, size_t input_size) {
+    if (rpc_is_pipelined(sock)) {
+        queue_rpc_cmd(sock, cmd, input, input_size);
+        if (sock->pending.size() >= PENDING_FLUSH_SIZE) {
+            return flush_rpc_cmds(sock);
+        }
+        return true;
+    }
+    // commands queued before pipelining was turned off
+    if (!flush_rpc_cmds(sock)) {
+        return false;
+    }
     uint8_t cmd_byte = cmd;
     if (!send_data(sock->fd, &cmd_byte, sizeof(cmd_byte))) {
         return false;
@@ -405,22 +487,18 @@ static bool send_rpc_cmd(const std::shared_ptr<socket_t> & sock, enum rpc_cmd cm
 // RPC request : | rpc_cmd (1 byte) | request_size (8 bytes) | request_data (request_size bytes) |
 // RPC response: | response_size (8 bytes) | response_data (response_size bytes) |
 static bool send_rpc_cmd(const std::shared_ptr<socket_t> & sock, enum rpc_cmd cmd, const void * input, size_t input_size, void * output, size_t output_size) {
-    if (!send_rpc_cmd(sock, cmd, input, input_size)) {
-        return false;
-    }
-    // TODO: currently the output_size is always known, do we need support for commands with variable output size?
-    // even if we do, we can skip sending output_size from the server for commands with known output size
-    uint64_t out_size;
-    if (!recv_data(sock->fd, &out_size, sizeof(out_size))) {
-        return false;
-    }
-    if (out_size != output_size) {
-        return false;
+    if (rpc_is_pipelined(sock)) {
+        // the queued commands and the request go out in one write
+        queue_rpc_cmd(sock, cmd, input, input_size);
+        if (!flush_rpc_cmds(sock)) {
+            return false;
+        }
+        return recv_rpc_rsp(sock, output, output_size);
     }
-    if (!recv_data(sock->fd, output, output_size)) {
+    if (!send_rpc_cmd(sock, cmd, input, input_size)) {
         return false;
     }
-    return true;
+    return recv_rpc_rsp(sock, output, output_size);
 }
 
 // RPC client-side implementation
@@ -436,6 +514,7 @@ static bool check_server_version(const std::shared_ptr<socket_t> & sock) {
     if (response.minor != RPC_PROTO_MINOR_VERSION || response.patch != RPC_PROTO_PATCH_VERSION) {
         fprintf(stderr, "WARNING: RPC server version mismatch: %d.%d.%d\n", response.major, response.minor, response.patch);
     }
+    sock->server_minor = response.minor;
     return true;
 }
 
@@ -553,9 +632,49 @@ static enum ggml_status ggml_backend_rpc_buffer_init_tensor(ggml_backend_buffer_
     return GGML_STATUS_SUCCESS;
 }
 
+// Lossy wire encoding only applies to F32 tensors in compute buffers (activations, logits)
+static ggml_type rpc_wire_type_for(const std::shared_ptr<socket_t> & sock, ggml_backend_buffer_t buffer, const ggml_tensor * tensor, size_t offset, size_t size) {
+    const ggml_type wire = (ggml_type) rpc_wire_type.load();
+    if (wire == GGML_TYPE_F32 || sock->server_minor < 1 || tensor->type != GGML_TYPE_F32 ||
+        ggml_backend_buffer_get_usage(buffer) != GGML_BACKEND_BUFFER_USAGE_COMPUTE ||
+        offset % sizeof(float) != 0 || size % sizeof(float) != 0 || size > HASH_THRESHOLD) {
+        return GGML_TYPE_F32;
+    }
+    return wire;
+}
+
 static void ggml_backend_rpc_buffer_set_tensor(ggml_backend_buffer_t buffer, ggml_tensor * tensor, const void * data, size_t offset, size_t size) {
     ggml_backend_rpc_buffer_context * ctx = (ggml_backend_rpc_buffer_context *)buffer->context;
     rpc_tensor rpc_tensor = serialize_tensor(tensor);
+    ggml_type wire = rpc_wire_type_for(ctx->sock, buffer, tensor, offset, size);
+    if (wire != GGML_TYPE_F32) {
+        const int64_t n = size / sizeof(float);
+        const float * x = (const float *) data;
+        // Q8_0 needs whole blocks and finite values (masks hold -INF), F16 is exact for those
+        if (wire == GGML_TYPE_Q8_0) {
+            bool ok = n % ggml_blck_size(wire) == 0;
+            for (int64_t i = 0; ok && i < n; i++) {
+                // exponent test instead of std::isfinite, which -ffast-math may fold to true
+                uint32_t bits;
+                memcpy(&bits, &x[i], sizeof(bits));
+                ok = (bits & 0x7f800000u) != 0x7f800000u;
+            }
+            if (!ok) {
+                wire = GGML_TYPE_F16;
+            }
+        }
+        // input serialization format: | rpc_tensor | offset (8 bytes) | wire_type (4 bytes) | data (encoded) |
+        const uint32_t wire_type = wire;
+        const size_t   header    = sizeof(rpc_tensor) + sizeof(uint64_t) + sizeof(wire_type);
+        std::vector<uint8_t> input(header + ggml_row_size(wire, n), 0);
+        memcpy(input.data(), &rpc_tensor, sizeof(rpc_tensor));
+        memcpy(input.data() + sizeof(rpc_tensor), &offset, sizeof(offset));
+        memcpy(input.data() + sizeof(rpc_tensor) + sizeof(offset), &wire_type, sizeof(wire_type));
+        ggml_get_type_traits(wire)->from_float_ref(x, input.data() + header, n);
+        bool status = send_rpc_cmd(ctx->sock, RPC_CMD_SET_TENSOR_WIRE, input.data(), input.size());
+        RPC_STATUS_ASSERT(status);
+        return;
+    }
     if (size > HASH_THRESHOLD) {
         rpc_msg_set_tensor_hash_req request;
         request.tensor = rpc_tensor;
@@ -585,6 +704,14 @@ static void ggml_backend_rpc_buffer_get_tensor(ggml_backend_buffer_t buffer, con
     request.tensor = serialize_tensor(tensor);
     request.offset = offset;
     request.size = size;
+    if (rpc_wire_type_for(ctx->sock, buffer, tensor, offset, size) != GGML_TYPE_F32) {
+        const int64_t n = size / sizeof(float);
+        std::vector<ggml_fp16_t> response(n);
+        bool status = send_rpc_cmd(ctx->sock, RPC_CMD_GET_TENSOR_F16, &request, sizeof(request), response.data(), n * sizeof(ggml_fp16_t));
+        RPC_STATUS_ASSERT(status);
+        ggml_fp16_to_fp32_row(response.data(), (float *) data, n);
+        return;
+    }
     bool status = send_rpc_cmd(ctx->sock, RPC_CMD_GET_TENSOR, &request, sizeof(request), data, size);
     RPC_STATUS_ASSERT(status);
 }
@@ -717,7 +844,9 @@ static void ggml_backend_rpc_free(ggml_backend_t backend) {
 
 static void ggml_backend_rpc_synchronize(ggml_backend_t backend) {
     GGML_UNUSED(backend);
-    // this is no-op because we don't have any async operations
+    // this is no-op: host memory is never accessed asynchronously (set_tensor copies the data before
+    // returning) and the server executes the commands of a connection in order, so queued commands
+    // are complete before any later reply
 }
 
 static void add_tensor(ggml_tensor * tensor, std::vector<rpc_tensor> & tensors, std::unordered_set<ggml_tensor*> & visited) {
@@ -761,8 +890,10 @@ static enum ggml_status ggml_backend_rpc_graph_compute(ggml_backend_t backend, g
     ggml_backend_rpc_context * rpc_ctx = (ggml_backend_rpc_context *)backend->context;
     std::vector<uint8_t> input;
     serialize_graph(cgraph, input);
-    rpc_msg_graph_compute_rsp response;
     auto sock = get_socket(rpc_ctx->endpoint);
+    // pipelined, the queued input tensors go out in the same write; the status is waited
+    // for either way, so that a failure reaches the caller that issued the compute
+    rpc_msg_graph_compute_rsp response;
     bool status = send_rpc_cmd(sock, RPC_CMD_GRAPH_COMPUTE, input.data(), input.size(), &response, sizeof(response));
     RPC_STATUS_ASSERT(status);
     return (enum ggml_status)response.result;
@@ -831,6 +962,15 @@ ggml_backend_t ggml_backend_rpc_init(const char * endpoint) {
     return backend;
 }
 
+void ggml_backend_rpc_set_pipelining(bool enable) {
+    rpc_pipelining = enable;
+}
+
+void ggml_backend_rpc_set_wire_type(enum ggml_type type) {
+    GGML_ASSERT(type == GGML_TYPE_F32 || type == GGML_TYPE_F16 || type == GGML_TYPE_Q8_0);
+    rpc_wire_type = type;
+}
+
 bool ggml_backend_is_rpc(ggml_backend_t backend) {
     return backend != NULL && ggml_guid_matches(backend->guid, ggml_backend_rpc_guid());
 }
@@ -870,8 +1010,10 @@ public:
     bool free_buffer(const rpc_msg_free_buffer_req & request);
     bool buffer_clear(const rpc_msg_buffer_clear_req & request);
     bool set_tensor(const std::vector<uint8_t> & input);
+    bool set_tensor_wire(const std::vector<uint8_t> & input);
     bool set_tensor_hash(const rpc_msg_set_tensor_hash_req & request, rpc_msg_set_tensor_hash_rsp & response);
     bool get_tensor(const rpc_msg_get_tensor_req & request, std::vector<uint8_t> & response);
+    bool get_tensor_f16(const rpc_msg_get_tensor_req & request, std::vector<uint8_t> & response);
     bool copy_tensor(const rpc_msg_copy_tensor_req & request, rpc_msg_copy_tensor_rsp & response);
     bool graph_compute(const std::vector<uint8_t> & input, rpc_msg_graph_compute_rsp & response);
     bool init_tensor(const rpc_msg_init_tensor_req & request);
@@ -1182,6 +1324,75 @@ bool rpc_server::init_tensor(const rpc_msg_init_tensor_req & request) {
     return true;
 }
 
+bool rpc_server::set_tensor_wire(const std::vector<uint8_t> & input) {
+    // serialization format: | rpc_tensor | offset (8 bytes) | wire_type (4 bytes) | data (encoded) |
+    const size_t header = sizeof(rpc_tensor) + sizeof(uint64_t) + sizeof(uint32_t);
+    if (input.size() < header) {
+        return false;
+    }
+    const rpc_tensor * in_tensor = (const rpc_tensor *)input.data();
+    uint64_t offset;
+    uint32_t wire_type;
+    memcpy(&offset, input.data() + sizeof(rpc_tensor), sizeof(offset));
+    memcpy(&wire_type, input.data() + sizeof(rpc_tensor) + sizeof(offset), sizeof(wire_type));
+    if (wire_type != GGML_TYPE_F16 && wire_type != GGML_TYPE_Q8_0) {
+        GGML_LOG_ERROR("[%s] unsupported wire type %u\n", __func__, wire_type);
+        return false;
+    }
+    const ggml_type wire = (ggml_type) wire_type;
+    const size_t data_size = input.size() - header;
+    if (data_size % ggml_type_size(wire) != 0) {
+        return false;
+    }
+    const int64_t n    = data_size / ggml_type_size(wire) * ggml_blck_size(wire);
+    const size_t  size = n * sizeof(float);
+
+    struct ggml_init_params params {
+        /*.mem_size   =*/ ggml_tensor_overhead(),
+        /*.mem_buffer =*/ NULL,
+        /*.no_alloc   =*/ true,
+    };
+    ggml_context_ptr ctx_ptr { ggml_init(params) };
+    GGML_ASSERT(ctx_ptr != nullptr);
+    ggml_context * ctx = ctx_ptr.get();
+    ggml_tensor * tensor = deserialize_tensor(ctx, in_tensor);
+    if (tensor == nullptr || tensor->type != GGML_TYPE_F32) {
+        GGML_LOG_ERROR("[%s] error deserializing tensor\n", __func__);
+        return false;
+    }
+
+    // sanitize tensor->data
+    {
+        const size_t p0 = (size_t) ggml_backend_buffer_get_base(tensor->buffer);
+        const size_t p1 = p0 + ggml_backend_buffer_get_size(tensor->buffer);
+
+        if (in_tensor->data + offset < p0 || in_tensor->data + offset >= p1 || size > (p1 - in_tensor->data - offset)) {
+            GGML_LOG_ERROR("[%s] tensor data region (data=0x%" PRIx64 ", offset=%" PRIu64 ", size=%zu) out of buffer bounds [0x%zx, 0x%zx)\n",
+                           __func__, in_tensor->data, offset, size, p0, p1);
+            return false;
+        }
+    }
+
+    std::vector<float> data(n);
+    ggml_get_type_traits(wire)->to_float(input.data() + header, data.data(), n);
+    ggml_backend_tensor_set(tensor, data.data(), offset, size);
+    return true;
+}
+
+bool rpc_server::get_tensor_f16(const rpc_msg_get_tensor_req & request, std::vector<uint8_t> & response) {
+    if (request.tensor.type != GGML_TYPE_F32 || request.size % sizeof(float) != 0) {
+        return false;
+    }
+    std::vector<uint8_t> data;
+    if (!get_tensor(request, data)) {
+        return false;
+    }
+    const int64_t n = request.size / sizeof(float);
+    response.resize(n * sizeof(ggml_fp16_t));
+    ggml_fp32_to_fp16_row((const float *) data.data(), (ggml_fp16_t *) response.data(), n);
+    return true;
+}
+
 bool rpc_server::get_tensor(const rpc_msg_get_tensor_req & request, std::vector<uint8_t> & response) {
     struct ggml_init_params params {
         /*.mem_size   =*/ ggml_tensor_overhead(),
@@ -1374,6 +1585,8 @@ rpc_server::~rpc_server() {
 static void rpc_serve_client(ggml_backend_t backend, const char * cache_dir,
                              sockfd_t sockfd, size_t free_mem, size_t total_mem) {
     rpc_server server(backend, cache_dir);
+    // first failure of the GRAPH_COMPUTE_ASYNC commands since the last SYNC
+    ggml_status async_status = GGML_STATUS_SUCCESS;
     uint8_t cmd;
     if (!recv_data(sockfd, &cmd, 1)) {
         return;
@@ -1572,6 +1785,56 @@ static void rpc_serve_client(ggml_backend_t backend, const char * cache_dir,
                 }
                 break;
             }
+            case RPC_CMD_GRAPH_COMPUTE_ASYNC: {
+                std::vector<uint8_t> input;
+                if (!recv_msg(sockfd, input)) {
+                    return;
+                }
+                rpc_msg_graph_compute_rsp response;
+                if (!server.graph_compute(input, response)) {
+                    return;
+                }
+                if (async_status == GGML_STATUS_SUCCESS) {
+                    async_status = (ggml_status) response.result;
+                }
+                break;
+            }
+            case RPC_CMD_SYNC: {
+                if (!recv_msg(sockfd, nullptr, 0)) {
+                    return;
+                }
+                rpc_msg_sync_rsp response;
+                response.result = async_status;
+                async_status = GGML_STATUS_SUCCESS;
+                if (!send_msg(sockfd, &response, sizeof(response))) {
+                    return;
+                }
+                break;
+            }
+            case RPC_CMD_SET_TENSOR_WIRE: {
+                std::vector<uint8_t> input;
+                if (!recv_msg(sockfd, input)) {
+                    return;
+                }
+                if (!server.set_tensor_wire(input)) {
+                    return;
+                }
+                break;
+            }
+            case RPC_CMD_GET_TENSOR_F16: {
+                rpc_msg_get_tensor_req request;
+                if (!recv_msg(sockfd, &request, sizeof(request))) {
+                    return;
+                }
+                std::vector<uint8_t> response;
+                if (!server.get_tensor_f16(request, response)) {
+                    return;
+                }
+                if (!send_msg(sockfd, response.data(), response.size())) {
+                    return;
+                }
+                break;
+            }
             case RPC_CMD_GET_DEVICE_MEMORY: {
                 if (!recv_msg(sockfd, nullptr, 0)) {
                     return;
@@ -384,9 +384,17 @@ extern "C" {
         bool only_copy;                       // only copy tensors - ftype, allow_requantize and quantize_output_tensor are ignored
         bool pure;                            // quantize all tensors to the default type
         bool keep_split;                      // quantize to the same number of shards
+        bool pin_threads;                     // pin the threads to cores, fastest first and spread over NUMA nodes
         void * imatrix;                       // pointer to importance matrix data
         void * kv_overrides;                  // pointer to vector containing overrides
         void * tensor_types;                  // pointer to vector containing tensor types
+
+        // Called after each tensor with the fraction of the input processed so far. Pass NULL to disable.
+        // If it returns false, quantization is aborted and llama_model_quantize fails.
+        llama_progress_callback progress_callback;
+
+        // context pointer passed to the progress callback
+        void * progress_callback_user_data;
     } llama_model_quantize_params;
 
     typedef struct llama_logit_bias {
@@ -606,6 +614,26 @@ extern "C" {
     // Remove all LoRA adapters from given context
     LLAMA_API void llama_clear_adapter_lora(struct llama_context * ctx);
 
+    // Add a loaded LoRA adapter to the tokens of a single sequence, on top of the adapters of the context
+    // Sequences in the same batch can use different adapters; a token shared by several sequences uses
+    // the adapters of its first seq_id
+    // Return -1 if seq_id is negative
+    LLAMA_API int32_t llama_set_adapter_lora_seq(
+            struct llama_context * ctx,
+            struct llama_adapter_lora * adapter,
+            llama_seq_id seq_id,
+            float scale);
+
+    // Remove a specific LoRA adapter from a sequence
+    // Return -1 if the adapter is not set for this sequence
+    LLAMA_API int32_t llama_rm_adapter_lora_seq(
+            struct llama_context * ctx,
+            struct llama_adapter_lora * adapter,
+            llama_seq_id seq_id);
+
+    // Remove all LoRA adapters of a sequence, seq_id < 0 : all sequences
+    LLAMA_API void llama_clear_adapter_lora_seq(struct llama_context * ctx, llama_seq_id seq_id);
+
     // Apply a loaded control vector to a llama_context, or if data is NULL, clear
     // the currently loaded vector.
     // n_embd should be the size of a single layer's control, and data should point
@@ -1,9 +1,25 @@
 #include "llama.h"
+#include "llama_chat_session.h"
+#include "llama_context_shift.h"
+#include "llama_detokenizer.h"
+#include "llama_embedding.h"
+#include "llama_imatrix.h"
+#include "llama_lookahead.h"
+#include "llama_parallel.h"
+#include "llama_requant.h"
+#include "llama_rpc.h"
+#include "llama_speculative.h"
+#include "llama_vector_index.h"
 #include <jni.h>
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
 #include <string>
 #include <map>
+#include <thread>
 #include <vector>
 #include <android/log.h>
+#include <unistd.h>
 
 #define LOG_TAG "LlamaCpp"
 #define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
@@ -13,9 +29,219 @@
 static std::map<int64_t, llama_model*> models;
 static std::map<int64_t, llama_context*> contexts;
 static std::map<int64_t, llama_sampler*> samplers;
+static std::map<int64_t, int64_t> context_models;
+// Settings the sampler of each context was built from; speculative verification
+// samples from the same distribution
+struct sampler_settings {
+    int32_t  top_k = 0;     // <= 0 disables top-k
+    float    top_p = 0.9f;
+    float    temp  = 0.8f;
+    uint32_t seed  = LLAMA_DEFAULT_SEED;
+};
+static std::map<int64_t, sampler_settings> context_sampling;
+// Optional draft model per context for speculative decoding
+static std::map<int64_t, llama_model*> draft_models;
+static std::map<int64_t, llama_context*> draft_contexts;
+static std::map<int64_t, speculative_session*> speculative_sessions;
+// Optional lookahead decoding per context
+static std::map<int64_t, lookahead_session*> lookahead_sessions;
+// Conversation kept in the KV cache across generateText calls, with context shifting
+static std::map<int64_t, conversation*> conversations;
+// Chat messages of a conversation, rendered with the chat template
+static std::map<int64_t, chat_session*> chat_sessions;
+// Telemetry of the last generation per context
+static std::map<int64_t, speculative_stats> generation_stats;
+// Embedding context per model, created on first use
+static std::map<int64_t, embedding_context*> embedding_contexts;
+// LoRA adapters registered per model, loaded on first use
+struct lora_entry {
+    int64_t model_id;
+    std::string path;
+    llama_adapter_lora* adapter;
+};
+static std::map<int64_t, lora_entry> lora_adapters;
+// Adapter applied to the whole context by generateText: (adapter ID, scale)
+static std::map<int64_t, std::pair<int64_t, float>> context_loras;
+// Open on-device vector indexes
+static std::map<int64_t, vector_index*> vector_indexes;
+// Background requantization jobs
+static std::map<int64_t, requant_job*> requant_jobs;
+// Importance matrix collected from the contexts of a model
+static std::map<int64_t, imatrix_collector*> imatrix_collectors;
+// Text of every token of a model, rendered when the model is loaded
+static std::map<int64_t, piece_table*> piece_tables;
+
+// Generation driven one token per getNextStreamingToken call
+struct token_stream {
+    detokenizer detok;
+    std::string text;           // text of the current step, its storage is reused
+    int32_t n_remaining = 0;    // tokens left to generate
+    bool done = false;
+    int64_t t_start_us = 0;
+    int32_t n_generated = 0;
+};
+static std::map<int64_t, token_stream*> token_streams;
 static int64_t next_id = 1;
 static bool backend_initialized = false;
 
+static void free_chat_session(int64_t context_id) {
+    auto it = chat_sessions.find(context_id);
+    if (it != chat_sessions.end()) {
+        chat_session_free(it->second);
+        chat_sessions.erase(it);
+    }
+}
+
+// Piece table of the model of a context
+static const piece_table* context_pieces(int64_t context_id) {
+    return piece_tables[context_models[context_id]];
+}
+
+// Get a registered adapter, loading it from disk the first time it is used
+static llama_adapter_lora* get_lora_adapter(int64_t adapter_id) {
+    auto it = lora_adapters.find(adapter_id);
+    if (it == lora_adapters.end()) {
+        LOGE("LoRA adapter ID %lld not found", adapter_id);
+        return nullptr;
+    }
+    
+    lora_entry &entry = it->second;
+    if (!entry.adapter) {
+        LOGI("Loading LoRA adapter from: %s", entry.path.c_str());
+        entry.adapter = llama_adapter_lora_init(models[entry.model_id], entry.path.c_str());
+        if (!entry.adapter) {
+            LOGE("Failed to load LoRA adapter from: %s", entry.path.c_str());
+        }
+    }
+    return entry.adapter;
+}
+
+// Get the embedding context of a model, creating it the first time
+static embedding_context* get_embedding_context(int64_t model_id) {
+    auto it = embedding_contexts.find(model_id);
+    if (it != embedding_contexts.end()) {
+        return it->second;
+    }
+    
+    embedding_params params;
+    embedding_context* emb = embedding_init(models[model_id], params);
+    if (emb) {
+        embedding_contexts[model_id] = emb;
+    }
+    return emb;
+}
+
+// Speculative decoding parameters that verify with the sampling settings of context_id
+static speculative_params speculative_params_for(int64_t context_id) {
+    const sampler_settings & settings = context_sampling[context_id];
+    
+    speculative_params sparams;
+    sparams.top_k = settings.top_k;
+    sparams.top_p = settings.top_p;
+    sparams.temp  = settings.temp;
+    sparams.seed  = settings.seed;
+    return sparams;
+}
+
+// Create a context with the same settings as context_id but n_seq_max sequences
+static llama_context* new_context_like(int64_t context_id, uint32_t n_seq_max) {
+    llama_context* old_ctx = contexts[context_id];
+    
+    auto params = llama_context_default_params();
+    params.n_ctx = llama_n_ctx(old_ctx);
+    params.n_batch = llama_n_batch(old_ctx);
+    params.n_seq_max = n_seq_max;
+    
+    auto imatrix_it = imatrix_collectors.find(context_models[context_id]);
+    if (imatrix_it != imatrix_collectors.end()) {
+        params.cb_eval = imatrix_eval_callback;
+        params.cb_eval_user_data = imatrix_it->second;
+    }
+    
+    llama_context* ctx = llama_init_from_model(models[context_models[context_id]], params);
+    if (!ctx) {
+        return nullptr;
+    }
+    
+    auto lora_it = context_loras.find(context_id);
+    if (lora_it != context_loras.end()) {
+        llama_set_adapter_lora(ctx, get_lora_adapter(lora_it->second.first), lora_it->second.second);
+    }
+    return ctx;
+}
+
+// Generate a reply after the tokens of a conversation. With decode_eog the
+// end-of-generation token is evaluated too; chat templates hand out their own end
+// of turn with the next message instead.
+static std::string generate_reply(llama_context* ctx, llama_sampler* sampler, conversation* conv,
+                                  const piece_table* pieces, int max_tokens, bool decode_eog,
+                                  int64_t t_start_us, speculative_stats& stats) {
+    const llama_vocab* vocab = llama_model_get_vocab(llama_get_model(ctx));
+    
+    if (!conversation_has_logits(conv)) {
+        LOGE("Nothing to generate from, evaluate an input first");
+        return "";
+    }
+    
+    std::vector<llama_token> output;
+    for (int i = 0; i < max_tokens; ++i) {
+        const llama_token id = llama_sampler_sample(sampler, ctx, -1);
+        llama_sampler_accept(sampler, id);
+        
+        const bool is_eog = llama_vocab_is_eog(vocab, id);
+        if (is_eog && !decode_eog) {
+            LOGI("Generated EOS token, stopping");
+            break;
+        }
+        output.push_back(id);
+        
+        if (!conversation_decode(conv, &id, 1)) {
+            LOGE("Failed to decode generated token");
+            break;
+        }
+        
+        if (is_eog) {
+            LOGI("Generated EOS token, stopping");
+            break;
+        }
+    }
+    
+    stats = {};
+    stats.n_steps     = (int32_t) output.size();
+    stats.n_generated = (int32_t) output.size();
+    stats.t_gen_us    = llama_time_us() - t_start_us;
+    
+    return detokenize(pieces, output);
+}
+
+// Continue the conversation of a context with input and generate the reply. The
+// reply tokens are evaluated too, so the next turn starts right after them, and
+// the turn leaves a checkpoint to generate the reply again from.
+static std::string generate_in_conversation(llama_context* ctx, llama_sampler* sampler, conversation* conv,
+                                            const piece_table* pieces, const char* input, int max_tokens,
+                                            speculative_stats& stats) {
+    const llama_vocab* vocab = llama_model_get_vocab(llama_get_model(ctx));
+    const int64_t t_start_us = llama_time_us();
+    
+    // BOS only at the start of the conversation
+    const bool add_bos = conversation_tokens(conv).empty();
+    
+    std::vector<llama_token> tokens(strlen(input) + 2);
+    const int n_tokens = llama_tokenize(vocab, input, strlen(input), tokens.data(), tokens.size(), add_bos, false);
+    if (n_tokens < 0) {
+        LOGE("Tokenization failed with error: %d", n_tokens);
+        return "";
+    }
+    tokens.resize(n_tokens);
+    
+    if (!conversation_decode_turn(conv, tokens.data(), n_tokens)) {
+        LOGE("Failed to decode input tokens");
+        return "";
+    }
+    
+    return generate_reply(ctx, sampler, conv, pieces, max_tokens, true, t_start_us, stats);
+}
+
 extern "C" {
 
 // Initialize the backend (call once)
@@ -49,10 +275,112 @@ Java_com_example_gpt_1lite_LlamaCppPlugin_loadModel(JNIEnv *env, jobject /* this
     
     int64_t model_id = next_id++;
     models[model_id] = model;
+    piece_tables[model_id] = piece_table_init(llama_model_get_vocab(model));
     LOGI("Model loaded successfully with ID: %lld", model_id);
     return model_id;
 }
 
+// Split parameters from the plugin arguments, wire_type: 0 = F32, 1 = F16, 2 = Q8_0
+static rpc_split_params get_rpc_split_params(JNIEnv *env, jobjectArray rpc_endpoints, jint n_remote_layers, jint wire_type) {
+    rpc_split_params params;
+    params.n_remote_layers = n_remote_layers;
+    params.wire_type = wire_type == 2 ? GGML_TYPE_Q8_0 : wire_type == 1 ? GGML_TYPE_F16 : GGML_TYPE_F32;
+    
+    const jsize n_endpoints = env->GetArrayLength(rpc_endpoints);
+    for (jsize i = 0; i < n_endpoints; ++i) {
+        jstring rpc_endpoint = (jstring) env->GetObjectArrayElement(rpc_endpoints, i);
+        const char *endpoint = env->GetStringUTFChars(rpc_endpoint, 0);
+        params.endpoints.push_back(endpoint);
+        env->ReleaseStringUTFChars(rpc_endpoint, endpoint);
+        env->DeleteLocalRef(rpc_endpoint);
+    }
+    
+    return params;
+}
+
+// Load a model whose last n_remote_layers layers run on RPC servers ("host:port"),
+// -1 places all layers remotely. The remaining layers run on the local CPU.
+JNIEXPORT jlong JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_loadModelRpc(JNIEnv *env, jobject /* this */,
+                                                       jstring model_path, jobjectArray rpc_endpoints,
+                                                       jint n_remote_layers, jint wire_type) {
+    rpc_split_params params = get_rpc_split_params(env, rpc_endpoints, n_remote_layers, wire_type);
+    const jsize n_endpoints = (jsize) params.endpoints.size();
+    
+    const char *path = env->GetStringUTFChars(model_path, 0);
+    LOGI("Loading model from: %s (RPC split over %d server(s))", path, n_endpoints);
+    
+    llama_model* model = rpc_load_model(path, params);
+    env->ReleaseStringUTFChars(model_path, path);
+    
+    if (!model) {
+        return 0;
+    }
+    
+    int64_t model_id = next_id++;
+    models[model_id] = model;
+    piece_tables[model_id] = piece_table_init(llama_model_get_vocab(model));
+    LOGI("Model loaded successfully with ID: %lld", model_id);
+    return model_id;
+}
+
+// Blocking vs pipelined RPC decoding speed through a loopback proxy adding latency_ms
+// in each direction, as a JSON object
+JNIEXPORT jstring JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_benchmarkRpc(JNIEnv *env, jobject /* this */,
+                                                       jstring model_path, jobjectArray rpc_endpoints,
+                                                       jint n_remote_layers, jint wire_type,
+                                                       jstring input_text, jint n_tokens, jint latency_ms) {
+    rpc_split_params params = get_rpc_split_params(env, rpc_endpoints, n_remote_layers, wire_type);
+    
+    const char *path = env->GetStringUTFChars(model_path, 0);
+    const char *input = env->GetStringUTFChars(input_text, 0);
+    
+    speculative_stats blocking;
+    speculative_stats pipelined;
+    const bool ok = rpc_benchmark(path, params, input, n_tokens, latency_ms, blocking, pipelined);
+    
+    env->ReleaseStringUTFChars(model_path, path);
+    env->ReleaseStringUTFChars(input_text, input);
+    
+    char json[256];
+    snprintf(json, sizeof(json),
+             "{\"ok\":%s,\"latency_ms\":%d,\"blocking_tokens_per_second\":%.2f,"
+             "\"pipelined_tokens_per_second\":%.2f,\"tokens\":%d}",
+             ok ? "true" : "false", latency_ms, blocking.tokens_per_second(),
+             pipelined.tokens_per_second(), pipelined.n_generated);
+    
+    return env->NewStringUTF(json);
+}
+
+// Serve this device's CPU to other devices on the network. The server runs on a
+// background thread until its socket fails; cached weights go to cache_dir. When the
+// endpoint cannot be bound, the server stops and can be started again.
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_startRpcServer(JNIEnv *env, jobject /* this */,
+                                                         jstring rpc_endpoint, jstring cache_dir, jint n_threads) {
+    // cleared by the server thread when rpc_serve returns (bind failure or a failed socket)
+    static std::atomic<bool> rpc_server_running { false };
+    if (rpc_server_running.exchange(true)) {
+        LOGE("RPC server is already running");
+        return JNI_FALSE;
+    }
+    
+    const char *endpoint = env->GetStringUTFChars(rpc_endpoint, 0);
+    const char *cache = env->GetStringUTFChars(cache_dir, 0);
+    std::string endpoint_str = endpoint;
+    std::string cache_str = cache;
+    env->ReleaseStringUTFChars(rpc_endpoint, endpoint);
+    env->ReleaseStringUTFChars(cache_dir, cache);
+    
+    std::thread([endpoint_str, cache_str, n_threads]() {
+        rpc_serve(endpoint_str.c_str(), cache_str.empty() ? nullptr : cache_str.c_str(), n_threads, 0);
+        rpc_server_running = false;
+    }).detach();
+    
+    return JNI_TRUE;
+}
+
 JNIEXPORT jlong JNICALL
 Java_com_example_gpt_1lite_LlamaCppPlugin_createContext(JNIEnv *env, jobject /* this */, jlong model_id) {
     if (models.find(model_id) == models.end()) {
@@ -64,6 +392,12 @@ Java_com_example_gpt_1lite_LlamaCppPlugin_createContext(JNIEnv *env, jobject /*
     params.n_batch = 512;
     // Note: seed is not a member of llama_context_params in current API
     
+    auto imatrix_it = imatrix_collectors.find(model_id);
+    if (imatrix_it != imatrix_collectors.end()) {
+        params.cb_eval = imatrix_eval_callback;
+        params.cb_eval_user_data = imatrix_it->second;
+    }
+    
     llama_context* context = llama_new_context_with_model(models[model_id], params);
     if (!context) {
         LOGE("Failed to create context for model ID: %lld", model_id);
@@ -71,17 +405,21 @@ Java_com_example_gpt_1lite_LlamaCppPlugin_createContext(JNIEnv *env, jobject /*
     }
     
     // Create a sampler for this context
+    const sampler_settings settings;
     auto sparams = llama_sampler_chain_default_params();
     llama_sampler* sampler = llama_sampler_chain_init(sparams);
     
-    // Add sampling components    llama_sampler_chain_add(sampler, llama_sampler_init_top_k(40));
-    llama_sampler_chain_add(sampler, llama_sampler_init_top_p(0.9f, 1));
-    llama_sampler_chain_add(sampler, llama_sampler_init_temp(0.8f));
-    llama_sampler_chain_add(sampler, llama_sampler_init_dist(-1)); // Random seed
+    // Add sampling components
+    llama_sampler_chain_add(sampler, llama_sampler_init_top_k(settings.top_k));
+    llama_sampler_chain_add(sampler, llama_sampler_init_top_p(settings.top_p, 1));
+    llama_sampler_chain_add(sampler, llama_sampler_init_temp(settings.temp));
+    llama_sampler_chain_add(sampler, llama_sampler_init_dist(settings.seed)); // Random seed
     
     int64_t context_id = next_id++;
     contexts[context_id] = context;
     samplers[context_id] = sampler;
+    context_sampling[context_id] = settings;
+    context_models[context_id] = model_id;
     LOGI("Context created successfully with ID: %lld", context_id);
     return context_id;
 }
@@ -94,11 +432,30 @@ Java_com_example_gpt_1lite_LlamaCppPlugin_generateText(JNIEnv *env, jobject /* t
         return env->NewStringUTF("");
     }
     
+    if (chat_sessions.find(context_id) != chat_sessions.end()) {
+        LOGE("Context ID %lld holds a chat, send messages with chat", context_id);
+        return env->NewStringUTF("");
+    }
+    
     const char *input = env->GetStringUTFChars(input_text, 0);
     llama_context *ctx = contexts[context_id];
     llama_sampler *sampler = samplers[context_id];
     
     LOGI("Generating text for input: %.50s...", input);
+    
+    // Continue the conversation when one was started on this context
+    auto conv_it = conversations.find(context_id);
+    if (conv_it != conversations.end()) {
+        speculative_stats stats;
+        std::string result = generate_in_conversation(ctx, sampler, conv_it->second, context_pieces(context_id),
+                                                      input, max_tokens, stats);
+        env->ReleaseStringUTFChars(input_text, input);
+        generation_stats[context_id] = stats;
+        
+        LOGI("Generated %d tokens, result length: %zu, conversation at %zu tokens",
+             stats.n_generated, result.length(), conversation_tokens(conv_it->second).size());
+        return env->NewStringUTF(result.c_str());
+    }
       // Tokenize input
     std::vector<llama_token> tokens(512);
     const int n_tokens = llama_tokenize(
@@ -121,6 +478,36 @@ Java_com_example_gpt_1lite_LlamaCppPlugin_generateText(JNIEnv *env, jobject /* t
     tokens.resize(n_tokens);
     LOGI("Tokenized input into %d tokens", n_tokens);
     
+    // Use speculative decoding when a draft model is attached to this context
+    auto spec_it = speculative_sessions.find(context_id);
+    if (spec_it != speculative_sessions.end()) {
+        std::vector<llama_token> output;
+        if (!speculative_generate(spec_it->second, tokens, max_tokens, output)) {
+            LOGE("Speculative generation stopped early");
+        }
+        generation_stats[context_id] = speculative_get_stats(spec_it->second);
+        
+        std::string result = detokenize(context_pieces(context_id), output);
+        LOGI("Generated %zu tokens, result length: %zu", output.size(), result.length());
+        return env->NewStringUTF(result.c_str());
+    }
+    
+    // Use lookahead decoding when enabled for this context
+    auto la_it = lookahead_sessions.find(context_id);
+    if (la_it != lookahead_sessions.end()) {
+        std::vector<llama_token> output;
+        if (!lookahead_generate(la_it->second, tokens, max_tokens, output)) {
+            LOGE("Lookahead generation stopped early");
+        }
+        generation_stats[context_id] = lookahead_get_stats(la_it->second);
+        
+        std::string result = detokenize(context_pieces(context_id), output);
+        LOGI("Generated %zu tokens, result length: %zu", output.size(), result.length());
+        return env->NewStringUTF(result.c_str());
+    }
+    
+    const int64_t t_start_us = llama_time_us();
+    
     // Create batch for input tokens
     llama_batch batch = llama_batch_init(n_tokens, 0, 1);
     
@@ -144,6 +531,8 @@ Java_com_example_gpt_1lite_LlamaCppPlugin_generateText(JNIEnv *env, jobject /* t
     // Generate response tokens
     std::string result;
     int n_generated = 0;
+    detokenizer detok;
+    detokenizer_init(detok, context_pieces(context_id));
     
     for (int i = 0; i < max_tokens; ++i) {
         // Sample next token
@@ -151,24 +540,8 @@ Java_com_example_gpt_1lite_LlamaCppPlugin_generateText(JNIEnv *env, jobject /* t
         
         // Accept the token (update sampler state)
         llama_sampler_accept(sampler, id);
-          // Convert token to string
-        char token_str[256];
-        const int token_len = llama_token_to_piece(
-            llama_model_get_vocab(llama_get_model(ctx)),
-            id,
-            token_str,
-            sizeof(token_str),
-            0,
-            false
-        );
         
-        if (token_len < 0) {
-            LOGE("Failed to convert token to string");
-            break;
-        }
-        
-        token_str[token_len] = '\0';
-        result += std::string(token_str);
+        detokenizer_push(detok, id, result);
         n_generated++;
           // Check for end of sequence
         if (id == llama_vocab_eos(llama_model_get_vocab(llama_get_model(ctx)))) {
@@ -192,30 +565,1322 @@ Java_com_example_gpt_1lite_LlamaCppPlugin_generateText(JNIEnv *env, jobject /* t
     }
     
     llama_batch_free(batch);
+    detokenizer_flush(detok, result);
+    
+    speculative_stats stats;
+    stats.n_steps     = n_generated;
+    stats.n_generated = n_generated;
+    stats.t_gen_us    = llama_time_us() - t_start_us;
+    generation_stats[context_id] = stats;
+    
     LOGI("Generated %d tokens, result length: %zu", n_generated, result.length());
     
     return env->NewStringUTF(result.c_str());
 }
 
-JNIEXPORT void JNICALL
-Java_com_example_gpt_1lite_LlamaCppPlugin_freeContext(JNIEnv *env, jobject /* this */, jlong context_id) {
-    auto ctx_it = contexts.find(context_id);
-    if (ctx_it != contexts.end()) {
-        llama_free(ctx_it->second);
-        contexts.erase(ctx_it);
+// Attach a draft model to a context; generateText then uses speculative decoding
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_attachDraftModel(JNIEnv *env, jobject /* this */,
+                                                           jlong context_id, jstring draft_model_path, jint n_draft) {
+    if (contexts.find(context_id) == contexts.end()) {
+        LOGE("Context ID %lld not found", context_id);
+        return JNI_FALSE;
+    }
+    if (speculative_sessions.find(context_id) != speculative_sessions.end() ||
+        lookahead_sessions.find(context_id) != lookahead_sessions.end()) {
+        LOGE("Context ID %lld already uses speculative decoding", context_id);
+        return JNI_FALSE;
+    }
+    if (conversations.find(context_id) != conversations.end()) {
+        LOGE("Context ID %lld holds a conversation, end it first", context_id);
+        return JNI_FALSE;
     }
     
-    auto smp_it = samplers.find(context_id);
-    if (smp_it != samplers.end()) {
-        llama_sampler_free(smp_it->second);
-        samplers.erase(smp_it);
+    const char *path = env->GetStringUTFChars(draft_model_path, 0);
+    LOGI("Loading draft model from: %s", path);
+    
+    auto mparams = llama_model_default_params();
+    mparams.n_gpu_layers = 0;
+    mparams.use_mmap = true;
+    mparams.use_mlock = false;
+    
+    llama_model* draft_model = llama_model_load_from_file(path, mparams);
+    env->ReleaseStringUTFChars(draft_model_path, path);
+    
+    if (!draft_model) {
+        LOGE("Failed to load draft model");
+        return JNI_FALSE;
     }
     
-    LOGI("Freed context and sampler with ID: %lld", context_id);
+    llama_context* ctx = contexts[context_id];
+    
+    // The draft must hold the same token history as the target
+    auto cparams = llama_context_default_params();
+    cparams.n_ctx = llama_n_ctx(ctx);
+    cparams.n_batch = llama_n_batch(ctx);
+    
+    llama_context* draft_ctx = llama_init_from_model(draft_model, cparams);
+    if (!draft_ctx) {
+        LOGE("Failed to create draft context");
+        llama_model_free(draft_model);
+        return JNI_FALSE;
+    }
+    
+    speculative_params sparams = speculative_params_for(context_id);
+    sparams.n_draft = n_draft;
+    
+    speculative_session* spec = speculative_init(ctx, draft_ctx, sparams);
+    if (!spec) {
+        LOGE("Draft model is not usable for speculative decoding with this context");
+        llama_free(draft_ctx);
+        llama_model_free(draft_model);
+        return JNI_FALSE;
+    }
+    
+    draft_models[context_id] = draft_model;
+    draft_contexts[context_id] = draft_ctx;
+    speculative_sessions[context_id] = spec;
+    LOGI("Draft model attached to context ID %lld, n_draft = %d", context_id, n_draft);
+    return JNI_TRUE;
 }
 
-JNIEXPORT void JNICALL
-Java_com_example_gpt_1lite_LlamaCppPlugin_freeModel(JNIEnv *env, jobject /* this */, jlong model_id) {
+// Enable draft-free speculative decoding from n-gram matches in the context
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_enablePromptLookup(JNIEnv *env, jobject /* this */,
+                                                             jlong context_id, jint n_draft, jint n_gram) {
+    if (contexts.find(context_id) == contexts.end()) {
+        LOGE("Context ID %lld not found", context_id);
+        return JNI_FALSE;
+    }
+    if (speculative_sessions.find(context_id) != speculative_sessions.end() ||
+        lookahead_sessions.find(context_id) != lookahead_sessions.end()) {
+        LOGE("Context ID %lld already uses speculative decoding", context_id);
+        return JNI_FALSE;
+    }
+    if (conversations.find(context_id) != conversations.end()) {
+        LOGE("Context ID %lld holds a conversation, end it first", context_id);
+        return JNI_FALSE;
+    }
+    
+    speculative_params sparams = speculative_params_for(context_id);
+    sparams.n_draft = n_draft;
+    sparams.n_gram = n_gram;
+    
+    speculative_session* spec = speculative_init(contexts[context_id], nullptr, sparams);
+    if (!spec) {
+        LOGE("Prompt lookup is not usable with this context");
+        return JNI_FALSE;
+    }
+    
+    speculative_sessions[context_id] = spec;
+    LOGI("Prompt lookup enabled for context ID %lld, n_draft = %d, n_gram = %d", context_id, n_draft, n_gram);
+    return JNI_TRUE;
+}
+
+// Switch a context to lookahead decoding. The context is recreated with one KV
+// sequence per lookahead column and verification n-gram.
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_enableLookahead(JNIEnv *env, jobject /* this */,
+                                                          jlong context_id, jint window, jint ngram, jint guess) {
+    if (contexts.find(context_id) == contexts.end()) {
+        LOGE("Context ID %lld not found", context_id);
+        return JNI_FALSE;
+    }
+    if (speculative_sessions.find(context_id) != speculative_sessions.end() ||
+        lookahead_sessions.find(context_id) != lookahead_sessions.end()) {
+        LOGE("Context ID %lld already uses speculative decoding", context_id);
+        return JNI_FALSE;
+    }
+    if (conversations.find(context_id) != conversations.end()) {
+        LOGE("Context ID %lld holds a conversation, end it first", context_id);
+        return JNI_FALSE;
+    }
+    
+    llama_context* old_ctx = contexts[context_id];
+    
+    lookahead_params lparams;
+    lparams.n_window = window;
+    lparams.n_gram = ngram;
+    lparams.n_guess = guess;
+    
+    llama_context* ctx = new_context_like(context_id, lookahead_n_seq(lparams));
+    if (!ctx) {
+        LOGE("Failed to create lookahead context for context ID %lld", context_id);
+        return JNI_FALSE;
+    }
+    
+    lookahead_session* la = lookahead_init(ctx, samplers[context_id], lparams);
+    if (!la) {
+        llama_free(ctx);
+        return JNI_FALSE;
+    }
+    
+    llama_free(old_ctx);
+    contexts[context_id] = ctx;
+    lookahead_sessions[context_id] = la;
+    LOGI("Lookahead enabled for context ID %lld, W = %d, N = %d, G = %d", context_id, window, ngram, guess);
+    return JNI_TRUE;
+}
+
+// Compare greedy plain decoding against lookahead decoding on a prompt
+JNIEXPORT jstring JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_benchmarkLookahead(JNIEnv *env, jobject /* this */,
+                                                             jlong context_id, jstring input_text, jint n_tokens) {
+    auto la_it = lookahead_sessions.find(context_id);
+    if (la_it == lookahead_sessions.end()) {
+        LOGE("Lookahead is not enabled for context ID %lld", context_id);
+        return env->NewStringUTF("{}");
+    }
+    
+    llama_context* ctx = contexts[context_id];
+    
+    const char *input = env->GetStringUTFChars(input_text, 0);
+    std::vector<llama_token> tokens(512);
+    const int n_prompt = llama_tokenize(
+        llama_model_get_vocab(llama_get_model(ctx)), input, strlen(input),
+        tokens.data(), tokens.size(), true, false);
+    env->ReleaseStringUTFChars(input_text, input);
+    
+    if (n_prompt <= 0) {
+        LOGE("Tokenization failed with error: %d", n_prompt);
+        return env->NewStringUTF("{}");
+    }
+    tokens.resize(n_prompt);
+    
+    lookahead_params lparams;
+    lookahead_get_params(la_it->second, lparams);
+    
+    speculative_stats plain;
+    speculative_stats lookahead;
+    bool identical = false;
+    const bool ok = lookahead_benchmark(ctx, lparams, tokens, n_tokens, plain, lookahead, identical);
+    
+    char json[256];
+    snprintf(json, sizeof(json),
+             "{\"ok\":%s,\"identical\":%s,\"plain_tokens_per_second\":%.2f,\"lookahead_tokens_per_second\":%.2f,"
+             "\"tokens\":%d,\"lookahead_steps\":%d,\"accepted\":%d}",
+             ok ? "true" : "false", identical ? "true" : "false", plain.tokens_per_second(), lookahead.tokens_per_second(),
+             lookahead.n_generated, lookahead.n_steps, lookahead.n_accepted);
+    
+    return env->NewStringUTF(json);
+}
+
+// Register a LoRA adapter file for a model. The adapter is only loaded when a
+// context first uses it. Returns the adapter ID, 0 on error.
+JNIEXPORT jlong JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_registerLoraAdapter(JNIEnv *env, jobject /* this */,
+                                                              jlong model_id, jstring adapter_path) {
+    if (models.find(model_id) == models.end()) {
+        LOGE("Model ID %lld not found", model_id);
+        return 0;
+    }
+    
+    const char *path = env->GetStringUTFChars(adapter_path, 0);
+    int64_t adapter_id = next_id++;
+    lora_adapters[adapter_id] = { model_id, path, nullptr };
+    LOGI("Registered LoRA adapter %s with ID: %lld", path, adapter_id);
+    env->ReleaseStringUTFChars(adapter_path, path);
+    
+    return adapter_id;
+}
+
+// Apply a LoRA adapter to every generateText call of a context, adapter ID 0 removes it
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_setLoraAdapter(JNIEnv *env, jobject /* this */,
+                                                         jlong context_id, jlong adapter_id, jfloat scale) {
+    if (contexts.find(context_id) == contexts.end()) {
+        LOGE("Context ID %lld not found", context_id);
+        return JNI_FALSE;
+    }
+    
+    llama_context* ctx = contexts[context_id];
+    
+    if (adapter_id == 0) {
+        llama_clear_adapter_lora(ctx);
+        context_loras.erase(context_id);
+        return JNI_TRUE;
+    }
+    
+    auto it = lora_adapters.find(adapter_id);
+    if (it == lora_adapters.end() || it->second.model_id != context_models[context_id]) {
+        LOGE("LoRA adapter ID %lld does not belong to the model of context ID %lld", adapter_id, context_id);
+        return JNI_FALSE;
+    }
+    
+    llama_adapter_lora* adapter = get_lora_adapter(adapter_id);
+    if (!adapter) {
+        return JNI_FALSE;
+    }
+    
+    llama_clear_adapter_lora(ctx);
+    llama_set_adapter_lora(ctx, adapter, scale);
+    context_loras[context_id] = { adapter_id, scale };
+    return JNI_TRUE;
+}
+
+// Generate for several prompts in one batch, each with its own LoRA adapter
+// (adapter ID 0: base model, also when setLoraAdapter set one for the context).
+// Returns one string per prompt.
+JNIEXPORT jobjectArray JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_generateParallel(JNIEnv *env, jobject /* this */,
+                                                           jlong context_id, jobjectArray input_texts,
+                                                           jlongArray adapter_ids, jfloatArray adapter_scales,
+                                                           jint max_tokens) {
+    const jsize n_prompts = env->GetArrayLength(input_texts);
+    jobjectArray output = env->NewObjectArray(n_prompts, env->FindClass("java/lang/String"), env->NewStringUTF(""));
+    
+    if (contexts.find(context_id) == contexts.end()) {
+        LOGE("Context ID %lld not found", context_id);
+        return output;
+    }
+    if (n_prompts == 0 ||
+        env->GetArrayLength(adapter_ids) != n_prompts ||
+        env->GetArrayLength(adapter_scales) != n_prompts) {
+        LOGE("generateParallel needs one adapter ID and scale per prompt");
+        return output;
+    }
+    if (conversations.find(context_id) != conversations.end()) {
+        LOGE("Context ID %lld holds a conversation, end it first", context_id);
+        return output;
+    }
+    
+    // one KV sequence per prompt
+    if (llama_n_seq_max(contexts[context_id]) < (uint32_t) n_prompts) {
+        if (speculative_sessions.find(context_id) != speculative_sessions.end() ||
+            lookahead_sessions.find(context_id) != lookahead_sessions.end()) {
+            LOGE("Context ID %lld uses speculative decoding and has too few sequences", context_id);
+            return output;
+        }
+        
+        llama_context* ctx = new_context_like(context_id, n_prompts);
+        if (!ctx) {
+            LOGE("Failed to create a context with %d sequences", n_prompts);
+            return output;
+        }
+        llama_free(contexts[context_id]);
+        contexts[context_id] = ctx;
+    }
+    
+    llama_context* ctx = contexts[context_id];
+    const llama_vocab* vocab = llama_model_get_vocab(llama_get_model(ctx));
+    
+    std::vector<jlong> ids(n_prompts);
+    std::vector<jfloat> scales(n_prompts);
+    env->GetLongArrayRegion(adapter_ids, 0, n_prompts, ids.data());
+    env->GetFloatArrayRegion(adapter_scales, 0, n_prompts, scales.data());
+    
+    std::vector<parallel_request> requests(n_prompts);
+    for (jsize i = 0; i < n_prompts; ++i) {
+        jstring input_text = (jstring) env->GetObjectArrayElement(input_texts, i);
+        const char *input = env->GetStringUTFChars(input_text, 0);
+        
+        std::vector<llama_token> tokens(512);
+        const int n_tokens = llama_tokenize(vocab, input, strlen(input),
+                                            tokens.data(), tokens.size(), true, false);
+        env->ReleaseStringUTFChars(input_text, input);
+        env->DeleteLocalRef(input_text);
+        
+        if (n_tokens <= 0) {
+            LOGE("Tokenization of prompt %d failed with error: %d", i, n_tokens);
+            return output;
+        }
+        tokens.resize(n_tokens);
+        requests[i].prompt = std::move(tokens);
+        
+        if (ids[i] != 0) {
+            auto it = lora_adapters.find(ids[i]);
+            if (it == lora_adapters.end() || it->second.model_id != context_models[context_id]) {
+                LOGE("LoRA adapter ID %lld does not belong to the model of context ID %lld", (long long) ids[i], context_id);
+                return output;
+            }
+            requests[i].adapter = get_lora_adapter(ids[i]);
+            if (!requests[i].adapter) {
+                return output;
+            }
+            requests[i].adapter_scale = scales[i];
+        }
+    }
+    
+    // the adapter of each prompt replaces the one set with setLoraAdapter for this call
+    auto lora_it = context_loras.find(context_id);
+    if (lora_it != context_loras.end()) {
+        llama_clear_adapter_lora(ctx);
+    }
+    
+    std::vector<std::vector<llama_token>> results;
+    speculative_stats stats;
+    if (!parallel_generate(ctx, samplers[context_id], requests, max_tokens, results, stats)) {
+        LOGE("Parallel generation stopped early");
+    }
+    generation_stats[context_id] = stats;
+    
+    if (lora_it != context_loras.end()) {
+        llama_set_adapter_lora(ctx, get_lora_adapter(lora_it->second.first), lora_it->second.second);
+    }
+    
+    for (jsize i = 0; i < n_prompts; ++i) {
+        jstring text = env->NewStringUTF(detokenize(context_pieces(context_id), results[i]).c_str());
+        env->SetObjectArrayElement(output, i, text);
+        env->DeleteLocalRef(text);
+    }
+    
+    return output;
+}
+
+// Size of the embedding vectors of a model, 0 on error
+JNIEXPORT jint JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_getEmbeddingSize(JNIEnv *env, jobject /* this */, jlong model_id) {
+    if (models.find(model_id) == models.end()) {
+        LOGE("Model ID %lld not found", model_id);
+        return 0;
+    }
+    
+    embedding_context* emb = get_embedding_context(model_id);
+    return emb ? embedding_n_embd(emb) : 0;
+}
+
+// Embed many texts at once into a direct ByteBuffer of texts.length * n_embd
+// floats in native byte order. The vectors are pooled and L2-normalized.
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_embedTexts(JNIEnv *env, jobject /* this */,
+                                                     jlong model_id, jobjectArray input_texts, jobject output) {
+    if (models.find(model_id) == models.end()) {
+        LOGE("Model ID %lld not found", model_id);
+        return JNI_FALSE;
+    }
+    
+    embedding_context* emb = get_embedding_context(model_id);
+    if (!emb) {
+        return JNI_FALSE;
+    }
+    
+    const jsize n_texts = env->GetArrayLength(input_texts);
+    float* out = (float*) env->GetDirectBufferAddress(output);
+    const jlong capacity = env->GetDirectBufferCapacity(output);
+    if (!out || capacity < (jlong) n_texts * embedding_n_embd(emb) * (jlong) sizeof(float)) {
+        LOGE("embedTexts needs a direct buffer of %d x %d floats", n_texts, embedding_n_embd(emb));
+        return JNI_FALSE;
+    }
+    
+    std::vector<std::string> texts(n_texts);
+    for (jsize i = 0; i < n_texts; ++i) {
+        jstring input_text = (jstring) env->GetObjectArrayElement(input_texts, i);
+        const char *input = env->GetStringUTFChars(input_text, 0);
+        texts[i] = input;
+        env->ReleaseStringUTFChars(input_text, input);
+        env->DeleteLocalRef(input_text);
+    }
+    
+    return embedding_encode(emb, texts, out) ? JNI_TRUE : JNI_FALSE;
+}
+
+// Telemetry of the last embedTexts call as a JSON object
+JNIEXPORT jstring JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_getEmbeddingStats(JNIEnv *env, jobject /* this */, jlong model_id) {
+    auto it = embedding_contexts.find(model_id);
+    if (it == embedding_contexts.end()) {
+        return env->NewStringUTF("{}");
+    }
+    
+    const embedding_stats &stats = embedding_get_stats(it->second);
+    
+    char json[256];
+    snprintf(json, sizeof(json),
+             "{\"texts\":%d,\"tokens\":%d,\"batches\":%d,\"truncated\":%d,\"texts_per_second\":%.2f}",
+             stats.n_texts, stats.n_tokens, stats.n_batches, stats.n_trunc, stats.texts_per_second());
+    
+    return env->NewStringUTF(json);
+}
+
+// Open a vector index file, creating it when it does not exist yet. type is 0 for
+// int8 (Q8_0) and 1 for F16 storage, n_lists > 0 enables IVF after training.
+JNIEXPORT jlong JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_openVectorIndex(JNIEnv *env, jobject /* this */,
+                                                          jstring index_path, jint dim, jint type, jint n_lists) {
+    const char *path = env->GetStringUTFChars(index_path, 0);
+    
+    vector_index* index = vector_index_open(path);
+    if (!index) {
+        // anything but a missing file (corrupt, other version, no access) is left alone
+        if (access(path, F_OK) != 0 && errno == ENOENT) {
+            index = vector_index_create(path, dim, type == 1 ? GGML_TYPE_F16 : GGML_TYPE_Q8_0, n_lists);
+        } else {
+            LOGE("Failed to open vector index %s", path);
+        }
+    }
+    env->ReleaseStringUTFChars(index_path, path);
+    
+    if (!index) {
+        return 0;
+    }
+    if (vector_index_dim(index) != dim) {
+        LOGE("Vector index has dim %d, expected %d", vector_index_dim(index), dim);
+        vector_index_free(index);
+        return 0;
+    }
+    
+    int64_t index_id = next_id++;
+    vector_indexes[index_id] = index;
+    
+    return index_id;
+}
+
+// Append vectors (a multiple of dim floats), returns the ID of the first one or -1
+JNIEXPORT jlong JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_addVectors(JNIEnv *env, jobject /* this */,
+                                                     jlong index_id, jfloatArray vectors) {
+    auto it = vector_indexes.find(index_id);
+    if (it == vector_indexes.end()) {
+        LOGE("Vector index ID %lld not found", index_id);
+        return -1;
+    }
+    
+    vector_index* index = it->second;
+    const jsize n_floats = env->GetArrayLength(vectors);
+    if (n_floats % vector_index_dim(index) != 0) {
+        LOGE("addVectors got %d floats, not a multiple of %d", n_floats, vector_index_dim(index));
+        return -1;
+    }
+    
+    const int64_t first_id = vector_index_size(index);
+    
+    jfloat* data = env->GetFloatArrayElements(vectors, nullptr);
+    const bool ok = vector_index_add(index, data, n_floats / vector_index_dim(index));
+    env->ReleaseFloatArrayElements(vectors, data, JNI_ABORT);
+    
+    return ok ? first_id : -1;
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_trainVectorIndex(JNIEnv *env, jobject /* this */,
+                                                           jlong index_id, jint n_iter) {
+    auto it = vector_indexes.find(index_id);
+    if (it == vector_indexes.end()) {
+        LOGE("Vector index ID %lld not found", index_id);
+        return JNI_FALSE;
+    }
+    
+    return vector_index_train(it->second, n_iter) ? JNI_TRUE : JNI_FALSE;
+}
+
+// Top-k search, fills ids and scores (length >= k) and returns the number of results
+JNIEXPORT jint JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_searchVectorIndex(JNIEnv *env, jobject /* this */,
+                                                            jlong index_id, jfloatArray query, jint k, jint n_probe,
+                                                            jlongArray ids_out, jfloatArray scores_out) {
+    auto it = vector_indexes.find(index_id);
+    if (it == vector_indexes.end()) {
+        LOGE("Vector index ID %lld not found", index_id);
+        return 0;
+    }
+    
+    vector_index* index = it->second;
+    k = (jint) std::min<int64_t>(k, vector_index_size(index));
+    if (k <= 0) {
+        return 0;
+    }
+    if (env->GetArrayLength(query) != vector_index_dim(index) ||
+        env->GetArrayLength(ids_out) < k || env->GetArrayLength(scores_out) < k) {
+        LOGE("searchVectorIndex got mismatched array sizes");
+        return 0;
+    }
+    
+    std::vector<float> q(vector_index_dim(index));
+    env->GetFloatArrayRegion(query, 0, (jsize) q.size(), q.data());
+    
+    std::vector<int64_t> ids(k);
+    std::vector<float> scores(k);
+    const int32_t n = vector_index_search(index, q.data(), k, n_probe, ids.data(), scores.data());
+    
+    std::vector<jlong> jids(ids.begin(), ids.begin() + n);
+    env->SetLongArrayRegion(ids_out, 0, n, jids.data());
+    env->SetFloatArrayRegion(scores_out, 0, n, scores.data());
+    
+    return n;
+}
+
+JNIEXPORT jlong JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_getVectorIndexSize(JNIEnv *env, jobject /* this */, jlong index_id) {
+    auto it = vector_indexes.find(index_id);
+    return it == vector_indexes.end() ? 0 : vector_index_size(it->second);
+}
+
+JNIEXPORT void JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_closeVectorIndex(JNIEnv *env, jobject /* this */, jlong index_id) {
+    auto it = vector_indexes.find(index_id);
+    if (it != vector_indexes.end()) {
+        vector_index_free(it->second);
+        vector_indexes.erase(it);
+    }
+}
+
+// Keep the conversation of a context in the KV cache: later generateText calls only
+// evaluate the new input and continue after the previous reply. The system prompt
+// and the first n_keep tokens after it are pinned; when the context is full the
+// oldest n_discard tokens after them are dropped (0 = half of the rest).
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_startConversation(JNIEnv *env, jobject /* this */,
+                                                            jlong context_id, jstring system_prompt,
+                                                            jint n_keep, jint n_discard) {
+    if (contexts.find(context_id) == contexts.end()) {
+        LOGE("Context ID %lld not found", context_id);
+        return JNI_FALSE;
+    }
+    if (speculative_sessions.find(context_id) != speculative_sessions.end() ||
+        lookahead_sessions.find(context_id) != lookahead_sessions.end()) {
+        LOGE("Context ID %lld uses speculative decoding", context_id);
+        return JNI_FALSE;
+    }
+    
+    llama_context* ctx = contexts[context_id];
+    const llama_vocab* vocab = llama_model_get_vocab(llama_get_model(ctx));
+    
+    const char *prompt = env->GetStringUTFChars(system_prompt, 0);
+    std::vector<llama_token> tokens(strlen(prompt) + 2);
+    const int n_tokens = llama_tokenize(vocab, prompt, strlen(prompt), tokens.data(), tokens.size(), true, false);
+    env->ReleaseStringUTFChars(system_prompt, prompt);
+    
+    if (n_tokens < 0) {
+        LOGE("Tokenization failed with error: %d", n_tokens);
+        return JNI_FALSE;
+    }
+    tokens.resize(n_tokens);
+    
+    // Plain text turns from here on
+    free_chat_session(context_id);
+    
+    context_shift_params params;
+    params.n_keep = n_tokens + n_keep;
+    params.n_discard = n_discard;
+    
+    auto it = conversations.find(context_id);
+    if (it == conversations.end()) {
+        it = conversations.emplace(context_id, conversation_init(ctx, params)).first;
+    } else {
+        conversation_set_params(it->second, params);
+        conversation_reset(it->second);
+    }
+    
+    if (n_tokens > 0 && !conversation_decode(it->second, tokens.data(), n_tokens)) {
+        LOGE("Failed to decode the system prompt");
+        conversation_free(it->second);
+        conversations.erase(it);
+        return JNI_FALSE;
+    }
+    
+    LOGI("Conversation started on context ID %lld, %d tokens pinned, can shift: %s", context_id,
+         params.n_keep, llama_memory_can_shift(llama_get_memory(ctx)) ? "yes" : "no");
+    return JNI_TRUE;
+}
+
+// Forget the conversation or chat of a context, generateText evaluates each input alone again
+JNIEXPORT void JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_endConversation(JNIEnv *env, jobject /* this */, jlong context_id) {
+    free_chat_session(context_id);
+    
+    auto it = conversations.find(context_id);
+    if (it != conversations.end()) {
+        conversation_free(it->second);
+        conversations.erase(it);
+        llama_memory_clear(llama_get_memory(contexts[context_id]), true);
+    }
+}
+
+// Window of the conversation of a context as a JSON object
+JNIEXPORT jstring JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_getConversationStats(JNIEnv *env, jobject /* this */, jlong context_id) {
+    auto it = conversations.find(context_id);
+    if (it == conversations.end()) {
+        return env->NewStringUTF("{}");
+    }
+    
+    llama_context* ctx = contexts[context_id];
+    const context_shift_stats &stats = conversation_get_stats(it->second);
+    
+    char json[320];
+    snprintf(json, sizeof(json),
+             "{\"n_past\":%zu,\"n_ctx\":%u,\"shifts\":%d,\"discarded\":%d,"
+             "\"reprefilled\":%d,\"can_shift\":%s,\"recurrent\":%s,\"checkpoints\":%d,"
+             "\"rollbacks\":%d,\"state_bytes\":%zu}",
+             conversation_tokens(it->second).size(), llama_n_ctx(ctx), stats.n_shifts,
+             stats.n_discarded, stats.n_reprefilled,
+             llama_memory_can_shift(llama_get_memory(ctx)) ? "true" : "false",
+             llama_model_is_recurrent(llama_get_model(ctx)) ? "true" : "false",
+             conversation_n_checkpoints(it->second), stats.n_rollbacks, stats.state_size);
+    
+    return env->NewStringUTF(json);
+}
+
+// Generate the reply of the last conversation or chat turn again: the conversation
+// goes back to the checkpoint the turn left before its reply
+JNIEXPORT jstring JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_regenerate(JNIEnv *env, jobject /* this */,
+                                                     jlong context_id, jint max_tokens) {
+    auto conv_it = conversations.find(context_id);
+    if (conv_it == conversations.end()) {
+        LOGE("Context ID %lld holds no conversation", context_id);
+        return env->NewStringUTF("");
+    }
+    
+    const int64_t t_start_us = llama_time_us();
+    
+    if (!conversation_rollback(conv_it->second, 1)) {
+        return env->NewStringUTF("");
+    }
+    
+    auto session_it = chat_sessions.find(context_id);
+    const bool is_chat = session_it != chat_sessions.end();
+    if (is_chat) {
+        chat_session_remove_reply(session_it->second);
+    }
+    
+    speculative_stats stats;
+    std::string reply = generate_reply(contexts[context_id], samplers[context_id], conv_it->second,
+                                       context_pieces(context_id), max_tokens, !is_chat, t_start_us, stats);
+    generation_stats[context_id] = stats;
+    
+    if (is_chat) {
+        chat_session_add_reply(session_it->second, reply);
+    }
+    
+    LOGI("Regenerated %d tokens, conversation at %zu tokens", stats.n_generated,
+         conversation_tokens(conv_it->second).size());
+    return env->NewStringUTF(reply.c_str());
+}
+
+// Write the conversation of a context (tokens and KV cache or recurrent state) to a file
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_saveConversation(JNIEnv *env, jobject /* this */,
+                                                           jlong context_id, jstring output_path) {
+    auto it = conversations.find(context_id);
+    if (it == conversations.end()) {
+        LOGE("Context ID %lld holds no conversation", context_id);
+        return JNI_FALSE;
+    }
+    
+    const char *path = env->GetStringUTFChars(output_path, 0);
+    const bool ok = conversation_save_file(it->second, path);
+    env->ReleaseStringUTFChars(output_path, path);
+    
+    return ok ? JNI_TRUE : JNI_FALSE;
+}
+
+// Continue a conversation written by saveConversation with the same model. A chat on
+// the context ends: its messages are not part of the file.
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_loadConversation(JNIEnv *env, jobject /* this */,
+                                                           jlong context_id, jstring input_path,
+                                                           jint n_keep, jint n_discard) {
+    if (contexts.find(context_id) == contexts.end()) {
+        LOGE("Context ID %lld not found", context_id);
+        return JNI_FALSE;
+    }
+    if (speculative_sessions.find(context_id) != speculative_sessions.end() ||
+        lookahead_sessions.find(context_id) != lookahead_sessions.end()) {
+        LOGE("Context ID %lld uses speculative decoding", context_id);
+        return JNI_FALSE;
+    }
+    
+    free_chat_session(context_id);
+    
+    context_shift_params params;
+    params.n_keep = n_keep;
+    params.n_discard = n_discard;
+    
+    auto it = conversations.find(context_id);
+    if (it == conversations.end()) {
+        it = conversations.emplace(context_id, conversation_init(contexts[context_id], params)).first;
+    } else {
+        conversation_set_params(it->second, params);
+    }
+    
+    const char *path = env->GetStringUTFChars(input_path, 0);
+    const bool ok = conversation_load_file(it->second, path);
+    env->ReleaseStringUTFChars(input_path, path);
+    
+    if (!ok) {
+        conversation_free(it->second);
+        conversations.erase(it);
+        return JNI_FALSE;
+    }
+    return JNI_TRUE;
+}
+
+// Time token generation as a conversation grows to n_turns turns of n_turn_tokens
+// tokens. Flat for recurrent models; attention models slow down with the window.
+JNIEXPORT jstring JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_benchmarkConversation(JNIEnv *env, jobject /* this */,
+                                                                jlong context_id, jint n_turns, jint n_turn_tokens) {
+    if (contexts.find(context_id) == contexts.end()) {
+        LOGE("Context ID %lld not found", context_id);
+        return env->NewStringUTF("{}");
+    }
+    if (conversations.find(context_id) != conversations.end() ||
+        speculative_sessions.find(context_id) != speculative_sessions.end() ||
+        lookahead_sessions.find(context_id) != lookahead_sessions.end()) {
+        LOGE("Context ID %lld is in use, the benchmark clears its memory", context_id);
+        return env->NewStringUTF("{}");
+    }
+    if (n_turns <= 0 || n_turn_tokens <= 0) {
+        return env->NewStringUTF("{}");
+    }
+    
+    llama_context* ctx = contexts[context_id];
+    
+    std::vector<double> us_per_token;
+    const bool ok = conversation_benchmark(ctx, context_shift_params(), n_turns, n_turn_tokens, us_per_token);
+    
+    const double first = us_per_token.empty() ? 0.0 : us_per_token.front();
+    const double last = us_per_token.empty() ? 0.0 : us_per_token.back();
+    
+    char json[256];
+    snprintf(json, sizeof(json),
+             "{\"ok\":%s,\"recurrent\":%s,\"turns\":%zu,\"n_ctx\":%u,"
+             "\"first_turn_us_per_token\":%.1f,\"last_turn_us_per_token\":%.1f}",
+             ok ? "true" : "false", llama_model_is_recurrent(llama_get_model(ctx)) ? "true" : "false",
+             us_per_token.size(), llama_n_ctx(ctx), first, last);
+    
+    return env->NewStringUTF(json);
+}
+
+// Start a chat on a context: messages go through the chat template (the model's when
+// chat_template is empty) and are kept in the KV cache like startConversation. Each
+// chat call only tokenizes and evaluates what the template adds for the new message.
+// endConversation ends the chat.
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_startChat(JNIEnv *env, jobject /* this */,
+                                                    jlong context_id, jstring chat_template,
+                                                    jstring system_prompt, jint n_discard) {
+    if (contexts.find(context_id) == contexts.end()) {
+        LOGE("Context ID %lld not found", context_id);
+        return JNI_FALSE;
+    }
+    if (speculative_sessions.find(context_id) != speculative_sessions.end() ||
+        lookahead_sessions.find(context_id) != lookahead_sessions.end()) {
+        LOGE("Context ID %lld uses speculative decoding", context_id);
+        return JNI_FALSE;
+    }
+    
+    llama_context* ctx = contexts[context_id];
+    
+    const char *tmpl = env->GetStringUTFChars(chat_template, 0);
+    chat_session* session = chat_session_init(llama_get_model(ctx), tmpl);
+    env->ReleaseStringUTFChars(chat_template, tmpl);
+    if (!session) {
+        return JNI_FALSE;
+    }
+    
+    free_chat_session(context_id);
+    chat_sessions[context_id] = session;
+    
+    std::vector<llama_token> tokens;
+    bool restart = false;
+    
+    const char *prompt = env->GetStringUTFChars(system_prompt, 0);
+    const bool ok = !*prompt || chat_session_add(session, "system", prompt, false, tokens, restart);
+    env->ReleaseStringUTFChars(system_prompt, prompt);
+    
+    if (!ok) {
+        free_chat_session(context_id);
+        return JNI_FALSE;
+    }
+    
+    // The system turn stays when the window shifts
+    context_shift_params params;
+    params.n_keep = (int32_t) tokens.size();
+    params.n_discard = n_discard;
+    
+    auto it = conversations.find(context_id);
+    if (it == conversations.end()) {
+        it = conversations.emplace(context_id, conversation_init(ctx, params)).first;
+    } else {
+        conversation_set_params(it->second, params);
+        conversation_reset(it->second);
+    }
+    
+    if (!tokens.empty() && !conversation_decode(it->second, tokens.data(), (int32_t) tokens.size())) {
+        LOGE("Failed to decode the system prompt");
+        conversation_free(it->second);
+        conversations.erase(it);
+        free_chat_session(context_id);
+        return JNI_FALSE;
+    }
+    
+    LOGI("Chat started on context ID %lld, %zu system tokens", context_id, tokens.size());
+    return JNI_TRUE;
+}
+
+// Send a user message to the chat of a context and generate the reply
+JNIEXPORT jstring JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_chat(JNIEnv *env, jobject /* this */,
+                                               jlong context_id, jstring message, jint max_tokens) {
+    auto session_it = chat_sessions.find(context_id);
+    if (session_it == chat_sessions.end()) {
+        LOGE("Context ID %lld has no chat", context_id);
+        return env->NewStringUTF("");
+    }
+    
+    llama_context* ctx = contexts[context_id];
+    llama_sampler* sampler = samplers[context_id];
+    conversation* conv = conversations[context_id];
+    chat_session* session = session_it->second;
+    
+    const int64_t t_start_us = llama_time_us();
+    
+    std::vector<llama_token> tokens;
+    bool restart = false;
+    
+    const char *text = env->GetStringUTFChars(message, 0);
+    const bool ok = chat_session_add(session, "user", text, true, tokens, restart);
+    env->ReleaseStringUTFChars(message, text);
+    
+    if (!ok) {
+        return env->NewStringUTF("");
+    }
+    
+    if (restart) {
+        conversation_reset(conv);
+    }
+    
+    if (!conversation_decode_turn(conv, tokens.data(), (int32_t) tokens.size())) {
+        LOGE("Failed to decode input tokens");
+        chat_session_remove_message(session);
+        return env->NewStringUTF("");
+    }
+    
+    speculative_stats stats;
+    std::string reply = generate_reply(ctx, sampler, conv, context_pieces(context_id), max_tokens, false,
+                                       t_start_us, stats);
+    generation_stats[context_id] = stats;
+    
+    chat_session_add_reply(session, reply);
+    
+    LOGI("Chat turn: %zu new tokens, %d generated, conversation at %zu tokens",
+         tokens.size(), stats.n_generated, conversation_tokens(conv).size());
+    return env->NewStringUTF(reply.c_str());
+}
+
+// Prompt processing of the chat of a context as a JSON object
+JNIEXPORT jstring JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_getChatStats(JNIEnv *env, jobject /* this */, jlong context_id) {
+    auto it = chat_sessions.find(context_id);
+    if (it == chat_sessions.end()) {
+        return env->NewStringUTF("{}");
+    }
+    
+    const chat_session_stats &stats = chat_session_get_stats(it->second);
+    
+    char json[256];
+    snprintf(json, sizeof(json),
+             "{\"messages\":%d,\"turn_tokens\":%d,\"tokens\":%lld,\"restarts\":%d,"
+             "\"turn_us\":%lld,\"n_past\":%zu}",
+             stats.n_messages, stats.n_turn_tokens, (long long) stats.n_tokens, stats.n_restarts,
+             (long long) stats.t_last_us, conversation_tokens(conversations[context_id]).size());
+    
+    return env->NewStringUTF(json);
+}
+
+// Convert a model in the background to the quant type that runs fastest on this
+// device and atomically replace output_path with it (output_path may be the input).
+// imatrix_path is a file written by saveImatrix, or empty.
+JNIEXPORT jlong JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_startRequantization(JNIEnv *env, jobject /* this */,
+                                                              jstring input_path, jstring output_path, jint n_threads,
+                                                              jstring imatrix_path) {
+    const char *path_in = env->GetStringUTFChars(input_path, 0);
+    const char *path_out = env->GetStringUTFChars(output_path, 0);
+    const char *path_imatrix = env->GetStringUTFChars(imatrix_path, 0);
+    
+    requant_params params;
+    params.n_threads = n_threads;
+    params.imatrix_path = path_imatrix;
+    
+    requant_job* job = requant_start(path_in, path_out, params);
+    
+    env->ReleaseStringUTFChars(input_path, path_in);
+    env->ReleaseStringUTFChars(output_path, path_out);
+    env->ReleaseStringUTFChars(imatrix_path, path_imatrix);
+    
+    int64_t job_id = next_id++;
+    requant_jobs[job_id] = job;
+    LOGI("Requantization job started with ID: %lld", job_id);
+    return job_id;
+}
+
+// State, progress and benchmark of a requantization job as a JSON object
+JNIEXPORT jstring JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_getRequantizationStatus(JNIEnv *env, jobject /* this */, jlong job_id) {
+    auto it = requant_jobs.find(job_id);
+    if (it == requant_jobs.end()) {
+        return env->NewStringUTF("{}");
+    }
+    
+    return env->NewStringUTF(requant_status_json(it->second).c_str());
+}
+
+// Cancel a running requantization job, or release a finished one
+JNIEXPORT void JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_cancelRequantization(JNIEnv *env, jobject /* this */, jlong job_id) {
+    auto it = requant_jobs.find(job_id);
+    if (it != requant_jobs.end()) {
+        requant_free(it->second);
+        requant_jobs.erase(it);
+    }
+}
+
+// Quantization throughput with 1, 2, 4, ... threads on a synthetic model of n_params
+// weights written to cache_dir, as a JSON object. ftype is a llama_ftype (2 = Q4_0).
+JNIEXPORT jstring JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_benchmarkQuantization(JNIEnv *env, jobject /* this */,
+                                                                jstring cache_dir, jlong n_params,
+                                                                jint ftype, jboolean pin_threads) {
+    const char *dir = env->GetStringUTFChars(cache_dir, 0);
+    
+    int64_t n_params_model = 0;
+    std::vector<requant_bench_point> results;
+    const bool ok = requant_benchmark_threads(dir, n_params, (llama_ftype) ftype, pin_threads == JNI_TRUE,
+                                              n_params_model, results);
+    
+    env->ReleaseStringUTFChars(cache_dir, dir);
+    
+    char json[256];
+    snprintf(json, sizeof(json), "{\"ok\":%s,\"params\":%lld,\"runs\":[",
+             ok ? "true" : "false", (long long) n_params_model);
+    std::string result = json;
+    for (size_t i = 0; i < results.size(); ++i) {
+        // inf or nan would not be valid JSON
+        const double speedup = results[i].t_ms > 0.0 ? results[0].t_ms / results[i].t_ms : 0.0;
+        snprintf(json, sizeof(json),
+                 "%s{\"threads\":%d,\"ms\":%.1f,\"params_per_second\":%.0f,\"speedup\":%.2f}",
+                 i > 0 ? "," : "", results[i].n_threads, results[i].t_ms, results[i].params_per_s, speedup);
+        result += json;
+    }
+    result += "]}";
+    
+    return env->NewStringUTF(result.c_str());
+}
+
+// Collect the importance matrix of the model of a context from now on. The context is
+// recreated with the collector as its graph eval callback (its KV cache is cleared),
+// and later contexts of the model collect too. Batches of fewer than min_tokens tokens
+// are skipped, which keeps single-token generation at full speed.
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_enableImatrixCollection(JNIEnv *env, jobject /* this */,
+                                                                  jlong context_id, jint min_tokens) {
+    if (contexts.find(context_id) == contexts.end()) {
+        LOGE("Context ID %lld not found", context_id);
+        return JNI_FALSE;
+    }
+    if (speculative_sessions.find(context_id) != speculative_sessions.end() ||
+        lookahead_sessions.find(context_id) != lookahead_sessions.end() ||
+        conversations.find(context_id) != conversations.end()) {
+        LOGE("Context ID %lld has an active session, enable imatrix collection before it", context_id);
+        return JNI_FALSE;
+    }
+    
+    const int64_t model_id = context_models[context_id];
+    const bool created = imatrix_collectors.find(model_id) == imatrix_collectors.end();
+    if (created) {
+        imatrix_params params;
+        params.min_tokens = std::max(1, (int) min_tokens);
+        imatrix_collectors[model_id] = imatrix_init(params);
+    }
+    
+    llama_context* old_ctx = contexts[context_id];
+    llama_context* ctx = new_context_like(context_id, llama_n_seq_max(old_ctx));
+    if (!ctx) {
+        LOGE("Failed to create collecting context for context ID %lld", context_id);
+        if (created) {
+            imatrix_free(imatrix_collectors[model_id]);
+            imatrix_collectors.erase(model_id);
+        }
+        return JNI_FALSE;
+    }
+    
+    llama_free(old_ctx);
+    contexts[context_id] = ctx;
+    LOGI("Imatrix collection enabled for model ID %lld", model_id);
+    return JNI_TRUE;
+}
+
+// Write the importance matrix collected for a model so far as a GGUF imatrix file
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_saveImatrix(JNIEnv *env, jobject /* this */,
+                                                      jlong model_id, jstring output_path) {
+    auto it = imatrix_collectors.find(model_id);
+    if (it == imatrix_collectors.end()) {
+        LOGE("No imatrix is collected for model ID %lld", model_id);
+        return JNI_FALSE;
+    }
+    
+    const char *path = env->GetStringUTFChars(output_path, 0);
+    const bool ok = imatrix_save(it->second, path, "on-device chats");
+    env->ReleaseStringUTFChars(output_path, path);
+    
+    return ok ? JNI_TRUE : JNI_FALSE;
+}
+
+// Weights and tokens collected for a model as a JSON object
+JNIEXPORT jstring JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_getImatrixStats(JNIEnv *env, jobject /* this */, jlong model_id) {
+    auto it = imatrix_collectors.find(model_id);
+    if (it == imatrix_collectors.end()) {
+        return env->NewStringUTF("{}");
+    }
+    
+    char json[256];
+    snprintf(json, sizeof(json), "{\"weights\":%d,\"tokens\":%lld}",
+             imatrix_n_entries(it->second), (long long) imatrix_n_tokens(it->second));
+    
+    return env->NewStringUTF(json);
+}
+
+// Start generating a reply to input one token at a time, getNextStreamingToken returns
+// the text of each step. Continues the conversation when one was started on the context.
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_startStreaming(JNIEnv *env, jobject /* this */,
+                                                         jlong context_id, jstring input_text, jint max_tokens) {
+    if (contexts.find(context_id) == contexts.end()) {
+        LOGE("Context ID %lld not found", context_id);
+        return JNI_FALSE;
+    }
+    if (speculative_sessions.find(context_id) != speculative_sessions.end() ||
+        lookahead_sessions.find(context_id) != lookahead_sessions.end()) {
+        LOGE("Context ID %lld uses speculative decoding, streaming is not supported", context_id);
+        return JNI_FALSE;
+    }
+    if (chat_sessions.find(context_id) != chat_sessions.end()) {
+        LOGE("Context ID %lld holds a chat, send messages with chat", context_id);
+        return JNI_FALSE;
+    }
+    
+    llama_context* ctx = contexts[context_id];
+    const llama_vocab* vocab = llama_model_get_vocab(llama_get_model(ctx));
+    auto conv_it = conversations.find(context_id);
+    conversation* conv = conv_it != conversations.end() ? conv_it->second : nullptr;
+    
+    // BOS only at the start of a conversation
+    const bool add_bos = !conv || conversation_tokens(conv).empty();
+    
+    const char *input = env->GetStringUTFChars(input_text, 0);
+    std::vector<llama_token> tokens(strlen(input) + 2);
+    const int n_tokens = llama_tokenize(vocab, input, strlen(input), tokens.data(), tokens.size(), add_bos, false);
+    env->ReleaseStringUTFChars(input_text, input);
+    
+    if (n_tokens < 0) {
+        LOGE("Tokenization failed with error: %d", n_tokens);
+        return JNI_FALSE;
+    }
+    
+    bool ok = true;
+    if (conv) {
+        // the turn leaves a checkpoint for regenerate, like generateText
+        ok = conversation_decode_turn(conv, tokens.data(), n_tokens) && conversation_has_logits(conv);
+    } else {
+        // the input is evaluated alone
+        llama_memory_clear(llama_get_memory(ctx), true);
+        const int n_batch = (int) llama_n_batch(ctx);
+        ok = n_tokens > 0;
+        for (int i = 0; ok && i < n_tokens; i += n_batch) {
+            ok = llama_decode(ctx, llama_batch_get_one(tokens.data() + i, std::min(n_batch, n_tokens - i))) == 0;
+        }
+    }
+    if (!ok) {
+        LOGE("Failed to decode input tokens");
+        return JNI_FALSE;
+    }
+    
+    token_stream*& stream = token_streams[context_id];
+    if (!stream) {
+        stream = new token_stream;
+    }
+    detokenizer_init(stream->detok, context_pieces(context_id));
+    stream->n_remaining = max_tokens;
+    stream->done = max_tokens <= 0;
+    stream->t_start_us = llama_time_us();
+    stream->n_generated = 0;
+    
+    LOGI("Streaming %d input tokens", n_tokens);
+    return JNI_TRUE;
+}
+
+// Generate the next token of the stream and return the text it completes. The text is
+// empty while a character is spread over several tokens.
+JNIEXPORT jstring JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_getNextStreamingToken(JNIEnv *env, jobject /* this */, jlong context_id) {
+    auto it = token_streams.find(context_id);
+    if (it == token_streams.end() || it->second->done) {
+        return env->NewStringUTF("");
+    }
+    
+    token_stream* stream = it->second;
+    llama_context* ctx = contexts[context_id];
+    llama_sampler* sampler = samplers[context_id];
+    
+    const llama_token id = llama_sampler_sample(sampler, ctx, -1);
+    llama_sampler_accept(sampler, id);
+    stream->n_generated++;
+    stream->n_remaining--;
+    
+    stream->text.clear();
+    detokenizer_push(stream->detok, id, stream->text);
+    stream->done = stream->n_remaining <= 0 || llama_vocab_is_eog(llama_model_get_vocab(llama_get_model(ctx)), id);
+    
+    // a conversation keeps the reply tokens, like generateText
+    auto conv_it = conversations.find(context_id);
+    if (conv_it != conversations.end()) {
+        if (!conversation_decode(conv_it->second, &id, 1)) {
+            LOGE("Failed to decode generated token");
+            stream->done = true;
+        }
+    } else if (!stream->done) {
+        llama_token next = id;
+        if (llama_decode(ctx, llama_batch_get_one(&next, 1)) != 0) {
+            LOGE("Failed to decode generated token");
+            stream->done = true;
+        }
+    }
+    
+    if (stream->done) {
+        detokenizer_flush(stream->detok, stream->text);
+        
+        speculative_stats stats;
+        stats.n_steps     = stream->n_generated;
+        stats.n_generated = stream->n_generated;
+        stats.t_gen_us    = llama_time_us() - stream->t_start_us;
+        generation_stats[context_id] = stats;
+    }
+    
+    return env->NewStringUTF(stream->text.c_str());
+}
+
+JNIEXPORT jboolean JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_isStreamingComplete(JNIEnv *env, jobject /* this */, jlong context_id) {
+    auto it = token_streams.find(context_id);
+    return it == token_streams.end() || it->second->done ? JNI_TRUE : JNI_FALSE;
+}
+
+JNIEXPORT void JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_stopStreaming(JNIEnv *env, jobject /* this */, jlong context_id) {
+    auto it = token_streams.find(context_id);
+    if (it != token_streams.end()) {
+        delete it->second;
+        token_streams.erase(it);
+    }
+}
+
+// Telemetry of the last generateText call as a JSON object
+JNIEXPORT jstring JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_getGenerationStats(JNIEnv *env, jobject /* this */, jlong context_id) {
+    auto it = generation_stats.find(context_id);
+    if (it == generation_stats.end()) {
+        return env->NewStringUTF("{}");
+    }
+    
+    const speculative_stats &stats = it->second;
+    
+    char json[256];
+    snprintf(json, sizeof(json),
+             "{\"tokens\":%d,\"steps\":%d,\"drafted\":%d,\"accepted\":%d,"
+             "\"acceptance_rate\":%.3f,\"tokens_per_second\":%.2f}",
+             stats.n_generated, stats.n_steps, stats.n_drafted, stats.n_accepted,
+             stats.acceptance_rate(), stats.tokens_per_second());
+    
+    return env->NewStringUTF(json);
+}
+
+JNIEXPORT void JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_freeContext(JNIEnv *env, jobject /* this */, jlong context_id) {
+    auto spec_it = speculative_sessions.find(context_id);
+    if (spec_it != speculative_sessions.end()) {
+        speculative_free(spec_it->second);
+        speculative_sessions.erase(spec_it);
+    }
+    
+    auto dctx_it = draft_contexts.find(context_id);
+    if (dctx_it != draft_contexts.end()) {
+        llama_free(dctx_it->second);
+        draft_contexts.erase(dctx_it);
+    }
+    
+    auto dmdl_it = draft_models.find(context_id);
+    if (dmdl_it != draft_models.end()) {
+        llama_model_free(dmdl_it->second);
+        draft_models.erase(dmdl_it);
+    }
+    
+    auto la_it = lookahead_sessions.find(context_id);
+    if (la_it != lookahead_sessions.end()) {
+        lookahead_free(la_it->second);
+        lookahead_sessions.erase(la_it);
+    }
+    
+    auto conv_it = conversations.find(context_id);
+    if (conv_it != conversations.end()) {
+        conversation_free(conv_it->second);
+        conversations.erase(conv_it);
+    }
+    
+    free_chat_session(context_id);
+    
+    auto stream_it = token_streams.find(context_id);
+    if (stream_it != token_streams.end()) {
+        delete stream_it->second;
+        token_streams.erase(stream_it);
+    }
+    
+    generation_stats.erase(context_id);
+    context_loras.erase(context_id);
+    context_models.erase(context_id);
+    
+    auto ctx_it = contexts.find(context_id);
+    if (ctx_it != contexts.end()) {
+        llama_free(ctx_it->second);
+        contexts.erase(ctx_it);
+    }
+    
+    auto smp_it = samplers.find(context_id);
+    if (smp_it != samplers.end()) {
+        llama_sampler_free(smp_it->second);
+        samplers.erase(smp_it);
+    }
+    context_sampling.erase(context_id);
+    
+    LOGI("Freed context and sampler with ID: %lld", context_id);
+}
+
+JNIEXPORT void JNICALL
+Java_com_example_gpt_1lite_LlamaCppPlugin_freeModel(JNIEnv *env, jobject /* this */, jlong model_id) {
+    auto emb_it = embedding_contexts.find(model_id);
+    if (emb_it != embedding_contexts.end()) {
+        embedding_free(emb_it->second);
+        embedding_contexts.erase(emb_it);
+    }
+    
+    // adapters are not freed with the model
+    for (auto lora_it = lora_adapters.begin(); lora_it != lora_adapters.end(); ) {
+        if (lora_it->second.model_id == model_id) {
+            if (lora_it->second.adapter) {
+                llama_adapter_lora_free(lora_it->second.adapter);
+            }
+            lora_it = lora_adapters.erase(lora_it);
+        } else {
+            ++lora_it;
+        }
+    }
+    
+    auto im_it = imatrix_collectors.find(model_id);
+    if (im_it != imatrix_collectors.end()) {
+        imatrix_free(im_it->second);
+        imatrix_collectors.erase(im_it);
+    }
+    
+    auto pieces_it = piece_tables.find(model_id);
+    if (pieces_it != piece_tables.end()) {
+        piece_table_free(pieces_it->second);
+        piece_tables.erase(pieces_it);
+    }
+    
     auto it = models.find(model_id);
     if (it != models.end()) {
         llama_free_model(it->second);
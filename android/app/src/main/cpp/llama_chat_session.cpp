@@ -0,0 +1,220 @@
+#include "llama_chat_session.h"
+
+#include <android/log.h>
+#include <cstring>
+
+#define LOG_TAG "LlamaCpp"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+struct chat_session {
+    const llama_vocab * vocab = nullptr;
+    std::string tmpl;
+
+    std::vector<std::string> roles;
+    std::vector<std::string> contents;
+
+    // template text the tokens handed out so far stand for
+    std::string rendered;
+    // rendered before the last reply was recorded
+    std::string rendered_turn;
+    // rendered before the last message was added
+    std::string rendered_message;
+    // the last reply could not be found in the rendered chat
+    bool restart_next = false;
+
+    std::string buf;
+
+    chat_session_stats stats;
+};
+
+chat_session * chat_session_init(const llama_model * model, const char * tmpl) {
+    if (!tmpl || !*tmpl) {
+        tmpl = llama_model_chat_template(model, nullptr);
+    }
+
+    chat_session * session = new chat_session;
+    session->vocab = llama_model_get_vocab(model);
+    session->tmpl  = tmpl ? tmpl : "chatml";
+
+    // reject unsupported templates now rather than on the first message
+    llama_chat_message probe = { "user", "" };
+    if (llama_chat_apply_template(session->tmpl.c_str(), &probe, 1, true, nullptr, 0) < 0) {
+        LOGE("Chat template is not supported");
+        delete session;
+        return nullptr;
+    }
+
+    return session;
+}
+
+void chat_session_free(chat_session * session) {
+    delete session;
+}
+
+void chat_session_reset(chat_session * session) {
+    session->roles.clear();
+    session->contents.clear();
+    session->rendered.clear();
+    session->rendered_turn.clear();
+    session->restart_next = false;
+    session->stats = {};
+}
+
+// Renders all messages into out
+static bool chat_session_render(chat_session * session, bool add_ass, std::string & out) {
+    std::vector<llama_chat_message> chat(session->roles.size());
+    size_t n_chars = 0;
+    for (size_t i = 0; i < chat.size(); ++i) {
+        chat[i].role    = session->roles[i].c_str();
+        chat[i].content = session->contents[i].c_str();
+        n_chars += session->contents[i].size();
+    }
+
+    std::string & buf = session->buf;
+    if (buf.size() < 2*n_chars + 256) {
+        buf.resize(2*n_chars + 256);
+    }
+
+    int32_t n = llama_chat_apply_template(session->tmpl.c_str(), chat.data(), chat.size(), add_ass, &buf[0], (int32_t) buf.size());
+    if (n > (int32_t) buf.size()) {
+        buf.resize(n);
+        n = llama_chat_apply_template(session->tmpl.c_str(), chat.data(), chat.size(), add_ass, &buf[0], (int32_t) buf.size());
+    }
+    if (n < 0) {
+        LOGE("Failed to apply the chat template");
+        return false;
+    }
+
+    out.assign(buf.data(), n);
+    return true;
+}
+
+static bool chat_session_tokenize(const chat_session * session, const std::string & text, bool add_special, std::vector<llama_token> & tokens) {
+    tokens.resize(text.size() + 2);
+    int32_t n = llama_tokenize(session->vocab, text.data(), (int32_t) text.size(), tokens.data(), (int32_t) tokens.size(), add_special, true);
+    if (n < 0) {
+        tokens.resize(-n);
+        n = llama_tokenize(session->vocab, text.data(), (int32_t) text.size(), tokens.data(), (int32_t) tokens.size(), add_special, true);
+    }
+    if (n < 0) {
+        LOGE("Tokenization failed with error: %d", n);
+        return false;
+    }
+    tokens.resize(n);
+    return true;
+}
+
+bool chat_session_add(
+        chat_session             * session,
+        const char               * role,
+        const char               * content,
+        bool                       add_ass,
+        std::vector<llama_token> & tokens,
+        bool                     & restart) {
+    const int64_t t_start_us = llama_time_us();
+
+    session->roles.push_back(role);
+    session->contents.push_back(content);
+
+    std::string full;
+    if (!chat_session_render(session, add_ass, full)) {
+        session->roles.pop_back();
+        session->contents.pop_back();
+        return false;
+    }
+
+    const std::string & rendered = session->rendered;
+    restart = session->restart_next ||
+              full.size() < rendered.size() ||
+              full.compare(0, rendered.size(), rendered) != 0;
+
+    // BOS only in front of the whole chat
+    const size_t n_keep = restart ? 0 : rendered.size();
+    if (!chat_session_tokenize(session, full.substr(n_keep), n_keep == 0, tokens)) {
+        session->roles.pop_back();
+        session->contents.pop_back();
+        return false;
+    }
+
+    if (restart && !rendered.empty()) {
+        LOGI("Chat template changed earlier turns, tokenizing the whole chat again");
+        session->stats.n_restarts++;
+    }
+
+    session->rendered_message = std::move(session->rendered);
+    session->rendered         = std::move(full);
+    session->restart_next     = false;
+
+    session->stats.n_messages    = (int32_t) session->roles.size();
+    session->stats.n_turn_tokens = (int32_t) tokens.size();
+    session->stats.n_tokens     += (int64_t) tokens.size();
+    session->stats.t_last_us     = llama_time_us() - t_start_us;
+
+    return true;
+}
+
+bool chat_session_add_reply(chat_session * session, const std::string & reply) {
+    session->roles.push_back("assistant");
+    session->contents.push_back(reply);
+    session->stats.n_messages = (int32_t) session->roles.size();
+
+    session->rendered_turn = session->rendered;
+
+    std::string full;
+    if (!chat_session_render(session, false, full)) {
+        session->restart_next = true;
+        return false;
+    }
+
+    // Templates may trim the reply; the tokens of the surrounding whitespace are
+    // already evaluated and stay, the next turn continues after the reply text
+    const size_t n_rendered = session->rendered.size();
+    const size_t first = reply.find_first_not_of(" \t\r\n");
+    const std::string text = first == std::string::npos ? "" : reply.substr(first, reply.find_last_not_of(" \t\r\n") - first + 1);
+
+    const size_t pos = full.compare(0, n_rendered, session->rendered) == 0 ? full.find(text, n_rendered) : std::string::npos;
+    if (pos == std::string::npos) {
+        session->restart_next = true;
+        return true;
+    }
+
+    session->rendered.assign(full, 0, pos + text.size());
+    return true;
+}
+
+bool chat_session_remove_reply(chat_session * session) {
+    if (session->roles.empty() || session->roles.back() != "assistant") {
+        LOGE("The chat does not end with a reply");
+        return false;
+    }
+
+    session->roles.pop_back();
+    session->contents.pop_back();
+    session->rendered     = session->rendered_turn;
+    session->restart_next = false;
+    session->stats.n_messages = (int32_t) session->roles.size();
+
+    return true;
+}
+
+bool chat_session_remove_message(chat_session * session) {
+    if (session->roles.empty() || session->roles.back() == "assistant") {
+        LOGE("The chat does not end with a message");
+        return false;
+    }
+
+    session->roles.pop_back();
+    session->contents.pop_back();
+    session->rendered = session->rendered_message;
+    session->stats.n_messages = (int32_t) session->roles.size();
+
+    // part of its tokens may be in the KV cache already
+    session->restart_next = true;
+
+    return true;
+}
+
+const chat_session_stats & chat_session_get_stats(const chat_session * session) {
+    return session->stats;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "llama.h"
+
+#include <string>
+#include <vector>
+
+// Chat turns that only tokenize what they add
+//
+// A chat session keeps the messages of a conversation and the template text that
+// the tokens handed out so far stand for. Adding a message renders the chat with
+// llama_chat_apply_template and cuts off that text; only the rest (the end of the
+// previous turn, the new message and the assistant prefix) is tokenized and handed
+// to the caller, who evaluates it after the tokens already in the KV cache
+// (see llama_context_shift.h). A turn then costs the same however long the chat is.
+//
+// The cut always falls on the end of an earlier turn, so the delta starts with the
+// role markers of the template. Templates that render earlier messages differently
+// once a new one is added (some merge the system prompt into the first user turn)
+// cannot be continued: the session then hands out the whole chat and the caller
+// starts the conversation over.
+
+struct chat_session_stats {
+    int32_t n_messages    = 0;
+    int32_t n_turn_tokens = 0;  // tokens handed out by the last chat_session_add
+    int64_t n_tokens      = 0;  // tokens handed out in total
+    int32_t n_restarts    = 0;  // times the whole chat had to be tokenized again
+    int64_t t_last_us     = 0;  // rendering and tokenization time of the last add
+};
+
+struct chat_session;
+
+// tmpl is a template name or source as accepted by llama_chat_apply_template,
+// nullptr or "" uses the model's template (chatml when it has none)
+chat_session * chat_session_init(const llama_model * model, const char * tmpl);
+void           chat_session_free(chat_session * session);
+
+// Forgets the messages, the next add starts a new chat
+void chat_session_reset(chat_session * session);
+
+// Appends a message and tokenizes the template text it adds, ending with the
+// assistant prefix when add_ass. tokens continue the ones handed out before,
+// unless restart is set: then they hold the whole chat from the beginning.
+// Returns false when the template cannot be applied.
+bool chat_session_add(
+        chat_session             * session,
+        const char               * role,
+        const char               * content,
+        bool                       add_ass,
+        std::vector<llama_token> & tokens,
+        bool                     & restart);
+
+// Records the assistant reply generated after the last add. Its tokens are already
+// evaluated, without the end-of-generation token; the template's end of turn is
+// handed out with the next message.
+bool chat_session_add_reply(chat_session * session, const std::string & reply);
+
+// Forgets the last reply, so the one generated again after a conversation_rollback
+// can be recorded in its place. Returns false when the last message is not a reply.
+bool chat_session_remove_reply(chat_session * session);
+
+// Forgets the message of the last add, when its tokens could not be evaluated. The
+// next add hands out the whole chat, since part of them may have been. Returns false
+// when the last message is a reply.
+bool chat_session_remove_message(chat_session * session);
+
+const chat_session_stats & chat_session_get_stats(const chat_session * session);
@@ -0,0 +1,359 @@
+#include "llama_context_shift.h"
+
+#include <android/log.h>
+#include <algorithm>
+#include <cstdio>
+
+#define LOG_TAG "LlamaCpp"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+// Turn boundary to roll back to: tokens[0, n_past) evaluated, last is evaluated
+// again at n_past
+struct conversation_checkpoint {
+    int32_t     n_past = 0;
+    llama_token last   = 0;
+
+    std::vector<uint8_t> state;  // sequence 0 after n_past tokens, recurrent models only
+};
+
+struct conversation {
+    llama_context * ctx = nullptr;
+    bool recurrent = false;
+
+    context_shift_params params;
+    context_shift_stats  stats;
+
+    llama_batch batch = {};
+
+    std::vector<llama_token> tokens;
+    bool has_logits = false;  // the logits of the last token are in the context
+
+    std::vector<conversation_checkpoint> checkpoints;
+};
+
+// evaluate tokens at positions pos0.., logits only for the last one when requested;
+// returns the llama_decode result
+static int32_t decode_at(conversation * conv, const llama_token * tokens, int32_t n_tokens, llama_pos pos0, bool logits_last) {
+    llama_batch & batch = conv->batch;
+
+    batch.n_tokens = n_tokens;
+    for (int32_t i = 0; i < n_tokens; ++i) {
+        batch.token   [i]    = tokens[i];
+        batch.pos     [i]    = pos0 + i;
+        batch.n_seq_id[i]    = 1;
+        batch.seq_id  [i][0] = 0;
+        batch.logits  [i]    = logits_last && i == n_tokens - 1;
+    }
+
+    const int32_t ret = llama_decode(conv->ctx, batch);
+    conv->has_logits = ret == 0 && logits_last;
+    return ret;
+}
+
+// drop tokens from the middle of the window until n_new more tokens fit
+static bool make_room(conversation * conv, int32_t n_new) {
+    const int32_t n_ctx  = (int32_t) llama_n_ctx(conv->ctx);
+    const int32_t n_past = (int32_t) conv->tokens.size();
+
+    // a recurrent state has a fixed size, positions just keep counting
+    if (conv->recurrent || n_past + n_new <= n_ctx) {
+        return true;
+    }
+
+    const int32_t n_keep = std::min(conv->params.n_keep, n_past);
+    const int32_t n_left = n_past - n_keep;
+
+    int32_t n_discard = conv->params.n_discard > 0 ? conv->params.n_discard : n_left / 2;
+    n_discard = std::max(n_discard, n_past + n_new - n_ctx);
+
+    if (n_discard > n_left) {
+        LOGE("Context shift: %d pinned tokens leave no room for %d new tokens (n_ctx = %d)", n_keep, n_new, n_ctx);
+        return false;
+    }
+
+    llama_memory_t mem = llama_get_memory(conv->ctx);
+
+    conv->stats.n_shifts++;
+    conv->stats.n_discarded += n_discard;
+
+    // checkpoints after the dropped tokens move with them, the ones inside are lost
+    auto & checkpoints = conv->checkpoints;
+    for (size_t i = 0; i < checkpoints.size(); ) {
+        conversation_checkpoint & cp = checkpoints[i];
+        if (cp.n_past <= n_keep) {
+            ++i;
+        } else if (cp.n_past >= n_keep + n_discard) {
+            cp.n_past -= n_discard;
+            ++i;
+        } else {
+            checkpoints.erase(checkpoints.begin() + i);
+        }
+    }
+
+    LOGI("Context shift: dropping %d tokens after the first %d (n_past = %d, n_ctx = %d)", n_discard, n_keep, n_past, n_ctx);
+
+    if (llama_memory_can_shift(mem) && llama_memory_seq_rm(mem, 0, n_keep, n_keep + n_discard)) {
+        llama_memory_seq_add(mem, 0, n_keep + n_discard, -1, -n_discard);
+        conv->tokens.erase(conv->tokens.begin() + n_keep, conv->tokens.begin() + n_keep + n_discard);
+        return true;
+    }
+
+    // the cached keys cannot be moved: evaluate what is left of the window again
+    llama_memory_clear(mem, true);
+    conv->tokens.erase(conv->tokens.begin() + n_keep, conv->tokens.begin() + n_keep + n_discard);
+
+    const int32_t n_batch = (int32_t) llama_n_batch(conv->ctx);
+    const int32_t n_kept  = (int32_t) conv->tokens.size();
+
+    for (int32_t i = 0; i < n_kept; i += n_batch) {
+        const int32_t n = std::min(n_batch, n_kept - i);
+        if (decode_at(conv, conv->tokens.data() + i, n, i, false) != 0) {
+            LOGE("Context shift: failed to evaluate the kept tokens again");
+            conv->tokens.clear();
+            llama_memory_clear(mem, true);
+            return false;
+        }
+    }
+
+    conv->stats.n_reprefilled += n_kept;
+    return true;
+}
+
+conversation * conversation_init(llama_context * ctx, const context_shift_params & params) {
+    conversation * conv = new conversation;
+
+    conv->ctx       = ctx;
+    conv->recurrent = llama_model_is_recurrent(llama_get_model(ctx));
+    conv->params    = params;
+    conv->batch  = llama_batch_init((int32_t) llama_n_batch(ctx), 0, 1);
+
+    conversation_reset(conv);
+
+    return conv;
+}
+
+void conversation_free(conversation * conv) {
+    if (!conv) {
+        return;
+    }
+
+    llama_batch_free(conv->batch);
+    delete conv;
+}
+
+void conversation_reset(conversation * conv) {
+    llama_memory_clear(llama_get_memory(conv->ctx), true);
+
+    conv->tokens.clear();
+    conv->has_logits = false;
+    conv->checkpoints.clear();
+    conv->stats = {};
+}
+
+void conversation_set_params(conversation * conv, const context_shift_params & params) {
+    conv->params = params;
+}
+
+bool conversation_decode(conversation * conv, const llama_token * tokens, int32_t n_tokens) {
+    int32_t n_batch = (int32_t) llama_n_batch(conv->ctx);
+
+    for (int32_t i = 0; i < n_tokens; ) {
+        const int32_t n = std::min(n_batch, n_tokens - i);
+
+        if (!make_room(conv, n)) {
+            return false;
+        }
+
+        const llama_pos n_past = (llama_pos) conv->tokens.size();
+        const int32_t ret = decode_at(conv, tokens + i, n, n_past, i + n == n_tokens);
+        if (ret == 1 && n > 1) {
+            // the cells freed by shifts are not contiguous: evaluate smaller pieces
+            n_batch = n / 2;
+            continue;
+        }
+        if (ret != 0) {
+            LOGE("Failed to decode %d tokens at position %d", n, n_past);
+            return false;
+        }
+
+        conv->tokens.insert(conv->tokens.end(), tokens + i, tokens + i + n);
+        i += n;
+    }
+
+    return true;
+}
+
+bool conversation_decode_turn(conversation * conv, const llama_token * tokens, int32_t n_tokens) {
+    if (n_tokens <= 0) {
+        return true;
+    }
+
+    conversation_checkpoint cp;
+    cp.last = tokens[n_tokens - 1];
+
+    if (conv->recurrent && conv->params.n_checkpoints > 0) {
+        // the state has to be copied before the last token changes it
+        if (!conversation_decode(conv, tokens, n_tokens - 1)) {
+            return false;
+        }
+
+        cp.state.resize(llama_state_seq_get_size(conv->ctx, 0));
+        cp.state.resize(llama_state_seq_get_data(conv->ctx, cp.state.data(), cp.state.size(), 0));
+        conv->stats.state_size = cp.state.size();
+
+        if (!conversation_decode(conv, tokens + n_tokens - 1, 1)) {
+            return false;
+        }
+    } else if (!conversation_decode(conv, tokens, n_tokens)) {
+        return false;
+    }
+
+    if (conv->params.n_checkpoints <= 0) {
+        return true;
+    }
+
+    cp.n_past = (int32_t) conv->tokens.size() - 1;
+
+    auto & checkpoints = conv->checkpoints;
+    checkpoints.push_back(std::move(cp));
+    if ((int32_t) checkpoints.size() > conv->params.n_checkpoints) {
+        checkpoints.erase(checkpoints.begin(), checkpoints.end() - conv->params.n_checkpoints);
+    }
+
+    return true;
+}
+
+bool conversation_rollback(conversation * conv, int32_t n) {
+    auto & checkpoints = conv->checkpoints;
+    if (n < 1 || n > (int32_t) checkpoints.size()) {
+        LOGE("Rollback: %d turns back, %zu checkpoints", n, checkpoints.size());
+        return false;
+    }
+
+    const conversation_checkpoint & cp = checkpoints[checkpoints.size() - n];
+
+    if (conv->recurrent) {
+        if (llama_state_seq_set_data(conv->ctx, cp.state.data(), cp.state.size(), 0) == 0) {
+            LOGE("Rollback: failed to restore the recurrent state");
+            return false;
+        }
+    } else if (!llama_memory_seq_rm(llama_get_memory(conv->ctx), 0, cp.n_past, -1)) {
+        LOGE("Rollback: failed to remove the tokens after position %d", cp.n_past);
+        return false;
+    }
+
+    conv->tokens.resize(cp.n_past);
+
+    if (decode_at(conv, &cp.last, 1, cp.n_past, true) != 0) {
+        LOGE("Rollback: failed to decode the last token of the turn");
+        conv->tokens.clear();
+        conv->checkpoints.clear();
+        llama_memory_clear(llama_get_memory(conv->ctx), true);
+        return false;
+    }
+    conv->tokens.push_back(cp.last);
+
+    checkpoints.resize(checkpoints.size() - n + 1);
+    conv->stats.n_rollbacks++;
+
+    return true;
+}
+
+int32_t conversation_n_checkpoints(const conversation * conv) {
+    return (int32_t) conv->checkpoints.size();
+}
+
+bool conversation_save_file(const conversation * conv, const char * path) {
+    const size_t n = llama_state_seq_save_file(conv->ctx, path, 0, conv->tokens.data(), conv->tokens.size());
+    if (n == 0) {
+        LOGE("Failed to save the conversation to %s", path);
+        return false;
+    }
+
+    LOGI("Saved %zu tokens of conversation, %zu bytes", conv->tokens.size(), n);
+    return true;
+}
+
+bool conversation_load_file(conversation * conv, const char * path) {
+    FILE * f = fopen(path, "rb");
+    if (!f) {
+        LOGE("Failed to open %s", path);
+        return false;
+    }
+    fseek(f, 0, SEEK_END);
+    const long size = ftell(f);
+    fclose(f);
+
+    // the file holds the tokens, so it bounds their count
+    std::vector<llama_token> tokens(std::max<long>(size, 0) / sizeof(llama_token));
+    size_t n_tokens = 0;
+
+    conversation_reset(conv);
+
+    if (llama_state_seq_load_file(conv->ctx, path, 0, tokens.data(), tokens.size(), &n_tokens) == 0) {
+        LOGE("Failed to load the conversation from %s", path);
+        llama_memory_clear(llama_get_memory(conv->ctx), true);
+        return false;
+    }
+
+    tokens.resize(n_tokens);
+    conv->tokens = std::move(tokens);
+
+    LOGI("Loaded %zu tokens of conversation", n_tokens);
+    return true;
+}
+
+const std::vector<llama_token> & conversation_tokens(const conversation * conv) {
+    return conv->tokens;
+}
+
+bool conversation_has_logits(const conversation * conv) {
+    return conv->has_logits;
+}
+
+const context_shift_stats & conversation_get_stats(const conversation * conv) {
+    return conv->stats;
+}
+
+bool conversation_benchmark(llama_context * ctx, const context_shift_params & params, int32_t n_turns,
+                            int32_t n_turn_tokens, std::vector<double> & us_per_token) {
+    const int32_t n_vocab = llama_vocab_n_tokens(llama_model_get_vocab(llama_get_model(ctx)));
+    const int32_t n_steps = 16;
+
+    conversation * conv = conversation_init(ctx, params);
+
+    std::vector<llama_token> tokens(n_turn_tokens);
+    uint32_t seed = 1;
+
+    us_per_token.clear();
+    bool ok = true;
+
+    for (int32_t turn = 0; turn < n_turns && ok; ++turn) {
+        for (llama_token & id : tokens) {
+            seed = seed * 1664525u + 1013904223u;
+            id = (llama_token) ((seed >> 8) % n_vocab);
+        }
+        ok = conversation_decode_turn(conv, tokens.data(), n_turn_tokens);
+
+        // generation after the turn, one token per decode
+        const int64_t t_start_us = llama_time_us();
+        for (int32_t i = 0; i < n_steps && ok; ++i) {
+            const llama_token id = tokens[i % n_turn_tokens];
+            ok = conversation_decode(conv, &id, 1);
+        }
+        us_per_token.push_back((double) (llama_time_us() - t_start_us) / n_steps);
+    }
+
+    if (ok && !us_per_token.empty()) {
+        LOGI("Conversation benchmark: %.1f us/token after the first turn, %.1f after %zu tokens",
+             us_per_token.front(), us_per_token.back(), conversation_tokens(conv).size());
+    } else {
+        LOGE("Conversation benchmark: decoding failed");
+    }
+
+    conversation_free(conv);
+    llama_memory_clear(llama_get_memory(ctx), true);
+
+    return ok;
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "llama.h"
+
+#include <vector>
+
+// Conversations longer than the context window
+//
+// A conversation keeps every evaluated token of sequence 0 in the KV cache, so a
+// new turn only evaluates its own tokens. When the next tokens do not fit in n_ctx,
+// the first n_keep tokens (system prompt and pinned instructions) stay and the
+// oldest n_discard tokens after them are dropped with llama_memory_seq_rm; the
+// remaining cells are moved back with llama_memory_seq_add, and the K-shift
+// (RoPE re-rotation of the cached keys) is applied by the next llama_decode.
+// Nothing is re-evaluated, so the cost of a token does not depend on how long
+// the conversation has been running.
+//
+// Memories that cannot shift (llama_memory_can_shift() == false) fall back to
+// clearing the cache and evaluating the kept tokens again.
+//
+// Recurrent models (Mamba, RWKV) keep one fixed-size state per sequence instead of
+// a cache entry per token, so there is no window: positions keep counting and the
+// memory and the cost of a token stay the same however long the conversation is.
+//
+// Turns evaluated with conversation_decode_turn leave a checkpoint right before
+// their last token, and conversation_rollback goes back to one of them to generate
+// the reply again. For attention models a checkpoint is a position: the later
+// cells are removed with llama_memory_seq_rm. A recurrent state cannot be cut
+// back, so the checkpoint holds a copy of it (llama_state_seq_get_data, the same
+// size on every turn). Either way a rollback evaluates a single token to get the
+// logits of the turn back.
+
+struct context_shift_params {
+    int32_t n_keep    = 0;  // tokens pinned at the start of the conversation
+    int32_t n_discard = 0;  // tokens dropped per shift, 0 = half of the unpinned tokens
+    int32_t n_checkpoints = 4;  // latest turn checkpoints kept for conversation_rollback
+};
+
+struct context_shift_stats {
+    int32_t n_shifts      = 0;  // times the window was moved
+    int32_t n_discarded   = 0;  // tokens dropped in total
+    int32_t n_reprefilled = 0;  // tokens evaluated again because the memory cannot shift
+    int32_t n_rollbacks   = 0;
+    size_t  state_size    = 0;  // bytes of a recurrent state checkpoint, 0 for attention models
+};
+
+struct conversation;
+
+// Clears the KV cache of ctx, which the conversation then owns until it is freed
+conversation * conversation_init(llama_context * ctx, const context_shift_params & params);
+void           conversation_free(conversation * conv);
+
+// Clears the KV cache and the token history, the params are kept
+void conversation_reset(conversation * conv);
+
+void conversation_set_params(conversation * conv, const context_shift_params & params);
+
+// Evaluates tokens after the conversation, in n_batch chunks, shifting the window
+// when needed. The logits of the last token are available afterwards with
+// llama_get_logits_ith(ctx, -1). Returns false if the tokens cannot be placed
+// (the pinned tokens leave no room) or a llama_decode call fails.
+bool conversation_decode(conversation * conv, const llama_token * tokens, int32_t n_tokens);
+
+// Like conversation_decode, and records a checkpoint before the last token
+bool conversation_decode_turn(conversation * conv, const llama_token * tokens, int32_t n_tokens);
+
+// Goes back to the n-th latest checkpoint (1 = the last turn) and drops the newer
+// ones; the logits of the last token of that turn are available afterwards.
+// Checkpoints inside tokens dropped by a context shift are gone.
+bool    conversation_rollback(conversation * conv, int32_t n);
+int32_t conversation_n_checkpoints(const conversation * conv);
+
+// Writes the tokens and the memory of the conversation to a file, or replaces them
+// with the ones of a file written for the same model. Checkpoints are not saved.
+// The logits are not restored either: evaluate the next input before sampling.
+bool conversation_save_file(const conversation * conv, const char * path);
+bool conversation_load_file(conversation * conv, const char * path);
+
+// Tokens currently in the KV cache, token i is at position i
+const std::vector<llama_token> & conversation_tokens(const conversation * conv);
+
+// Whether the logits of the last token can be sampled: false after a reset, a load
+// or a failed decode, until the next input is evaluated
+bool conversation_has_logits(const conversation * conv);
+
+const context_shift_stats & conversation_get_stats(const conversation * conv);
+
+// Times single-token decoding after each of n_turns turns of n_turn_tokens tokens in
+// a conversation on ctx, whose memory is cleared before and after. us_per_token[i]
+// is the mean decode time of a token after turn i.
+bool conversation_benchmark(llama_context * ctx, const context_shift_params & params, int32_t n_turns,
+                            int32_t n_turn_tokens, std::vector<double> & us_per_token);
@@ -665,6 +665,48 @@ void llama_context::clear_adapter_lora() {
     loras.clear();
 }
 
+void llama_context::set_adapter_lora_seq(
+            llama_adapter_lora * adapter,
+            llama_seq_id seq_id,
+            float scale) {
+    LLAMA_LOG_DEBUG("%s: adapter = %p, seq_id = %d, scale = %f\n", __func__, (void *) adapter, seq_id, scale);
+
+    loras_seq[seq_id][adapter] = scale;
+}
+
+bool llama_context::rm_adapter_lora_seq(
+            llama_adapter_lora * adapter,
+            llama_seq_id seq_id) {
+    LLAMA_LOG_DEBUG("%s: adapter = %p, seq_id = %d\n", __func__, (void *) adapter, seq_id);
+
+    auto it = loras_seq.find(seq_id);
+    if (it == loras_seq.end()) {
+        return false;
+    }
+
+    auto pos = it->second.find(adapter);
+    if (pos == it->second.end()) {
+        return false;
+    }
+
+    it->second.erase(pos);
+    if (it->second.empty()) {
+        loras_seq.erase(it);
+    }
+
+    return true;
+}
+
+void llama_context::clear_adapter_lora_seq(llama_seq_id seq_id) {
+    LLAMA_LOG_DEBUG("%s: seq_id = %d\n", __func__, seq_id);
+
+    if (seq_id < 0) {
+        loras_seq.clear();
+    } else {
+        loras_seq.erase(seq_id);
+    }
+}
+
 bool llama_context::apply_adapter_cvec(
             const float * data,
                  size_t   len,
@@ -1385,6 +1427,7 @@ llm_graph_result_ptr llama_context::graph_build(
                 /*.backend_cpu =*/ backend_cpu,
                 /*.cvec        =*/ &cvec,
                 /*.loras       =*/ &loras,
+                /*.loras_seq   =*/ &loras_seq,
                 /*.mstate      =*/ mstate,
                 /*.cross       =*/ &cross,
                 /*.n_outputs   =*/ n_outputs,
@@ -2408,6 +2451,33 @@ void llama_clear_adapter_lora(llama_context * ctx) {
     ctx->clear_adapter_lora();
 }
 
+int32_t llama_set_adapter_lora_seq(
+            llama_context * ctx,
+            llama_adapter_lora * adapter,
+            llama_seq_id seq_id,
+            float scale) {
+    if (seq_id < 0) {
+        return -1;
+    }
+
+    ctx->set_adapter_lora_seq(adapter, seq_id, scale);
+
+    return 0;
+}
+
+int32_t llama_rm_adapter_lora_seq(
+            llama_context * ctx,
+            llama_adapter_lora * adapter,
+            llama_seq_id seq_id) {
+    bool res = ctx->rm_adapter_lora_seq(adapter, seq_id);
+
+    return res ? 0 : -1;
+}
+
+void llama_clear_adapter_lora_seq(llama_context * ctx, llama_seq_id seq_id) {
+    ctx->clear_adapter_lora_seq(seq_id);
+}
+
 int32_t llama_apply_adapter_cvec(
         llama_context * ctx,
                  const float * data,
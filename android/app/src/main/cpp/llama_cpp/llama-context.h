@@ -85,6 +85,17 @@ struct llama_context {
 
     void clear_adapter_lora();
 
+    void set_adapter_lora_seq(
+            llama_adapter_lora * adapter,
+            llama_seq_id seq_id,
+            float scale);
+
+    bool rm_adapter_lora_seq(
+            llama_adapter_lora * adapter,
+            llama_seq_id seq_id);
+
+    void clear_adapter_lora_seq(llama_seq_id seq_id);
+
     bool apply_adapter_cvec(
             const float * data,
                  size_t   len,
@@ -226,6 +237,8 @@ private:
     llama_adapter_cvec  cvec;
     llama_adapter_loras loras;
 
+    llama_adapter_loras_seq loras_seq;
+
     llama_cross cross; // TODO: tmp for handling cross-attention - need something better probably
 
     std::unique_ptr<llama_memory_i> memory;
@@ -903,6 +903,242 @@ llama_grammar_candidates llama_grammar_reject_candidates_for_stack(
     return rejects;
 }
 
+//
+// token trie
+//
+
+// smallest candidate set for which a token mask is computed
+#define LLAMA_GRAMMAR_MASK_MIN_CANDIDATES 1024
+
+// max number of grammar states with a cached token mask
+#define LLAMA_GRAMMAR_MASK_CACHE_SIZE 256
+
+// prefix trie over the code points of all the pieces in the vocabulary, decoded from a clean UTF-8 state
+// nodes, edges and tokens are stored in flat arrays: the edges and tokens of a node are contiguous
+struct llama_grammar_token_trie {
+    struct node {
+        uint32_t edge_begin;
+        uint32_t edge_end;
+        uint32_t tok_begin;   // tokens that end at this node
+        uint32_t tok_end;
+        uint32_t part_begin;  // tokens that end at this node with an incomplete UTF-8 sequence
+        uint32_t part_end;
+    };
+
+    struct edge {
+        uint32_t chr;
+        uint32_t child;
+    };
+
+    struct partial_token {
+        llama_token        id;
+        llama_partial_utf8 partial_utf8;
+    };
+
+    uint32_t n_vocab = 0;
+
+    std::vector<node>          nodes;
+    std::vector<edge>          edges;
+    std::vector<llama_token>   tokens;
+    std::vector<partial_token> partials;
+
+    std::vector<llama_token> eog;
+};
+
+struct llama_grammar_trie_entry {
+    llama_token           id;
+    std::vector<uint32_t> code_points; // without the terminating 0
+    llama_partial_utf8    partial_utf8;
+};
+
+// builds the node for entries[i0, i1), which share their first `depth` code points
+static uint32_t llama_grammar_trie_build_node(
+        llama_grammar_token_trie                    & trie,
+        const std::vector<llama_grammar_trie_entry> & entries,
+        size_t i0, size_t i1, size_t depth) {
+    const uint32_t node_id = trie.nodes.size();
+    trie.nodes.push_back({});
+
+    // entries are sorted, so the ones that end here come first
+    size_t i = i0;
+
+    trie.nodes[node_id].tok_begin  = trie.tokens.size();
+    trie.nodes[node_id].part_begin = trie.partials.size();
+    for (; i < i1 && entries[i].code_points.size() == depth; ++i) {
+        if (entries[i].partial_utf8.n_remain == 0) {
+            trie.tokens.push_back(entries[i].id);
+        } else {
+            trie.partials.push_back({ entries[i].id, entries[i].partial_utf8 });
+        }
+    }
+    trie.nodes[node_id].tok_end  = trie.tokens.size();
+    trie.nodes[node_id].part_end = trie.partials.size();
+
+    // reserve the edges first so that they stay contiguous
+    std::vector<std::pair<size_t, size_t>> ranges;
+    for (size_t j = i; j < i1; ) {
+        size_t k = j + 1;
+        while (k < i1 && entries[k].code_points[depth] == entries[j].code_points[depth]) {
+            ++k;
+        }
+        ranges.emplace_back(j, k);
+        j = k;
+    }
+
+    const uint32_t edge_begin = trie.edges.size();
+    trie.edges.resize(trie.edges.size() + ranges.size());
+    trie.nodes[node_id].edge_begin = edge_begin;
+    trie.nodes[node_id].edge_end   = edge_begin + ranges.size();
+
+    for (size_t r = 0; r < ranges.size(); ++r) {
+        const uint32_t chr   = entries[ranges[r].first].code_points[depth];
+        const uint32_t child = llama_grammar_trie_build_node(trie, entries, ranges[r].first, ranges[r].second, depth + 1);
+        trie.edges[edge_begin + r] = { chr, child };
+    }
+
+    return node_id;
+}
+
+static std::shared_ptr<const llama_grammar_token_trie> llama_grammar_trie_build(const llama_vocab & vocab) {
+    auto trie = std::make_shared<llama_grammar_token_trie>();
+    trie->n_vocab = vocab.n_tokens();
+
+    std::vector<llama_grammar_trie_entry> entries;
+    entries.reserve(trie->n_vocab);
+
+    for (uint32_t id = 0; id < trie->n_vocab; ++id) {
+        if (vocab.is_eog(id)) {
+            trie->eog.push_back(id);
+            continue;
+        }
+
+        const std::string & piece = vocab.token_to_piece(id);
+        if (piece.empty() || piece[0] == 0) {
+            continue;
+        }
+
+        auto decoded = decode_utf8(piece, { 0, 0 });
+        if (decoded.second.n_remain < 0) {
+            // invalid UTF-8, never accepted
+            continue;
+        }
+
+        decoded.first.pop_back();
+        entries.push_back({ (llama_token) id, std::move(decoded.first), decoded.second });
+    }
+
+    std::sort(entries.begin(), entries.end(), [](const llama_grammar_trie_entry & a, const llama_grammar_trie_entry & b) {
+        return a.code_points < b.code_points;
+    });
+
+    llama_grammar_trie_build_node(*trie, entries, 0, entries.size(), 0);
+
+    return trie;
+}
+
+static inline void llama_grammar_mask_set(llama_grammar_token_mask & mask, llama_token id) {
+    mask[id >> 6] |= uint64_t(1) << (id & 63);
+}
+
+// marks the tokens in the subtree of node_id that the stack accepts; subtrees whose first
+// code point does not match the top of the stack are skipped as a whole
+// same semantics as llama_grammar_reject_candidates_for_stack
+static void llama_grammar_trie_walk(
+        const llama_grammar_rules      & rules,
+        const llama_grammar_token_trie & trie,
+        uint32_t                         node_id,
+        const llama_grammar_stack      & stack,
+        llama_grammar_token_mask       & mask) {
+    const auto & node = trie.nodes[node_id];
+
+    for (uint32_t i = node.tok_begin; i < node.tok_end; ++i) {
+        llama_grammar_mask_set(mask, trie.tokens[i]);
+    }
+
+    if (stack.empty()) {
+        return;
+    }
+
+    const llama_grammar_element * stack_pos = stack.back();
+
+    for (uint32_t i = node.part_begin; i < node.part_end; ++i) {
+        if (llama_grammar_match_partial_char(stack_pos, trie.partials[i].partial_utf8)) {
+            llama_grammar_mask_set(mask, trie.partials[i].id);
+        }
+    }
+
+    llama_grammar_stacks next_stacks;
+    bool advanced = false;
+
+    for (uint32_t i = node.edge_begin; i < node.edge_end; ++i) {
+        const auto & e = trie.edges[i];
+        if (!llama_grammar_match_char(stack_pos, e.chr).first) {
+            continue;
+        }
+
+        if (!advanced) {
+            const auto * stack_pos_after = llama_grammar_match_char(stack_pos, 0).second;
+
+            llama_grammar_stack stack_after(stack.begin(), stack.end() - 1);
+            if (!llama_grammar_is_end_of_sequence(stack_pos_after)) {
+                stack_after.push_back(stack_pos_after);
+            }
+            llama_grammar_advance_stack(rules, stack_after, next_stacks);
+            advanced = true;
+        }
+
+        for (const auto & next_stack : next_stacks) {
+            llama_grammar_trie_walk(rules, trie, e.child, next_stack, mask);
+        }
+    }
+}
+
+static llama_grammar_token_mask llama_grammar_compute_mask(const struct llama_grammar & grammar) {
+    const auto & trie = *grammar.token_trie;
+
+    llama_grammar_token_mask mask((trie.n_vocab + 63) / 64, 0);
+
+    bool allow_eog = false;
+    for (const auto & stack : grammar.stacks) {
+        if (stack.empty()) {
+            allow_eog = true;
+        }
+        llama_grammar_trie_walk(grammar.rules, trie, 0, stack, mask);
+    }
+
+    if (allow_eog) {
+        for (const llama_token id : trie.eog) {
+            llama_grammar_mask_set(mask, id);
+        }
+    }
+
+    return mask;
+}
+
+// sets the logits of the tokens not in the mask to -INFINITY
+// branchless so that the compiler can vectorize the loop
+static void llama_grammar_apply_mask(const llama_grammar_token_mask & mask, llama_token_data_array * cur_p) {
+    llama_token_data * data = cur_p->data;
+
+    for (size_t i = 0; i < cur_p->size; ++i) {
+        const llama_token id      = data[i].id;
+        const bool        allowed = (mask[id >> 6] >> (id & 63)) & 1;
+
+        data[i].logit = allowed ? data[i].logit : -INFINITY;
+    }
+}
+
+size_t llama_grammar_stacks_hash::operator()(const llama_grammar_stacks & stacks) const {
+    size_t seed = stacks.size();
+    for (const auto & stack : stacks) {
+        seed ^= stack.size() + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        for (const auto * pos : stack) {
+            seed ^= std::hash<const void *>{}(pos) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        }
+    }
+    return seed;
+}
+
 ////////////////////
 
 struct llama_grammar * llama_grammar_init_impl(
@@ -970,6 +1206,8 @@ struct llama_grammar * llama_grammar_init_impl(
         /* .trigger_buffer = */   "",
         /* .trigger_tokens   = */ {},
         /* .trigger_patterns    = */ {},
+        /* .token_trie = */       {},
+        /* .token_masks = */      {},
     };
 }
 
@@ -1075,6 +1313,8 @@ struct llama_grammar * llama_grammar_init_impl(
         /* .trigger_buffer = */   "",
         std::move(vec_trigger_tokens),
         std::move(vec_trigger_patterns),
+        /* .token_trie = */       {},
+        /* .token_masks = */      {},
     };
 }
 
@@ -1097,6 +1337,8 @@ struct llama_grammar * llama_grammar_clone_impl(const struct llama_grammar & gra
         grammar.trigger_buffer,
         grammar.trigger_tokens,
         grammar.trigger_patterns,
+        grammar.token_trie,
+        /* .token_masks = */ {}, // keyed by stacks that point into the old rules
     };
 
     // redirect elements in stacks to point to new rules
@@ -1122,6 +1364,25 @@ void llama_grammar_apply_impl(const struct llama_grammar & grammar, llama_token_
         return;
     }
 
+    // the trie is decoded from a clean UTF-8 state, fall back to checking each candidate otherwise.
+    // computing a new mask walks the trie for the full vocabulary, only worth it for large candidate sets
+    if (grammar.partial_utf8.n_remain == 0) {
+        auto it = grammar.token_masks.find(grammar.stacks);
+        if (it == grammar.token_masks.end() && cur_p->size >= LLAMA_GRAMMAR_MASK_MIN_CANDIDATES) {
+            if (!grammar.token_trie) {
+                grammar.token_trie = llama_grammar_trie_build(*grammar.vocab);
+            }
+            if (grammar.token_masks.size() >= LLAMA_GRAMMAR_MASK_CACHE_SIZE) {
+                grammar.token_masks.clear();
+            }
+            it = grammar.token_masks.emplace(grammar.stacks, llama_grammar_compute_mask(grammar)).first;
+        }
+        if (it != grammar.token_masks.end()) {
+            llama_grammar_apply_mask(it->second, cur_p);
+            return;
+        }
+    }
+
     bool allow_eog = false;
     for (const auto & stack : grammar.stacks) {
         if (stack.empty()) {
@@ -3,11 +3,14 @@
 #include "llama.h"
 
 #include <map>
+#include <memory>
 #include <regex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 struct llama_vocab;
+struct llama_grammar_token_trie;
 
 // grammar element type
 enum llama_gretype {
@@ -61,6 +64,13 @@ using llama_grammar_rules      = std::vector<llama_grammar_rule>;
 using llama_grammar_stacks     = std::vector<llama_grammar_stack>;
 using llama_grammar_candidates = std::vector<llama_grammar_candidate>;
 
+struct llama_grammar_stacks_hash {
+    size_t operator()(const llama_grammar_stacks & stacks) const;
+};
+
+// one bit per token, set if the token is allowed by the grammar
+using llama_grammar_token_mask = std::vector<uint64_t>;
+
 // TODO: remove, needed for tests atm
 const llama_grammar_rules  & llama_grammar_get_rules (const struct llama_grammar * grammar);
       llama_grammar_stacks & llama_grammar_get_stacks(      struct llama_grammar * grammar);
@@ -132,6 +142,12 @@ struct llama_grammar {
                              trigger_patterns;         // Regular expressions that trigger a lazy grammar. Must be a full match of the entire generated
                                                        // string, and the grammar will be given the string from the first match group onwards.
 
+    // prefix trie of the decoded vocabulary, built on first use and shared with clones and resets
+    mutable std::shared_ptr<const llama_grammar_token_trie> token_trie;
+
+    // allowed-token masks per set of stacks, reused whenever the grammar returns to a state
+    // note: keyed by pointers into `rules`, so they are never copied to another grammar
+    mutable std::unordered_map<llama_grammar_stacks, llama_grammar_token_mask, llama_grammar_stacks_hash> token_masks;
 };
 
 //
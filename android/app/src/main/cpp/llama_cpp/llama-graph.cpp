@@ -8,6 +8,7 @@
 #include "llama-kv-cache-unified-iswa.h"
 #include "llama-kv-cache-recurrent.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <cstring>
@@ -125,6 +126,48 @@ void llm_graph_input_out_ids::set_input(const llama_ubatch * ubatch) {
     }
 }
 
+void llm_graph_input_lora_seq::set_input(const llama_ubatch * ubatch) {
+    const int64_t n_tokens = ubatch->n_tokens;
+
+    std::vector<float> data(n_tokens);
+    std::vector<float> data_out;
+
+    for (const auto & as : adapters) {
+        for (int64_t i = 0; i < n_tokens; ++i) {
+            data[i] = 0.0f;
+
+            const auto it = loras_seq->find(ubatch->seq_id[i][0]);
+            if (it != loras_seq->end()) {
+                const auto pos = it->second.find(as.adapter);
+                if (pos != it->second.end()) {
+                    data[i] = pos->second;
+                }
+            }
+        }
+
+        if (as.scale->buffer) {
+            ggml_backend_tensor_set(as.scale, data.data(), 0, n_tokens*ggml_element_size(as.scale));
+        }
+
+        if (as.scale_out != as.scale && as.scale_out->buffer) {
+            // same row selection as llm_graph_input_out_ids
+            data_out.clear();
+            if (ubatch->output) {
+                for (int64_t i = 0; i < n_tokens; ++i) {
+                    if (ubatch->output[i]) {
+                        data_out.push_back(data[i]);
+                    }
+                }
+            } else {
+                data_out.push_back(data[n_tokens - 1]);
+            }
+            GGML_ASSERT((int32_t) data_out.size() == n_outputs);
+
+            ggml_backend_tensor_set(as.scale_out, data_out.data(), 0, n_outputs*ggml_element_size(as.scale_out));
+        }
+    }
+}
+
 void llm_graph_input_mean::set_input(const llama_ubatch * ubatch) {
     if (cparams.embeddings && cparams.pooling_type == LLAMA_POOLING_TYPE_MEAN) {
         const int64_t n_tokens     = ubatch->n_tokens;
@@ -435,11 +478,47 @@ llm_graph_context::llm_graph_context(const llm_graph_params & params) :
     backend_cpu      (params.backend_cpu),
     cvec             (params.cvec),
     loras            (params.loras),
+    loras_seq        (params.loras_seq),
     mstate           (params.mstate),
     cross            (params.cross),
     cb_func          (params.cb),
     res              (std::make_unique<llm_graph_result>()) {
+    if (loras_seq && !loras_seq->empty() && ubatch.seq_id) {
+        // adapters of the sequences present in this ubatch
+        std::vector<llama_adapter_lora *> adapters;
+        for (int32_t i = 0; i < n_tokens; ++i) {
+            const auto it = loras_seq->find(ubatch.seq_id[i][0]);
+            if (it == loras_seq->end()) {
+                continue;
+            }
+            for (const auto & lora : it->second) {
+                if (std::find(adapters.begin(), adapters.end(), lora.first) == adapters.end()) {
+                    adapters.push_back(lora.first);
+                }
+            }
+        }
+
+        if (!adapters.empty()) {
+            auto inp = std::make_unique<llm_graph_input_lora_seq>(loras_seq, n_outputs);
+
+            for (auto * adapter : adapters) {
+                ggml_tensor * scale = ggml_new_tensor_2d(ctx0, GGML_TYPE_F32, 1, n_tokens);
+                ggml_set_input(scale);
+
+                ggml_tensor * scale_out = scale;
+                if (n_outputs != n_tokens && n_outputs > 0) {
+                    scale_out = ggml_new_tensor_2d(ctx0, GGML_TYPE_F32, 1, n_outputs);
+                    ggml_set_input(scale_out);
+                }
+
+                inp->adapters.push_back({ adapter, scale, scale_out });
+            }
+
+            inp_lora_seq = inp.get();
+            res->add_input(std::move(inp));
+        }
     }
+}
 
 int64_t llm_graph_context::n_pos_per_embd() const {
     return hparams.rope_type == LLAMA_ROPE_TYPE_MROPE ? 4 : 1;
@@ -457,6 +536,18 @@ ggml_tensor * llm_graph_context::build_cvec(
     return cvec->apply_to(ctx0, cur, il);
 }
 
+ggml_tensor * llm_graph_context::build_lora_seq_scale(
+        const llm_graph_input_lora_seq::adapter_scale & as,
+                                              int64_t   n_rows) const {
+    if (n_rows == n_tokens) {
+        return as.scale;
+    }
+
+    GGML_ASSERT(n_rows == n_outputs && "rows must be the tokens or the outputs of the ubatch");
+
+    return as.scale_out;
+}
+
 ggml_tensor * llm_graph_context::build_lora_mm(
           ggml_tensor * w,
           ggml_tensor * cur) const {
@@ -480,6 +571,27 @@ ggml_tensor * llm_graph_context::build_lora_mm(
         res = ggml_add(ctx0, res, ab_cur);
     }
 
+    if (inp_lora_seq) {
+        for (const auto & as : inp_lora_seq->adapters) {
+            llama_adapter_lora_weight * lw = as.adapter->get_weight(w);
+            if (lw == nullptr) {
+                continue;
+            }
+
+            // the adapter scale of each sequence is in the per-token scales
+            const float scale = lw->get_scale(as.adapter->alpha, 1.0f);
+
+            ggml_tensor * ab_cur = ggml_mul_mat(
+                    ctx0, lw->b,
+                    ggml_mul_mat(ctx0, lw->a, cur)
+                    );
+
+            ab_cur = ggml_scale(ctx0, ab_cur, scale);
+            ab_cur = ggml_mul(ctx0, ab_cur, build_lora_seq_scale(as, ab_cur->ne[1]));
+            res = ggml_add(ctx0, res, ab_cur);
+        }
+    }
+
     return res;
 }
 
@@ -508,6 +620,33 @@ ggml_tensor * llm_graph_context::build_lora_mm_id(
         res = ggml_add(ctx0, res, ab_cur);
     }
 
+    if (inp_lora_seq) {
+        for (const auto & as : inp_lora_seq->adapters) {
+            llama_adapter_lora_weight * lw = as.adapter->get_weight(w);
+            if (lw == nullptr) {
+                continue;
+            }
+
+            const float alpha = as.adapter->alpha;
+            const float rank  = (float) lw->b->ne[0];
+            const float scale = alpha ? alpha / rank : 1.0f;
+
+            ggml_tensor * ab_cur = ggml_mul_mat_id(
+                    ctx0, lw->b,
+                    ggml_mul_mat_id(ctx0, lw->a, cur, ids),
+                    ids
+                    );
+
+            // [n_out, n_expert_used, n_tokens]
+            ggml_tensor * seq_scale = build_lora_seq_scale(as, ab_cur->ne[2]);
+            seq_scale = ggml_reshape_3d(ctx0, seq_scale, 1, 1, ab_cur->ne[2]);
+
+            ab_cur = ggml_scale(ctx0, ab_cur, scale);
+            ab_cur = ggml_mul(ctx0, ab_cur, seq_scale);
+            res = ggml_add(ctx0, res, ab_cur);
+        }
+    }
+
     return res;
 }
 
@@ -869,6 +1008,26 @@ ggml_tensor * llm_graph_context::build_inp_embd(ggml_tensor * tok_embd) const {
 
             cur = ggml_add(ctx0, cur, inpL_delta);
         }
+
+        if (inp_lora_seq) {
+            for (const auto & as : inp_lora_seq->adapters) {
+                llama_adapter_lora_weight * lw = as.adapter->get_weight(tok_embd);
+                if (lw == nullptr) {
+                    continue;
+                }
+
+                const float scale = lw->get_scale(as.adapter->alpha, 1.0f);
+
+                ggml_tensor * inpL_delta = ggml_scale(ctx0, ggml_mul_mat(
+                            ctx0, lw->b, // non-transposed lora_b
+                            ggml_get_rows(ctx0, lw->a, inp->tokens)
+                            ), scale);
+
+                inpL_delta = ggml_mul(ctx0, inpL_delta, build_lora_seq_scale(as, inpL_delta->ne[1]));
+
+                cur = ggml_add(ctx0, cur, inpL_delta);
+            }
+        }
     } else {
         inp->embd = ggml_new_tensor_2d(ctx0, GGML_TYPE_F32, n_embd, ubatch.n_tokens);
         ggml_set_input(inp->embd);
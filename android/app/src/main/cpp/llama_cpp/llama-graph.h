@@ -164,6 +164,30 @@ public:
     const int32_t n_outputs;
 };
 
+// per-token scales of the LoRA adapters selected for the sequences in the ubatch
+class llm_graph_input_lora_seq : public llm_graph_input_i {
+public:
+    llm_graph_input_lora_seq(
+            const llama_adapter_loras_seq * loras_seq,
+            int32_t n_outputs) : loras_seq(loras_seq), n_outputs(n_outputs) {}
+    virtual ~llm_graph_input_lora_seq() = default;
+
+    void set_input(const llama_ubatch * ubatch) override;
+
+    struct adapter_scale {
+        llama_adapter_lora * adapter;
+
+        ggml_tensor * scale;     // F32 [1, n_batch],   0.0f for the tokens of other sequences
+        ggml_tensor * scale_out; // F32 [1, n_outputs], same for the output rows
+    };
+
+    std::vector<adapter_scale> adapters;
+
+    const llama_adapter_loras_seq * loras_seq;
+
+    const int32_t n_outputs;
+};
+
 class llm_graph_input_mean : public llm_graph_input_i {
 public:
     llm_graph_input_mean(const llama_cparams & cparams) : cparams(cparams) {}
@@ -373,10 +397,11 @@ struct llm_graph_params {
     ggml_backend_sched_t sched;
     ggml_backend_t backend_cpu;
 
-    const llama_adapter_cvec   * cvec;
-    const llama_adapter_loras  * loras;
-    const llama_memory_state_i * mstate;
-    const llama_cross          * cross;
+    const llama_adapter_cvec      * cvec;
+    const llama_adapter_loras     * loras;
+    const llama_adapter_loras_seq * loras_seq;
+    const llama_memory_state_i    * mstate;
+    const llama_cross             * cross;
 
     int32_t n_outputs;
 
@@ -425,15 +450,19 @@ struct llm_graph_context {
 
     ggml_backend_t backend_cpu; // TODO: needed by build_attn_mha, figure out a way to remove?
 
-    const llama_adapter_cvec   * cvec;
-    const llama_adapter_loras  * loras;
-    const llama_memory_state_i * mstate;
-    const llama_cross          * cross;
+    const llama_adapter_cvec      * cvec;
+    const llama_adapter_loras     * loras;
+    const llama_adapter_loras_seq * loras_seq;
+    const llama_memory_state_i    * mstate;
+    const llama_cross             * cross;
 
     const llm_graph_cb & cb_func;
 
     std::unique_ptr<llm_graph_result> res;
 
+    // owned by res, nullptr if no sequence in the ubatch has its own adapters
+    llm_graph_input_lora_seq * inp_lora_seq = nullptr;
+
     llm_graph_context(const llm_graph_params & params);
 
     int64_t n_pos_per_embd() const;
@@ -448,6 +477,12 @@ struct llm_graph_context {
              ggml_tensor * cur,
                      int   il) const;
 
+    // per-token scales of a sequence adapter, F32 [1, n_rows]
+    // n_rows is either the number of tokens or, after the unused outputs are skipped, the number of outputs
+    ggml_tensor * build_lora_seq_scale(
+            const llm_graph_input_lora_seq::adapter_scale & as,
+                                                  int64_t   n_rows) const;
+
     // do mat_mul, while optionally apply lora
     ggml_tensor * build_lora_mm(
               ggml_tensor * w,
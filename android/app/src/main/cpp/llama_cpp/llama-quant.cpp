@@ -5,15 +5,26 @@
 #include "llama-model-loader.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <cstring>
 #include <cinttypes>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <fstream>
+#include <functional>
+#include <map>
 #include <mutex>
 #include <regex>
 #include <thread>
 #include <unordered_map>
 
+#if defined(__linux__)
+#include <sched.h>
+#include <unistd.h>
+#endif
+
 // Quantization types. Changes to this struct must be replicated in quantize.cpp
 struct tensor_quantization {
     std::string name;
@@ -54,8 +65,222 @@ struct quantize_state_impl {
         {}
 };
 
+// CPUs this process may run on, in the order the quantization threads are pinned:
+// fastest cores first (the big cores of big.LITTLE phones), one node at a time on NUMA
+static std::vector<int> quantize_cpu_order() {
+    std::vector<int> order;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) != 0) {
+        return order;
+    }
+
+    struct cpu_info {
+        int  cpu;
+        int  node;
+        long freq;
+    };
+    std::vector<cpu_info> cpus;
+
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+        if (!CPU_ISSET(cpu, &set)) {
+            continue;
+        }
+        cpu_info info = { cpu, 0, 0 };
+        for (int node = 0; node < 64; ++node) {
+            if (access(format("/sys/devices/system/cpu/cpu%d/node%d", cpu, node).c_str(), F_OK) == 0) {
+                info.node = node;
+                break;
+            }
+        }
+        std::ifstream freq(format("/sys/devices/system/cpu/cpu%d/cpufreq/cpuinfo_max_freq", cpu));
+        freq >> info.freq;
+        cpus.push_back(info);
+    }
+
+    std::stable_sort(cpus.begin(), cpus.end(), [](const cpu_info & a, const cpu_info & b) { return a.freq > b.freq; });
+
+    std::map<int, std::deque<int>> nodes;
+    for (const auto & info : cpus) {
+        nodes[info.node].push_back(info.cpu);
+    }
+    while (order.size() < cpus.size()) {
+        for (auto & node : nodes) {
+            if (!node.second.empty()) {
+                order.push_back(node.second.front());
+                node.second.pop_front();
+            }
+        }
+    }
+#endif
+    return order;
+}
+
+static void quantize_pin_thread(int cpu) {
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        LLAMA_LOG_WARN("%s: failed to pin a thread to CPU %d\n", __func__, cpu);
+    }
+#else
+    GGML_UNUSED(cpu);
+#endif
+}
+
+// workers that live for the whole quantization instead of being created per tensor
+// the calling thread takes part in every run as thread 0
+// with cpus, worker i is pinned to cpus[i - 1]; the calling thread is left alone since the
+// reader and writer threads are started from it and would inherit its affinity
+struct quantize_thread_pool {
+    quantize_thread_pool(int n_threads, const std::vector<int> & cpus) {
+        for (int i = 1; i < n_threads; ++i) {
+            const int cpu = cpus.empty() ? -1 : cpus[(i - 1) % cpus.size()];
+            workers.emplace_back([this, i, cpu]() {
+                if (cpu >= 0) {
+                    quantize_pin_thread(cpu);
+                }
+                worker(i);
+            });
+        }
+    }
+
+    ~quantize_thread_pool() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stop = true;
+        }
+        cv_start.notify_all();
+        for (auto & w : workers) {
+            w.join();
+        }
+    }
+
+    int size() const {
+        return (int) workers.size() + 1;
+    }
+
+    // call fn(ith) for ith in [0, n) and wait for all calls to return
+    void run(int n, const std::function<void(int)> & fn) {
+        GGML_ASSERT(n <= size());
+        if (n < 2) {
+            fn(0);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            job       = &fn;
+            n_job     = n;
+            n_pending = n - 1;
+            generation++;
+        }
+        cv_start.notify_all();
+
+        fn(0);
+
+        std::unique_lock<std::mutex> lock(mutex);
+        cv_done.wait(lock, [this]() { return n_pending == 0; });
+        job = nullptr;
+    }
+
+private:
+    void worker(int ith) {
+        uint64_t seen = 0;
+        while (true) {
+            const std::function<void(int)> * fn;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv_start.wait(lock, [&]() { return stop || generation != seen; });
+                if (stop) {
+                    return;
+                }
+                seen = generation;
+                if (ith >= n_job) {
+                    continue;
+                }
+                fn = job;
+            }
+
+            (*fn)(ith);
+
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                n_pending--;
+            }
+            cv_done.notify_one();
+        }
+    }
+
+    std::vector<std::thread> workers;
+
+    std::mutex              mutex;
+    std::condition_variable cv_start;
+    std::condition_variable cv_done;
+
+    const std::function<void(int)> * job = nullptr;
+
+    int      n_job      = 0;
+    int      n_pending  = 0;
+    uint64_t generation = 0;
+    bool     stop       = false;
+};
+
+// blocking FIFO that hands the tensors from one stage of the quantization pipeline to the next
+template <typename T>
+struct quantize_queue {
+    void push(T item) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (aborted) {
+                return;
+            }
+            items.push_back(item);
+        }
+        cv.notify_one();
+    }
+
+    // false once the queue is closed and empty, or as soon as it is aborted
+    bool pop(T & item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [this]() { return aborted || closed || !items.empty(); });
+        if (aborted || items.empty()) {
+            return false;
+        }
+        item = items.front();
+        items.pop_front();
+        return true;
+    }
+
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+        }
+        cv.notify_all();
+    }
+
+    void abort() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            aborted = true;
+        }
+        cv.notify_all();
+    }
+
+private:
+    std::mutex              mutex;
+    std::condition_variable cv;
+    std::deque<T>           items;
+
+    bool closed  = false;
+    bool aborted = false;
+};
+
 static void llama_tensor_dequantize_impl(
-    ggml_tensor * tensor, std::vector<no_init<float>> & output, std::vector<std::thread> & workers,
+    ggml_tensor * tensor, std::vector<no_init<float>> & output, quantize_thread_pool & pool,
     const size_t nelements, const int nthread
 ) {
     if (output.size() < nelements) {
@@ -101,29 +326,21 @@ static void llama_tensor_dequantize_impl(
     size_t blocks_per_thread = nblocks / nthread;
     size_t spare_blocks = nblocks - (blocks_per_thread * nthread); // if blocks aren't divisible by thread count
 
-    size_t in_buff_offs = 0;
-    size_t out_buff_offs = 0;
-
-    for (int tnum = 0; tnum < nthread; tnum++) {
+    pool.run(nthread, [&](int tnum) {
         size_t thr_blocks = blocks_per_thread + (tnum == nthread - 1 ? spare_blocks : 0); // num blocks for this thread
         size_t thr_elems = thr_blocks * block_size; // number of elements for this thread
-        size_t thr_block_bytes = thr_blocks * block_size_bytes; // number of input bytes for this thread
 
-        auto compute = [qtype] (ggml_type typ, uint8_t * inbuf, float * outbuf, int nels) {
-            if (typ == GGML_TYPE_F16) {
-                ggml_fp16_to_fp32_row((ggml_fp16_t *)inbuf, outbuf, nels);
-            } else if (typ == GGML_TYPE_BF16) {
-                ggml_bf16_to_fp32_row((ggml_bf16_t *)inbuf, outbuf, nels);
-            } else {
-                qtype->to_float(inbuf, outbuf, nels);
-            }
-        };
-        workers.emplace_back(compute, tensor->type, (uint8_t *) tensor->data + in_buff_offs, f32_output + out_buff_offs, thr_elems);
-        in_buff_offs += thr_block_bytes;
-        out_buff_offs += thr_elems;
-    }
-    for (auto & w : workers) { w.join(); }
-    workers.clear();
+        const uint8_t * inbuf  = (const uint8_t *) tensor->data + tnum * blocks_per_thread * block_size_bytes;
+        float         * outbuf = f32_output + tnum * blocks_per_thread * block_size;
+
+        if (tensor->type == GGML_TYPE_F16) {
+            ggml_fp16_to_fp32_row((const ggml_fp16_t *)inbuf, outbuf, thr_elems);
+        } else if (tensor->type == GGML_TYPE_BF16) {
+            ggml_bf16_to_fp32_row((const ggml_bf16_t *)inbuf, outbuf, thr_elems);
+        } else {
+            qtype->to_float(inbuf, outbuf, thr_elems);
+        }
+    });
 }
 
 static ggml_type llama_tensor_get_type(quantize_state_impl & qs, ggml_type new_type, const ggml_tensor * tensor, llama_ftype ftype) {
@@ -416,7 +633,7 @@ static ggml_type llama_tensor_get_type(quantize_state_impl & qs, ggml_type new_t
     return new_type;
 }
 
-static size_t llama_tensor_quantize_impl(enum ggml_type new_type, const float * f32_data, void * new_data, const int64_t chunk_size, int64_t nrows, int64_t n_per_row, const float * imatrix, std::vector<std::thread> & workers, const int nthread) {
+static size_t llama_tensor_quantize_impl(enum ggml_type new_type, const float * f32_data, void * new_data, const int64_t chunk_size, int64_t nrows, int64_t n_per_row, const float * imatrix, quantize_thread_pool & pool, const int nthread) {
     if (nthread < 2) {
         // single-thread
         size_t new_size = ggml_quantize_chunk(new_type, f32_data, new_data, 0, nrows, n_per_row, imatrix);
@@ -426,47 +643,48 @@ static size_t llama_tensor_quantize_impl(enum ggml_type new_type, const float *
         return new_size;
     }
 
-    std::mutex mutex;
-    int64_t counter = 0;
-    size_t new_size = 0;
-    bool valid = true;
-    auto compute = [&mutex, &counter, &new_size, &valid, new_type, f32_data, new_data, chunk_size,
-            nrows, n_per_row, imatrix]() {
+    // the threads claim chunks of rows with an atomic increment and sum the sizes
+    // of their chunks in their own cache line
+    struct alignas(64) thread_size {
+        size_t size = 0;
+    };
+
+    std::atomic<int64_t> counter { 0 };
+    std::atomic<bool>    valid   { true };
+
+    std::vector<thread_size> sizes(nthread);
+
+    auto compute = [&counter, &valid, &sizes, new_type, f32_data, new_data, chunk_size,
+            nrows, n_per_row, imatrix](int ith) {
         const int64_t nrows_per_chunk = chunk_size / n_per_row;
+        const size_t  row_size        = ggml_row_size(new_type, n_per_row);
         size_t local_size = 0;
-        while (true) {
-            std::unique_lock<std::mutex> lock(mutex);
-            int64_t first_row = counter; counter += nrows_per_chunk;
+        while (valid.load(std::memory_order_relaxed)) {
+            const int64_t first_row = counter.fetch_add(nrows_per_chunk, std::memory_order_relaxed);
             if (first_row >= nrows) {
-                if (local_size > 0) {
-                    new_size += local_size;
-                }
                 break;
             }
-            lock.unlock();
             const int64_t this_nrow = std::min(nrows - first_row, nrows_per_chunk);
             size_t this_size = ggml_quantize_chunk(new_type, f32_data, new_data, first_row * n_per_row, this_nrow, n_per_row, imatrix);
             local_size += this_size;
 
             // validate the quantized data
-            const size_t row_size  = ggml_row_size(new_type, n_per_row);
             void * this_data = (char *) new_data + first_row * row_size;
             if (!ggml_validate_row_data(new_type, this_data, this_size)) {
-                std::unique_lock<std::mutex> lock(mutex);
-                valid = false;
+                valid.store(false, std::memory_order_relaxed);
                 break;
             }
         }
+        sizes[ith].size = local_size;
     };
-    for (int it = 0; it < nthread - 1; ++it) {
-        workers.emplace_back(compute);
-    }
-    compute();
-    for (auto & w : workers) { w.join(); }
-    workers.clear();
+    pool.run(nthread, compute);
     if (!valid) {
         throw std::runtime_error("quantized data validation failed");
     }
+    size_t new_size = 0;
+    for (const auto & s : sizes) {
+        new_size += s.size;
+    }
     return new_size;
 }
 
@@ -645,13 +863,25 @@ static void llama_model_quantize_impl(const std::string & fname_inp, const std::
     size_t total_size_org = 0;
     size_t total_size_new = 0;
 
-    std::vector<std::thread> workers;
-    workers.reserve(nthread);
+    size_t total_size_inp = 0;
+    for (const auto * it : tensors) {
+        total_size_inp += ggml_nbytes(it->tensor);
+    }
+
+    std::vector<int> cpus;
+    if (params->pin_threads) {
+        cpus = quantize_cpu_order();
+        std::string list;
+        for (int i = 0; i < std::min(nthread - 1, (int) cpus.size()); ++i) {
+            list += (i > 0 ? "," : "") + std::to_string(cpus[i]);
+        }
+        LLAMA_LOG_INFO("%s: pinning %d worker threads, CPU order: %s\n", __func__, nthread - 1, list.c_str());
+    }
+
+    quantize_thread_pool pool(nthread, cpus);
 
     int idx = 0;
 
-    std::vector<no_init<uint8_t>> read_data;
-    std::vector<no_init<uint8_t>> work;
     std::vector<no_init<float>> f32_conv_buf;
 
     uint16_t n_split = 1;
@@ -684,6 +914,14 @@ static void llama_model_quantize_impl(const std::string & fname_inp, const std::
         }
     }
 
+    // The tensor types and data change while the writer thread opens the splits, but
+    // not the size of the meta data, so it is taken here. A split's meta data is only
+    // written once the writer gets to the next split, after all its tensors are done.
+    std::vector<size_t> meta_sizes(n_split);
+    for (size_t i = 0; i < ctx_outs.size(); ++i) {
+        meta_sizes[i] = ctx_outs[i] ? gguf_get_meta_size(ctx_outs[i].get()) : 0;
+    }
+
     int cur_split = -1;
     std::ofstream fout;
     auto close_ofstream = [&]() {
@@ -708,215 +946,311 @@ static void llama_model_quantize_impl(const std::string & fname_inp, const std::
 
         fout = std::ofstream(fname, std::ios::binary);
         fout.exceptions(std::ofstream::failbit); // fail fast on write errors
-        const size_t meta_size = gguf_get_meta_size(ctx_outs[cur_split].get());
         // placeholder for the meta data
-        ::zeros(fout, meta_size);
+        ::zeros(fout, meta_sizes[cur_split]);
+    };
+
+    // The tensors go through a three-stage pipeline: a reader thread loads the next
+    // tensor (with mmap, the validation of its data faults the pages in), this thread
+    // converts the current one on the thread pool and a writer thread writes out the
+    // previous one. A slot holds the buffers of one tensor in flight; with one slot
+    // per stage, memory use is bounded by three times the largest tensor.
+    struct quantize_slot {
+        const llama_model_loader::llama_tensor_weight * weight = nullptr;
+
+        std::vector<no_init<uint8_t>> read_data;
+        std::vector<no_init<uint8_t>> work;
+
+        const void * new_data = nullptr;
+        size_t       new_size = 0;
+    };
+
+    constexpr int n_slots = 3;
+
+    std::vector<quantize_slot> slots(n_slots);
+
+    quantize_queue<quantize_slot *> free_slots;
+    quantize_queue<quantize_slot *> loaded;
+    quantize_queue<quantize_slot *> converted;
+
+    for (auto & slot : slots) {
+        free_slots.push(&slot);
+    }
+
+    std::mutex         error_mutex;
+    std::exception_ptr error;
+
+    auto fail = [&](std::exception_ptr e) {
+        {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            if (!error) {
+                error = e;
+            }
+        }
+        free_slots.abort();
+        loaded.abort();
+        converted.abort();
     };
 
     const auto tn = LLM_TN(model.arch);
     new_ofstream(0);
-    for (const auto * it : tensors) {
-        const auto & weight = *it;
-        ggml_tensor * tensor = weight.tensor;
-        if (weight.idx != cur_split && params->keep_split) {
-            close_ofstream();
-            new_ofstream(weight.idx);
+
+    std::thread reader([&]() {
+        try {
+            for (const auto * it : tensors) {
+                quantize_slot * slot;
+                if (!free_slots.pop(slot)) {
+                    return;
+                }
+                slot->weight = it;
+
+                ggml_tensor * tensor = it->tensor;
+                if (!ml.use_mmap) {
+                    if (slot->read_data.size() < ggml_nbytes(tensor)) {
+                        slot->read_data.resize(ggml_nbytes(tensor));
+                    }
+                    tensor->data = slot->read_data.data();
+                }
+                ml.load_data_for(tensor);
+
+                loaded.push(slot);
+            }
+            loaded.close();
+        } catch (...) {
+            fail(std::current_exception());
         }
+    });
+
+    std::thread writer([&]() {
+        try {
+            quantize_slot * slot;
+            while (converted.pop(slot)) {
+                if (slot->weight->idx != cur_split && params->keep_split) {
+                    close_ofstream();
+                    new_ofstream(slot->weight->idx);
+                }
 
-        const std::string name = ggml_get_name(tensor);
+                // write tensor data + padding
+                fout.write((const char *) slot->new_data, slot->new_size);
+                zeros(fout, GGML_PAD(slot->new_size, align) - slot->new_size);
 
-        if (!ml.use_mmap) {
-            if (read_data.size() < ggml_nbytes(tensor)) {
-                read_data.resize(ggml_nbytes(tensor));
+                free_slots.push(slot);
             }
-            tensor->data = read_data.data();
-        }
-        ml.load_data_for(tensor);
-
-        LLAMA_LOG_INFO("[%4d/%4d] %36s - [%s], type = %6s, ",
-               ++idx, ml.n_tensors,
-               ggml_get_name(tensor),
-               llama_format_tensor_shape(tensor).c_str(),
-               ggml_type_name(tensor->type));
-
-        // This used to be a regex, but <regex> has an extreme cost to compile times.
-        bool quantize = name.rfind("weight") == name.size() - 6; // ends with 'weight'?
-
-        // quantize only 2D and 3D tensors (experts)
-        quantize &= (ggml_n_dims(tensor) >= 2);
-
-        // do not quantize norm tensors
-        quantize &= name.find("_norm.weight") == std::string::npos;
-
-        quantize &= params->quantize_output_tensor || name != "output.weight";
-        quantize &= !params->only_copy;
-
-        // do not quantize expert gating tensors
-        // NOTE: can't use LLM_TN here because the layer number is not known
-        quantize &= name.find("ffn_gate_inp.weight") == std::string::npos;
-
-        // do not quantize positional embeddings and token types (BERT)
-        quantize &= name != LLM_TN(model.arch)(LLM_TENSOR_POS_EMBD,    "weight");
-        quantize &= name != LLM_TN(model.arch)(LLM_TENSOR_TOKEN_TYPES, "weight");
-
-        // do not quantize Mamba's small yet 2D weights
-        // NOTE: can't use LLM_TN here because the layer number is not known
-        quantize &= name.find("ssm_conv1d.weight") == std::string::npos;
-
-        // do not quantize RWKV's small yet 2D weights
-        quantize &= name.find("time_mix_first.weight") == std::string::npos;
-        quantize &= name.find("time_mix_w0.weight") == std::string::npos;
-        quantize &= name.find("time_mix_w1.weight") == std::string::npos;
-        quantize &= name.find("time_mix_w2.weight") == std::string::npos;
-        quantize &= name.find("time_mix_v0.weight") == std::string::npos;
-        quantize &= name.find("time_mix_v1.weight") == std::string::npos;
-        quantize &= name.find("time_mix_v2.weight") == std::string::npos;
-        quantize &= name.find("time_mix_a0.weight") == std::string::npos;
-        quantize &= name.find("time_mix_a1.weight") == std::string::npos;
-        quantize &= name.find("time_mix_a2.weight") == std::string::npos;
-        quantize &= name.find("time_mix_g1.weight") == std::string::npos;
-        quantize &= name.find("time_mix_g2.weight") == std::string::npos;
-        quantize &= name.find("time_mix_decay_w1.weight") == std::string::npos;
-        quantize &= name.find("time_mix_decay_w2.weight") == std::string::npos;
-        quantize &= name.find("time_mix_lerp_fused.weight") == std::string::npos;
-
-        // do not quantize relative position bias (T5)
-        quantize &= name.find("attn_rel_b.weight") == std::string::npos;
-
-        ggml_type new_type;
-        void * new_data;
-        size_t new_size;
-
-        if (quantize) {
-            new_type = default_type;
-
-            // get more optimal quantization type based on the tensor shape, layer, etc.
-            if (!params->pure && ggml_is_quantized(default_type)) {
-                new_type = llama_tensor_get_type(qs, new_type, tensor, ftype);
-                // unless the user specifies a type
-                if (params->tensor_types) {
-                    const std::vector<tensor_quantization> & tensor_types = *static_cast<const std::vector<tensor_quantization> *>(params->tensor_types);
-                    const std::string tensor_name(tensor->name);
-                    for (const auto & [tname, qtype] : tensor_types) {
-                        if (std::regex pattern(tname); std::regex_search(tensor_name, pattern)) {
-                            if  (qtype != new_type) {
-                                LLAMA_LOG_DEBUG("(overriding %s) ", ggml_type_name(new_type));
-                                new_type = qtype;
-                                break; // if two or more types are specified for the tensor, first match wins
+        } catch (...) {
+            fail(std::current_exception());
+        }
+    });
+
+    try {
+        quantize_slot * slot;
+        while (loaded.pop(slot)) {
+            const auto & weight = *slot->weight;
+            ggml_tensor * tensor = weight.tensor;
+
+            const std::string name = ggml_get_name(tensor);
+
+            LLAMA_LOG_INFO("[%4d/%4d] %36s - [%s], type = %6s, ",
+                   ++idx, ml.n_tensors,
+                   ggml_get_name(tensor),
+                   llama_format_tensor_shape(tensor).c_str(),
+                   ggml_type_name(tensor->type));
+
+            // This used to be a regex, but <regex> has an extreme cost to compile times.
+            bool quantize = name.rfind("weight") == name.size() - 6; // ends with 'weight'?
+
+            // quantize only 2D and 3D tensors (experts)
+            quantize &= (ggml_n_dims(tensor) >= 2);
+
+            // do not quantize norm tensors
+            quantize &= name.find("_norm.weight") == std::string::npos;
+
+            quantize &= params->quantize_output_tensor || name != "output.weight";
+            quantize &= !params->only_copy;
+
+            // do not quantize expert gating tensors
+            // NOTE: can't use LLM_TN here because the layer number is not known
+            quantize &= name.find("ffn_gate_inp.weight") == std::string::npos;
+
+            // do not quantize positional embeddings and token types (BERT)
+            quantize &= name != LLM_TN(model.arch)(LLM_TENSOR_POS_EMBD,    "weight");
+            quantize &= name != LLM_TN(model.arch)(LLM_TENSOR_TOKEN_TYPES, "weight");
+
+            // do not quantize Mamba's small yet 2D weights
+            // NOTE: can't use LLM_TN here because the layer number is not known
+            quantize &= name.find("ssm_conv1d.weight") == std::string::npos;
+
+            // do not quantize RWKV's small yet 2D weights
+            quantize &= name.find("time_mix_first.weight") == std::string::npos;
+            quantize &= name.find("time_mix_w0.weight") == std::string::npos;
+            quantize &= name.find("time_mix_w1.weight") == std::string::npos;
+            quantize &= name.find("time_mix_w2.weight") == std::string::npos;
+            quantize &= name.find("time_mix_v0.weight") == std::string::npos;
+            quantize &= name.find("time_mix_v1.weight") == std::string::npos;
+            quantize &= name.find("time_mix_v2.weight") == std::string::npos;
+            quantize &= name.find("time_mix_a0.weight") == std::string::npos;
+            quantize &= name.find("time_mix_a1.weight") == std::string::npos;
+            quantize &= name.find("time_mix_a2.weight") == std::string::npos;
+            quantize &= name.find("time_mix_g1.weight") == std::string::npos;
+            quantize &= name.find("time_mix_g2.weight") == std::string::npos;
+            quantize &= name.find("time_mix_decay_w1.weight") == std::string::npos;
+            quantize &= name.find("time_mix_decay_w2.weight") == std::string::npos;
+            quantize &= name.find("time_mix_lerp_fused.weight") == std::string::npos;
+
+            // do not quantize relative position bias (T5)
+            quantize &= name.find("attn_rel_b.weight") == std::string::npos;
+
+            ggml_type new_type;
+            void * new_data;
+            size_t new_size;
+
+            if (quantize) {
+                new_type = default_type;
+
+                // get more optimal quantization type based on the tensor shape, layer, etc.
+                if (!params->pure && ggml_is_quantized(default_type)) {
+                    new_type = llama_tensor_get_type(qs, new_type, tensor, ftype);
+                    // unless the user specifies a type
+                    if (params->tensor_types) {
+                        const std::vector<tensor_quantization> & tensor_types = *static_cast<const std::vector<tensor_quantization> *>(params->tensor_types);
+                        const std::string tensor_name(tensor->name);
+                        for (const auto & [tname, qtype] : tensor_types) {
+                            if (std::regex pattern(tname); std::regex_search(tensor_name, pattern)) {
+                                if  (qtype != new_type) {
+                                    LLAMA_LOG_DEBUG("(overriding %s) ", ggml_type_name(new_type));
+                                    new_type = qtype;
+                                    break; // if two or more types are specified for the tensor, first match wins
+                                }
                             }
                         }
                     }
                 }
-            }
 
-            if (params->token_embedding_type < GGML_TYPE_COUNT && strcmp(tensor->name, "token_embd.weight") == 0) {
-                new_type = params->token_embedding_type;
-            }
-            if (params->output_tensor_type < GGML_TYPE_COUNT && strcmp(tensor->name, "output.weight") == 0) {
-                new_type = params->output_tensor_type;
-            }
+                if (params->token_embedding_type < GGML_TYPE_COUNT && strcmp(tensor->name, "token_embd.weight") == 0) {
+                    new_type = params->token_embedding_type;
+                }
+                if (params->output_tensor_type < GGML_TYPE_COUNT && strcmp(tensor->name, "output.weight") == 0) {
+                    new_type = params->output_tensor_type;
+                }
 
-            // If we've decided to quantize to the same type the tensor is already
-            // in then there's nothing to do.
-            quantize = tensor->type != new_type;
-        }
+                // If we've decided to quantize to the same type the tensor is already
+                // in then there's nothing to do.
+                quantize = tensor->type != new_type;
+            }
 
-        if (!quantize) {
-            new_type = tensor->type;
-            new_data = tensor->data;
-            new_size = ggml_nbytes(tensor);
-            LLAMA_LOG_INFO("size = %8.3f MB\n", ggml_nbytes(tensor)/1024.0/1024.0);
-        } else {
-            const int64_t nelements = ggml_nelements(tensor);
+            if (!quantize) {
+                new_type = tensor->type;
+                new_data = tensor->data;
+                new_size = ggml_nbytes(tensor);
+                LLAMA_LOG_INFO("size = %8.3f MB\n", ggml_nbytes(tensor)/1024.0/1024.0);
+            } else {
+                const int64_t nelements = ggml_nelements(tensor);
 
-            const float * imatrix = nullptr;
-            if (imatrix_data) {
-                auto it = imatrix_data->find(tensor->name);
-                if (it == imatrix_data->end()) {
-                    LLAMA_LOG_INFO("\n====== %s: did not find weights for %s\n", __func__, tensor->name);
-                } else {
-                    if (it->second.size() == (size_t)tensor->ne[0]*tensor->ne[2]) {
-                        imatrix = it->second.data();
+                const float * imatrix = nullptr;
+                if (imatrix_data) {
+                    auto it = imatrix_data->find(tensor->name);
+                    if (it == imatrix_data->end()) {
+                        LLAMA_LOG_INFO("\n====== %s: did not find weights for %s\n", __func__, tensor->name);
                     } else {
-                        LLAMA_LOG_INFO("\n====== %s: imatrix size %d is different from tensor size %d for %s\n", __func__,
-                                int(it->second.size()), int(tensor->ne[0]*tensor->ne[2]), tensor->name);
-
-                        // this can happen when quantizing an old mixtral model with split tensors with a new incompatible imatrix
-                        // this is a significant error and it may be good idea to abort the process if this happens,
-                        // since many people will miss the error and not realize that most of the model is being quantized without an imatrix
-                        // tok_embd should be ignored in this case, since it always causes this warning
-                        if (name != tn(LLM_TENSOR_TOKEN_EMBD, "weight")) {
-                            throw std::runtime_error(format("imatrix size %d is different from tensor size %d for %s",
-                                    int(it->second.size()), int(tensor->ne[0]*tensor->ne[2]), tensor->name));
+                        if (it->second.size() == (size_t)tensor->ne[0]*tensor->ne[2]) {
+                            imatrix = it->second.data();
+                        } else {
+                            LLAMA_LOG_INFO("\n====== %s: imatrix size %d is different from tensor size %d for %s\n", __func__,
+                                    int(it->second.size()), int(tensor->ne[0]*tensor->ne[2]), tensor->name);
+
+                            // this can happen when quantizing an old mixtral model with split tensors with a new incompatible imatrix
+                            // this is a significant error and it may be good idea to abort the process if this happens,
+                            // since many people will miss the error and not realize that most of the model is being quantized without an imatrix
+                            // tok_embd should be ignored in this case, since it always causes this warning
+                            if (name != tn(LLM_TENSOR_TOKEN_EMBD, "weight")) {
+                                throw std::runtime_error(format("imatrix size %d is different from tensor size %d for %s",
+                                        int(it->second.size()), int(tensor->ne[0]*tensor->ne[2]), tensor->name));
+                            }
                         }
                     }
                 }
-            }
-            if ((new_type == GGML_TYPE_IQ2_XXS ||
-                 new_type == GGML_TYPE_IQ2_XS  ||
-                 new_type == GGML_TYPE_IQ2_S   ||
-                 new_type == GGML_TYPE_IQ1_S   ||
-                (new_type == GGML_TYPE_IQ1_M && strcmp(tensor->name, "token_embd.weight") && strcmp(tensor->name, "output.weight"))  ||
-                (new_type == GGML_TYPE_Q2_K && params->ftype == LLAMA_FTYPE_MOSTLY_Q2_K_S && strcmp(tensor->name, "token_embd.weight") != 0)) && !imatrix) {
-                LLAMA_LOG_ERROR("\n\n============================================================\n");
-                LLAMA_LOG_ERROR("Missing importance matrix for tensor %s in a very low-bit quantization\n", tensor->name);
-                LLAMA_LOG_ERROR("The result will be garbage, so bailing out\n");
-                LLAMA_LOG_ERROR("============================================================\n\n");
-                throw std::runtime_error(format("Missing importance matrix for tensor %s in a very low-bit quantization", tensor->name));
-            }
+                if ((new_type == GGML_TYPE_IQ2_XXS ||
+                     new_type == GGML_TYPE_IQ2_XS  ||
+                     new_type == GGML_TYPE_IQ2_S   ||
+                     new_type == GGML_TYPE_IQ1_S   ||
+                    (new_type == GGML_TYPE_IQ1_M && strcmp(tensor->name, "token_embd.weight") && strcmp(tensor->name, "output.weight"))  ||
+                    (new_type == GGML_TYPE_Q2_K && params->ftype == LLAMA_FTYPE_MOSTLY_Q2_K_S && strcmp(tensor->name, "token_embd.weight") != 0)) && !imatrix) {
+                    LLAMA_LOG_ERROR("\n\n============================================================\n");
+                    LLAMA_LOG_ERROR("Missing importance matrix for tensor %s in a very low-bit quantization\n", tensor->name);
+                    LLAMA_LOG_ERROR("The result will be garbage, so bailing out\n");
+                    LLAMA_LOG_ERROR("============================================================\n\n");
+                    throw std::runtime_error(format("Missing importance matrix for tensor %s in a very low-bit quantization", tensor->name));
+                }
 
-            float * f32_data;
+                float * f32_data;
 
-            if (tensor->type == GGML_TYPE_F32) {
-                f32_data = (float *) tensor->data;
-            } else if (ggml_is_quantized(tensor->type) && !params->allow_requantize) {
-                throw std::runtime_error(format("requantizing from type %s is disabled", ggml_type_name(tensor->type)));
-            } else {
-                llama_tensor_dequantize_impl(tensor, f32_conv_buf, workers, nelements, nthread);
-                f32_data = (float *) f32_conv_buf.data();
-            }
+                if (tensor->type == GGML_TYPE_F32) {
+                    f32_data = (float *) tensor->data;
+                } else if (ggml_is_quantized(tensor->type) && !params->allow_requantize) {
+                    throw std::runtime_error(format("requantizing from type %s is disabled", ggml_type_name(tensor->type)));
+                } else {
+                    llama_tensor_dequantize_impl(tensor, f32_conv_buf, pool, nelements, nthread);
+                    f32_data = (float *) f32_conv_buf.data();
+                }
 
-            LLAMA_LOG_INFO("converting to %s .. ", ggml_type_name(new_type));
-            fflush(stdout);
+                LLAMA_LOG_INFO("converting to %s .. ", ggml_type_name(new_type));
+                fflush(stdout);
 
-            if (work.size() < (size_t)nelements * 4) {
-                work.resize(nelements * 4); // upper bound on size
-            }
-            new_data = work.data();
+                if (slot->work.size() < (size_t)nelements * 4) {
+                    slot->work.resize(nelements * 4); // upper bound on size
+                }
+                new_data = slot->work.data();
 
-            const int64_t n_per_row = tensor->ne[0];
-            const int64_t nrows = tensor->ne[1];
+                const int64_t n_per_row = tensor->ne[0];
+                const int64_t nrows = tensor->ne[1];
 
-            static const int64_t min_chunk_size = 32 * 512;
-            const int64_t chunk_size = (n_per_row >= min_chunk_size ? n_per_row : n_per_row * ((min_chunk_size + n_per_row - 1)/n_per_row));
+                static const int64_t min_chunk_size = 32 * 512;
+                const int64_t chunk_size = (n_per_row >= min_chunk_size ? n_per_row : n_per_row * ((min_chunk_size + n_per_row - 1)/n_per_row));
 
-            const int64_t nelements_matrix = tensor->ne[0] * tensor->ne[1];
-            const int64_t nchunk = (nelements_matrix + chunk_size - 1)/chunk_size;
-            const int64_t nthread_use = nthread > 1 ? std::max((int64_t)1, std::min((int64_t)nthread, nchunk)) : 1;
+                const int64_t nelements_matrix = tensor->ne[0] * tensor->ne[1];
+                const int64_t nchunk = (nelements_matrix + chunk_size - 1)/chunk_size;
+                const int64_t nthread_use = nthread > 1 ? std::max((int64_t)1, std::min((int64_t)nthread, nchunk)) : 1;
 
-            // quantize each expert separately since they have different importance matrices
-            new_size = 0;
-            for (int64_t i03 = 0; i03 < tensor->ne[2]; ++i03) {
-                const float * f32_data_03 = f32_data + i03 * nelements_matrix;
-                void * new_data_03 = (char *)new_data + ggml_row_size(new_type, n_per_row) * i03 * nrows;
-                const float * imatrix_03 = imatrix ? imatrix + i03 * n_per_row : nullptr;
+                // quantize each expert separately since they have different importance matrices
+                new_size = 0;
+                for (int64_t i03 = 0; i03 < tensor->ne[2]; ++i03) {
+                    const float * f32_data_03 = f32_data + i03 * nelements_matrix;
+                    void * new_data_03 = (char *)new_data + ggml_row_size(new_type, n_per_row) * i03 * nrows;
+                    const float * imatrix_03 = imatrix ? imatrix + i03 * n_per_row : nullptr;
 
-                new_size += llama_tensor_quantize_impl(new_type, f32_data_03, new_data_03, chunk_size, nrows, n_per_row, imatrix_03, workers, nthread_use);
+                    new_size += llama_tensor_quantize_impl(new_type, f32_data_03, new_data_03, chunk_size, nrows, n_per_row, imatrix_03, pool, nthread_use);
+                }
+                LLAMA_LOG_INFO("size = %8.2f MiB -> %8.2f MiB\n", ggml_nbytes(tensor)/1024.0/1024.0, new_size/1024.0/1024.0);
+            }
+            total_size_org += ggml_nbytes(tensor);
+            total_size_new += new_size;
+
+            // update the gguf meta data as we go, cur_split belongs to the writer
+            const uint16_t i_split = params->keep_split ? weight.idx : 0;
+            gguf_set_tensor_type(ctx_outs[i_split].get(), name.c_str(), new_type);
+            GGML_ASSERT(gguf_get_tensor_size(ctx_outs[i_split].get(), gguf_find_tensor(ctx_outs[i_split].get(), name.c_str())) == new_size);
+            gguf_set_tensor_data(ctx_outs[i_split].get(), name.c_str(), new_data);
+
+            slot->new_data = new_data;
+            slot->new_size = new_size;
+            converted.push(slot);
+
+            if (params->progress_callback &&
+                !params->progress_callback((float) total_size_org / total_size_inp, params->progress_callback_user_data)) {
+                throw std::runtime_error("quantization aborted by the progress callback");
             }
-            LLAMA_LOG_INFO("size = %8.2f MiB -> %8.2f MiB\n", ggml_nbytes(tensor)/1024.0/1024.0, new_size/1024.0/1024.0);
         }
-        total_size_org += ggml_nbytes(tensor);
-        total_size_new += new_size;
+        converted.close();
+    } catch (...) {
+        fail(std::current_exception());
+    }
 
-        // update the gguf meta data as we go
-        gguf_set_tensor_type(ctx_outs[cur_split].get(), name.c_str(), new_type);
-        GGML_ASSERT(gguf_get_tensor_size(ctx_outs[cur_split].get(), gguf_find_tensor(ctx_outs[cur_split].get(), name.c_str())) == new_size);
-        gguf_set_tensor_data(ctx_outs[cur_split].get(), name.c_str(), new_data);
+    reader.join();
+    writer.join();
 
-        // write tensor data + padding
-        fout.write((const char *) new_data, new_size);
-        zeros(fout, GGML_PAD(new_size, align) - new_size);
+    if (error) {
+        std::rethrow_exception(error);
     }
+
     close_ofstream();
 
     LLAMA_LOG_INFO("%s: model size  = %8.2f MB\n", __func__, total_size_org/1024.0/1024.0);
@@ -943,9 +1277,12 @@ llama_model_quantize_params llama_model_quantize_default_params() {
         /*.only_copy                   =*/ false,
         /*.pure                        =*/ false,
         /*.keep_split                  =*/ false,
+        /*.pin_threads                 =*/ false,
         /*.imatrix                     =*/ nullptr,
         /*.kv_overrides                =*/ nullptr,
         /*.tensor_type                 =*/ nullptr,
+        /*.progress_callback           =*/ nullptr,
+        /*.progress_callback_user_data =*/ nullptr,
     };
 
     return result;
@@ -1470,6 +1470,10 @@ static void llama_sampler_grammar_reset(struct llama_sampler * smpl) {
                                                  ctx->grammar->lazy, trigger_patterns_c.data(), trigger_patterns_c.size(),
                                                  ctx->grammar->trigger_tokens.data(), ctx->grammar->trigger_tokens.size());
 
+    if (grammar_new) {
+        grammar_new->token_trie = ctx->grammar->token_trie;
+    }
+
     llama_grammar_free_impl(ctx->grammar);
     ctx->grammar = grammar_new;
 }
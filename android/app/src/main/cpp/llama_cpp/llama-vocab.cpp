@@ -8,6 +8,7 @@
 #include "unicode.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cfloat>
 #include <climits>
@@ -17,6 +18,7 @@
 #include <map>
 #include <queue>
 #include <set>
+#include <string_view>
 #include <unordered_map>
 #include <cctype>
 
@@ -256,9 +258,25 @@ public:
         return item;
     }
 
+    // empties the queue but keeps its storage
+    void clear() {
+        this->c.clear();
+    }
+
     void pop() =  delete;
 };
 
+struct llm_symbol_bpe {
+    using index = int;
+    index prev;
+    index next;
+    int32_t id; // see llm_bpe_merge_table, -1 if the symbol takes part in no merge
+    const char * text;
+    uint32_t n;
+};
+
+static_assert(std::is_trivially_copyable<llm_symbol_bpe>::value, "llm_symbol_bpe is not trivially copyable");
+
 struct llm_bigram_bpe {
     struct comparator {
         bool operator()(const llm_bigram_bpe & l, const llm_bigram_bpe & r) const {
@@ -268,15 +286,219 @@ struct llm_bigram_bpe {
 
     using queue_storage = std::vector<llm_bigram_bpe>;
     using queue = llama_priority_queue<llm_bigram_bpe, queue_storage, comparator>;
-    llm_symbol::index left;
-    llm_symbol::index right;
-    std::string text;
+    llm_symbol_bpe::index left;
+    llm_symbol_bpe::index right;
     int rank;
-    size_t size;
+    int32_t id;    // id of the merged symbol
+    uint32_t size; // bytes of the merged symbol, the bigram is outdated when the symbols no longer add up to it
+};
+
+// merge rules keyed by the ids of the two symbols
+//
+// Every string that is an operand or result of a merge gets an id: its token id when it is in the
+// vocab, otherwise an id past the end of the vocab. Symbols then carry their id and a merge is
+// found with one probe of an open-addressing table instead of building and hashing string pairs.
+struct llm_bpe_merge_table {
+    struct entry {
+        uint64_t key;  // left id << 32 | right id, UINT64_MAX when the slot is empty
+        int32_t  rank;
+        int32_t  id;
+    };
+
+    template <typename ranks_t>
+    void build(const llama_vocab & vocab, const ranks_t & bpe_ranks) {
+        n_vocab = vocab.n_tokens();
+
+        size_t n_slots = 16;
+        while (n_slots < 2*bpe_ranks.size()) {
+            n_slots *= 2;
+        }
+        slots.assign(n_slots, entry{UINT64_MAX, 0, 0});
+        mask = n_slots - 1;
+
+        for (const auto & it : bpe_ranks) {
+            const std::string & left  = it.first.first;
+            const std::string & right = it.first.second;
+            if (left.empty() || right.empty()) {
+                continue;
+            }
+
+            const uint64_t key = (uint64_t) intern(vocab, left) << 32 | (uint32_t) intern(vocab, right);
+
+            size_t i = hash(key);
+            while (slots[i].key != UINT64_MAX && slots[i].key != key) {
+                i = (i + 1) & mask;
+            }
+            slots[i] = { key, it.second, intern(vocab, left + right) };
+        }
+
+        // 1- and 2-byte characters are looked up directly, byte-level vocabs have no others
+        char_ids.resize(128 + 2048);
+        for (uint32_t c = 0; c < char_ids.size(); ++c) {
+            std::string text;
+            if (c < 128) {
+                text = std::string(1, (char) c);
+            } else {
+                text = { (char) (0xC0 | (c - 128) >> 6), (char) (0x80 | ((c - 128) & 0x3F)) };
+            }
+            char_ids[c] = find_id(vocab, text);
+        }
+    }
+
+    // id of the symbol with the text of a single UTF-8 character
+    int32_t char_id(const llama_vocab & vocab, const char * text, size_t n) const {
+        const uint8_t c0 = text[0];
+        if (n == 1 && c0 < 0x80) {
+            return char_ids[c0];
+        }
+        if (n == 2 && (c0 & 0xE0) == 0xC0 && (text[1] & 0xC0) == 0x80) {
+            return char_ids[128 + ((c0 & 0x1F) << 6 | (text[1] & 0x3F))];
+        }
+        return find_id(vocab, std::string(text, n));
+    }
+
+    int32_t find_id(const llama_vocab & vocab, const std::string & text) const {
+        const llama_token token = vocab.text_to_token(text);
+        if (token != LLAMA_TOKEN_NULL) {
+            return token;
+        }
+        const auto it = extra_ids.find(text);
+        return it == extra_ids.end() ? -1 : it->second;
+    }
+
+    const entry * find(int32_t left, int32_t right) const {
+        const uint64_t key = (uint64_t) left << 32 | (uint32_t) right;
+        for (size_t i = hash(key); ; i = (i + 1) & mask) {
+            if (slots[i].key == key) {
+                return &slots[i];
+            }
+            if (slots[i].key == UINT64_MAX) {
+                return nullptr;
+            }
+        }
+    }
+
+    // ids past the end are not tokens, their text is emitted as byte tokens
+    bool is_token(int32_t id) const {
+        return id >= 0 && id < n_vocab;
+    }
+
+private:
+    size_t hash(uint64_t key) const {
+        return (size_t) ((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    }
+
+    int32_t intern(const llama_vocab & vocab, const std::string & text) {
+        const int32_t id = find_id(vocab, text);
+        if (id >= 0) {
+            return id;
+        }
+        const int32_t extra = n_vocab + (int32_t) extra_ids.size();
+        extra_ids.emplace(text, extra);
+        return extra;
+    }
+
+    int32_t n_vocab = 0;
+    size_t mask = 0;
+    std::vector<entry> slots;
+    std::vector<int32_t> char_ids;
+    std::unordered_map<std::string, int32_t> extra_ids;
+};
+
+// recently tokenized words and their tokens
+//
+// Natural text repeats a small set of words, a hit skips the merge loop altogether. Each thread
+// keeps one cache, it is emptied when the thread moves on to a different tokenizer.
+struct llm_bpe_word_cache {
+    static constexpr uint32_t capacity = 8192;
+    static constexpr size_t   max_word = 48;  // longer words rarely repeat
+    static constexpr uint32_t none     = UINT32_MAX;
+
+    static llm_bpe_word_cache & get(uint64_t owner) {
+        static thread_local llm_bpe_word_cache cache;
+        if (cache.owner != owner) {
+            cache.owner = owner;
+            cache.index.clear();
+            cache.entries.clear();
+            cache.head = none;
+            cache.tail = none;
+        }
+        return cache;
+    }
+
+    const std::vector<llama_token> * find(const std::string & word) {
+        const auto it = index.find(word);
+        if (it == index.end()) {
+            return nullptr;
+        }
+        touch(it->second);
+        return &entries[it->second].tokens;
+    }
+
+    void insert(const std::string & word, const llama_token * tokens, size_t n_tokens) {
+        if (word.size() > max_word) {
+            return;
+        }
+
+        uint32_t i;
+        if (entries.size() < capacity) {
+            if (entries.capacity() < capacity) {
+                entries.reserve(capacity); // the index points into the entries, they must not move
+                index.reserve(capacity);
+            }
+            i = (uint32_t) entries.size();
+            entries.emplace_back();
+        } else {
+            i = tail;
+            unlink(i);
+            index.erase(entries[i].word);
+        }
+
+        entry & e = entries[i];
+        e.word.assign(word);
+        e.tokens.assign(tokens, tokens + n_tokens);
+        link_front(i);
+        index.emplace(e.word, i);
+    }
+
+private:
+    struct entry {
+        std::string word;
+        std::vector<llama_token> tokens;
+        uint32_t prev = none;
+        uint32_t next = none;
+    };
+
+    void unlink(uint32_t i) {
+        entry & e = entries[i];
+        (e.prev == none ? head : entries[e.prev].next) = e.next;
+        (e.next == none ? tail : entries[e.next].prev) = e.prev;
+    }
+
+    void link_front(uint32_t i) {
+        entry & e = entries[i];
+        e.prev = none;
+        e.next = head;
+        (head == none ? tail : entries[head].prev) = i;
+        head = i;
+    }
+
+    void touch(uint32_t i) {
+        if (head != i) {
+            unlink(i);
+            link_front(i);
+        }
+    }
+
+    uint64_t owner = 0;
+    uint32_t head  = none;
+    uint32_t tail  = none;
+    std::vector<entry> entries;
+    std::unordered_map<std::string_view, uint32_t> index;
 };
 
 struct llm_tokenizer_bpe : llm_tokenizer {
-    llm_tokenizer_bpe(const llama_vocab & vocab) {
+    llm_tokenizer_bpe(const llama_vocab & vocab) : cache_id(next_cache_id()) {
         GGML_ASSERT(vocab.get_type() == LLAMA_VOCAB_TYPE_BPE);
         switch (vocab.get_pre_type()) {
             case LLAMA_VOCAB_PRE_TYPE_LLAMA3:
@@ -437,6 +659,17 @@ struct llm_tokenizer_bpe : llm_tokenizer {
     }
 
     std::vector<std::string> regex_exprs;
+
+    llm_bpe_merge_table merges;
+
+    // identifies this tokenizer to the per-thread word caches
+    const uint64_t cache_id;
+
+private:
+    static uint64_t next_cache_id() {
+        static std::atomic<uint64_t> counter{1};
+        return counter++;
+    }
 };
 
 struct llm_tokenizer_bpe_session {
@@ -480,123 +713,117 @@ struct llm_tokenizer_bpe_session {
     }
 
     void tokenize(const std::string & text, std::vector<llama_token> & output) {
-        int final_prev_index = -1;
         const auto word_collection = unicode_regex_split(text, tokenizer.regex_exprs);
 
-        symbols_final.clear();
+        llm_bpe_word_cache & cache = llm_bpe_word_cache::get(tokenizer.cache_id);
 
         for (const auto & word : word_collection) {
-            work_queue = llm_bigram_bpe::queue();
-            symbols.clear();
+            if (const auto * tokens = cache.find(word)) {
+                output.insert(output.end(), tokens->begin(), tokens->end());
+                continue;
+            }
 
-            int index = 0;
-            size_t offset = 0;
+            const size_t n_output = output.size();
+            tokenize_word(word, output);
+            cache.insert(word, output.data() + n_output, output.size() - n_output);
+        }
+    }
 
-            //if (vocab.tokenizer_ignore_merges && vocab.token_to_id.find(word) != vocab.token_to_id.end()) {
-            if (vocab.get_ignore_merges() && vocab.text_to_token(word) != LLAMA_TOKEN_NULL) {
-                symbols.emplace_back(llm_symbol{-1, -1, word.c_str(), word.size()});
-                offset = word.size();
-            }
+private:
+    void tokenize_word(const std::string & word, std::vector<llama_token> & output) {
+        const llm_bpe_merge_table & merges = tokenizer.merges;
 
-            while (offset < word.size()) {
-                llm_symbol sym;
-                size_t char_len = std::min(word.size() - offset, (size_t) unicode_len_utf8(word[offset]));
-                sym.text = word.c_str() + offset;
-                sym.n = char_len;
-                offset += sym.n;
-                sym.prev = index - 1;
-                sym.next = offset == word.size() ? -1 : index + 1;
-                index++;
-                symbols.emplace_back(sym);
-            }
-            for (int i = 1; i < (int) symbols.size(); ++i) {
-                add_new_bigram(i - 1, i);
-            }
+        // the symbols and the queue keep their storage from word to word
+        work_queue.clear();
+        symbols.clear();
 
-            // build token(s)
-            while (!work_queue.empty()) {
-                auto bigram = work_queue.pop_move();
+        int index = 0;
+        size_t offset = 0;
 
-                auto & left_symbol = symbols[bigram.left];
-                auto & right_symbol = symbols[bigram.right];
+        //if (vocab.tokenizer_ignore_merges && vocab.token_to_id.find(word) != vocab.token_to_id.end()) {
+        if (vocab.get_ignore_merges()) {
+            const llama_token token = vocab.text_to_token(word);
+            if (token != LLAMA_TOKEN_NULL) {
+                symbols.push_back(llm_symbol_bpe{-1, -1, token, word.c_str(), (uint32_t) word.size()});
+                offset = word.size();
+            }
+        }
 
-                if (left_symbol.n == 0 || right_symbol.n == 0) {
-                    continue;
-                }
-                std::string left_token = std::string(left_symbol.text, left_symbol.n);
-                std::string right_token = std::string(right_symbol.text, right_symbol.n);
-                if (left_token + right_token != bigram.text) {
-                    continue;  // Skip this bigram if it's outdated
-                }
+        while (offset < word.size()) {
+            llm_symbol_bpe sym;
+            size_t char_len = std::min(word.size() - offset, (size_t) unicode_len_utf8(word[offset]));
+            sym.text = word.c_str() + offset;
+            sym.n = char_len;
+            sym.id = merges.char_id(vocab, sym.text, sym.n);
+            offset += sym.n;
+            sym.prev = index - 1;
+            sym.next = offset == word.size() ? -1 : index + 1;
+            index++;
+            symbols.push_back(sym);
+        }
+        for (int i = 1; i < (int) symbols.size(); ++i) {
+            add_new_bigram(i - 1, i);
+        }
 
-                // merge the right sym into the left one
-                left_symbol.n += right_symbol.n;
-                right_symbol.n = 0;
+        // build token(s)
+        while (!work_queue.empty()) {
+            auto bigram = work_queue.pop_move();
 
-                // remove the right sym from the chain
-                left_symbol.next = right_symbol.next;
-                if (right_symbol.next >= 0) {
-                    symbols[right_symbol.next].prev = bigram.left;
-                }
+            auto & left_symbol = symbols[bigram.left];
+            auto & right_symbol = symbols[bigram.right];
 
-                add_new_bigram(left_symbol.prev, bigram.left);  // left side of current symbol
-                add_new_bigram(bigram.left, left_symbol.next);  // right side of current symbol
+            if (left_symbol.n == 0 || right_symbol.n == 0) {
+                continue;
             }
-
-            // add the finished tokens to the final list keeping correct order for next and prev
-            for (auto & sym : symbols) {
-                if (sym.n > 0) {
-                    sym.prev = final_prev_index;
-                    sym.next = -1;
-                    if (final_prev_index != -1) {
-                        symbols_final[final_prev_index].next = symbols_final.size();
-                    }
-                    symbols_final.emplace_back(sym);
-                    final_prev_index = symbols_final.size() - 1;
-                }
+            if (left_symbol.n + right_symbol.n != bigram.size) {
+                continue;  // Skip this bigram if it's outdated
             }
-        }
 
-        symbols = symbols_final;
+            // merge the right sym into the left one
+            left_symbol.n += right_symbol.n;
+            left_symbol.id = bigram.id;
+            right_symbol.n = 0;
 
-        if (!symbols.empty()) {
-            for (int i = 0; i != -1; i = symbols[i].next) {
-                auto & symbol = symbols[i];
-                if (symbol.n == 0) {
-                    continue;
-                }
+            // remove the right sym from the chain
+            left_symbol.next = right_symbol.next;
+            if (right_symbol.next >= 0) {
+                symbols[right_symbol.next].prev = bigram.left;
+            }
 
-                const std::string str = std::string(symbol.text, symbol.n);
-                const auto token = vocab.text_to_token(str);
+            add_new_bigram(left_symbol.prev, bigram.left);  // left side of current symbol
+            add_new_bigram(bigram.left, left_symbol.next);  // right side of current symbol
+        }
 
-                if (token == LLAMA_TOKEN_NULL) {
-                    for (auto j = str.begin(); j != str.end(); ++j) {
-                        std::string byte_str(1, *j);
-                        auto token_multibyte = vocab.text_to_token(byte_str);
-                        if (token_multibyte != LLAMA_TOKEN_NULL) {
-                            output.push_back(token_multibyte);
-                        }
+        for (const auto & symbol : symbols) {
+            if (symbol.n == 0) {
+                continue;
+            }
+
+            if (merges.is_token(symbol.id)) {
+                output.push_back(symbol.id);
+            } else {
+                for (uint32_t j = 0; j < symbol.n; ++j) {
+                    std::string byte_str(1, symbol.text[j]);
+                    auto token_multibyte = vocab.text_to_token(byte_str);
+                    if (token_multibyte != LLAMA_TOKEN_NULL) {
+                        output.push_back(token_multibyte);
                     }
-                } else {
-                    output.push_back(token);
                 }
             }
         }
     }
 
-private:
     void add_new_bigram(int left, int right) {
         if (left == -1 || right == -1) {
             return;
         }
-        std::string left_token  = std::string(symbols[left].text,  symbols[left].n);
-        std::string right_token = std::string(symbols[right].text, symbols[right].n);
-
-        int rank_found = -1;
+        if (symbols[left].id < 0 || symbols[right].id < 0) {
+            return;
+        }
 
-        rank_found = vocab.find_bpe_rank(left_token, right_token);
+        const llm_bpe_merge_table::entry * merge = tokenizer.merges.find(symbols[left].id, symbols[right].id);
 
-        if (rank_found < 0) {
+        if (merge == nullptr) {
             return;
         }
 
@@ -604,9 +831,9 @@ private:
 
         bigram.left  = left;
         bigram.right = right;
-        bigram.text  = left_token + right_token;
-        bigram.size  = left_token.size() + right_token.size();
-        bigram.rank  = rank_found;
+        bigram.rank  = merge->rank;
+        bigram.id    = merge->id;
+        bigram.size  = symbols[left].n + symbols[right].n;
 
         work_queue.push(bigram);
     }
@@ -614,8 +841,7 @@ private:
     const llama_vocab & vocab;
     const llm_tokenizer_bpe & tokenizer;
 
-    std::vector<llm_symbol> symbols;
-    std::vector<llm_symbol> symbols_final;
+    std::vector<llm_symbol_bpe> symbols;
     llm_bigram_bpe::queue work_queue;
 };
 
@@ -2201,8 +2427,11 @@ void llama_vocab::impl::init_tokenizer(enum llama_vocab_type type) {
             tokenizer = std::make_unique<llm_tokenizer_spm>(vocab);
             break;
         case LLAMA_VOCAB_TYPE_BPE:
-            tokenizer = std::make_unique<llm_tokenizer_bpe>(vocab);
-            break;
+            {
+                auto bpe = std::make_unique<llm_tokenizer_bpe>(vocab);
+                bpe->merges.build(vocab, bpe_ranks);
+                tokenizer = std::move(bpe);
+            } break;
         case LLAMA_VOCAB_TYPE_WPM:
             tokenizer = std::make_unique<llm_tokenizer_wpm>(vocab);
             break;
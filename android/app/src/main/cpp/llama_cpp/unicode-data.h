@@ -18,3 +18,6 @@ extern const std::unordered_set<uint32_t> unicode_set_whitespace;
 extern const std::initializer_list<std::pair<uint32_t, uint32_t>> unicode_map_lowercase;
 extern const std::initializer_list<std::pair<uint32_t, uint32_t>> unicode_map_uppercase;
 extern const std::initializer_list<range_nfd> unicode_ranges_nfd;
+
+extern const uint16_t unicode_flags_stage1[MAX_CODEPOINTS/256 + 1];
+extern const uint16_t unicode_flags_stage2[];
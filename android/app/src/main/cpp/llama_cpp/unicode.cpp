@@ -12,6 +12,8 @@
 #include <cstdint>
 #include <locale>
 #include <map>
+#include <memory>
+#include <mutex>
 #include <regex>
 #include <stdexcept>
 #include <string>
@@ -119,85 +121,42 @@ uint32_t unicode_cpt_from_utf8(const std::string & utf8, size_t & offset) {
 //    return result;
 //}
 
-static std::vector<unicode_cpt_flags> unicode_cpt_flags_array() {
-    std::vector<unicode_cpt_flags> cpt_flags(MAX_CODEPOINTS, unicode_cpt_flags::UNDEFINED);
-
-    assert (unicode_ranges_flags.begin()[0].first == 0);
-    assert (unicode_ranges_flags.begin()[unicode_ranges_flags.size()-1].first == MAX_CODEPOINTS);
-    for (size_t i = 1; i < unicode_ranges_flags.size(); ++i) {
-        const auto range_ini = unicode_ranges_flags.begin()[i-1];  // codepoint_ini, flags
-        const auto range_end = unicode_ranges_flags.begin()[i];    // codepoint_end, flags
-        for (uint32_t cpt = range_ini.first; cpt < range_end.first; ++cpt) {
-            cpt_flags[cpt] = range_ini.second;
-        }
-    }
-
-    for (auto cpt : unicode_set_whitespace) {
-        cpt_flags[cpt].is_whitespace = true;
-    }
-
-    for (auto p : unicode_map_lowercase) {
-        cpt_flags[p.second].is_lowercase = true;
-    }
-
-    for (auto p : unicode_map_uppercase) {
-        cpt_flags[p.second].is_uppercase = true;
-    }
-
-    for (auto &range : unicode_ranges_nfd) {  // start, last, nfd
-        cpt_flags[range.nfd].is_nfd = true;
-    }
-
-    return cpt_flags;
+// byte-level BPE alphabet (GPT-2 bytes_to_unicode): the printable bytes are the codepoint of
+// the same value, the others are 256, 257, ... in byte order
+struct unicode_byte_map {
+    char    utf8[256][2];       // UTF-8 of the codepoint of each byte, all of them are < 0x800
+    uint8_t utf8_len[256];
+    int16_t byte[256 + 68];     // codepoint -> byte, -1 if the codepoint is not one
+};
+
+static constexpr bool unicode_byte_is_printable(int ch) {
+    return (0x21 <= ch && ch <= 0x7E) ||  // u'!' to u'~'
+           (0xA1 <= ch && ch <= 0xAC) ||  // u'¡' to u'¬'
+           (0xAE <= ch && ch <= 0xFF);    // u'®' to u'ÿ'
 }
 
-static std::unordered_map<uint8_t, std::string> unicode_byte_to_utf8_map() {
-    std::unordered_map<uint8_t, std::string> map;
-    for (int ch = 0x21; ch <= 0x7E; ++ch) {  // u'!' to u'~'
-        assert(0 <= ch && ch < 256);
-        map[ch] = unicode_cpt_to_utf8(ch);
-    }
-    for (int ch = 0xA1; ch <= 0xAC; ++ch) {  // u'¡' to u'¬'
-        assert(0 <= ch && ch < 256);
-        map[ch] = unicode_cpt_to_utf8(ch);
+static constexpr unicode_byte_map unicode_byte_map_init() {
+    unicode_byte_map map = {};
+    for (int cpt = 0; cpt < 256 + 68; ++cpt) {
+        map.byte[cpt] = -1;
     }
-    for (int ch = 0xAE; ch <= 0xFF; ++ch) {  // u'®' to u'ÿ'
-        assert(0 <= ch && ch < 256);
-        map[ch] = unicode_cpt_to_utf8(ch);
-    }
-    auto n = 0;
+    int n = 0;
     for (int ch = 0; ch < 256; ++ch) {
-        if (map.find(ch) == map.end()) {
-            map[ch] = unicode_cpt_to_utf8(256 + n);
-            ++n;
+        const int cpt = unicode_byte_is_printable(ch) ? ch : 256 + n++;
+        map.byte[cpt] = (int16_t) ch;
+        if (cpt < 0x80) {
+            map.utf8[ch][0]  = (char) cpt;
+            map.utf8_len[ch] = 1;
+        } else {
+            map.utf8[ch][0]  = (char) (0xC0 | (cpt >> 6));
+            map.utf8[ch][1]  = (char) (0x80 | (cpt & 0x3F));
+            map.utf8_len[ch] = 2;
         }
     }
     return map;
 }
 
-static std::unordered_map<std::string, uint8_t> unicode_utf8_to_byte_map() {
-    std::unordered_map<std::string, uint8_t> map;
-    for (int ch = 0x21; ch <= 0x7E; ++ch) {  // u'!' to u'~'
-        assert(0 <= ch && ch < 256);
-        map[unicode_cpt_to_utf8(ch)] = ch;
-    }
-    for (int ch = 0xA1; ch <= 0xAC; ++ch) {  // u'¡' to u'¬'
-        assert(0 <= ch && ch < 256);
-        map[unicode_cpt_to_utf8(ch)] = ch;
-    }
-    for (int ch = 0xAE; ch <= 0xFF; ++ch) {  // u'®' to u'ÿ'
-        assert(0 <= ch && ch < 256);
-        map[unicode_cpt_to_utf8(ch)] = ch;
-    }
-    auto n = 0;
-    for (int ch = 0; ch < 256; ++ch) {
-        if (map.find(unicode_cpt_to_utf8(ch)) == map.end()) {
-            map[unicode_cpt_to_utf8(256 + n)] = ch;
-            ++n;
-        }
-    }
-    return map;
-}
+static constexpr unicode_byte_map k_unicode_byte_map = unicode_byte_map_init();
 
 static inline std::wstring unicode_wstring_from_utf8(const std::string & s) {
 #if defined(__clang__)
@@ -215,31 +174,33 @@ static inline std::wstring unicode_wstring_from_utf8(const std::string & s) {
     return conv.from_bytes(s);
 }
 
-static std::vector<std::string> unicode_byte_encoding_process(const std::vector<std::string> & bpe_words) {
+// byte-level encoding of the words of the split, offsets are the word lengths in codepoints
+static std::vector<std::string> unicode_byte_encoding_process(const std::vector<uint32_t> & cpts, const std::vector<size_t> & offsets) {
     std::vector<std::string> bpe_encoded_words;
-    for (const auto & word : bpe_words) {
-        std::string text_utf;
-        auto utf_word =  unicode_cpts_from_utf8(word);
-        for (size_t i = 0; i < utf_word.size(); ++i) {
-            text_utf += unicode_cpt_to_utf8(utf_word[i]);
-        }
+    bpe_encoded_words.reserve(offsets.size());
 
-        std::string encoded_token;
-        for (char & c : text_utf) {
-            encoded_token += unicode_byte_to_utf8(c);
+    size_t start = 0;
+    for (const size_t offset : offsets) {
+        std::string & encoded_token = bpe_encoded_words.emplace_back();
+        encoded_token.reserve(2*offset);
+        for (size_t i = start; i < start + offset; ++i) {
+            char utf8[4];
+            const size_t n = unicode_cpt_to_utf8(cpts[i], utf8);
+            for (size_t j = 0; j < n; ++j) {
+                const uint8_t byte = (uint8_t) utf8[j];
+                encoded_token.append(k_unicode_byte_map.utf8[byte], k_unicode_byte_map.utf8_len[byte]);
+            }
         }
-        bpe_encoded_words.emplace_back(encoded_token);
+        start += offset;
     }
     return bpe_encoded_words;
 }
 
 // GPT2 system regex:  's|'t|'re|'ve|'m|'ll|'d| ?\p{L}+| ?\p{N}+| ?[^\s\p{L}\p{N}]+|\s+(?!\S)|\s+
-static std::vector<size_t> unicode_regex_split_custom_gpt2(const std::string & text, const std::vector<size_t> & offsets) {
+static std::vector<size_t> unicode_regex_split_custom_gpt2(const std::vector<uint32_t> & cpts, const std::vector<size_t> & offsets) {
     std::vector<size_t> bpe_offsets; // store the offset of each word
     bpe_offsets.reserve(offsets.size()); // Reserve memory for the approximate size
 
-    const auto cpts = unicode_cpts_from_utf8(text);
-
     size_t start = 0;
     for (auto offset : offsets) {
         const size_t offset_ini = start;
@@ -352,12 +313,10 @@ static std::vector<size_t> unicode_regex_split_custom_gpt2(const std::string & t
 }
 
 // LLAMA3 system regex: "(?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\r\n\p{L}\p{N}]?\p{L}+|\p{N}{1,3}| ?[^\s\p{L}\p{N}]+[\r\n]*|\s*[\r\n]+|\s+(?!\S)|\s+"
-static std::vector<size_t> unicode_regex_split_custom_llama3(const std::string & text, const std::vector<size_t> & offsets) {
+static std::vector<size_t> unicode_regex_split_custom_llama3(const std::vector<uint32_t> & cpts, const std::vector<size_t> & offsets) {
     std::vector<size_t> bpe_offsets; // store the offset of each word
     bpe_offsets.reserve(offsets.size()); // Reserve memory for the approximate size
 
-    const auto cpts = unicode_cpts_from_utf8(text);
-
     size_t start = 0;
     for (auto offset : offsets) {
         const size_t offset_ini = start;
@@ -552,16 +511,743 @@ static std::vector<size_t> unicode_regex_split_stl(const std::string & text, con
     return bpe_offsets;
 }
 
-static std::vector<size_t> unicode_regex_split_custom(const std::string & text, const std::string & regex_expr, const std::vector<size_t> & offsets) {
+//
+// DFA pre-tokenizer
+//
+// Pre-tokenizer regexes without a custom implementation are compiled into a DFA over
+// code point classes instead of going through std::regex. The regex is parsed into an
+// NFA program whose alternatives are ordered, and every DFA state is the ordered list
+// of NFA threads still alive, with the lower priority threads dropped as soon as a
+// higher priority one matches. This gives the leftmost-first result of a backtracking
+// engine (ECMAScript, PCRE, Rust regex) rather than the leftmost-longest one of a POSIX DFA.
+//
+// The lookaheads used by the pre-tokenizers, (?=X), (?!X) and $, only look at the next
+// code point, so they are resolved when the transition on that code point is built.
+//
+// Code points are mapped to classes through their unicode categories and the explicit
+// ranges of the regex; the classes of a text are computed once and the matching loop is
+// one table lookup per code point, without allocations. Regexes with other features
+// (backreferences, lazy quantifiers, longer lookaheads, ...) keep using std::regex.
+//
+
+// whitespace bit of the flags seen by the regex, next to the category bits
+#define UNICODE_REGEX_SPACE 0x100
+
+// the flags of a code point that a regex can test: its categories and \s
+static inline uint16_t unicode_regex_flags(uint32_t cpt) {
+    const auto flags = unicode_cpt_flags_from_cpt(cpt);
+    return flags.category_flag() | (flags.is_whitespace ? UNICODE_REGEX_SPACE : 0);
+}
+
+// the distinct values of unicode_regex_flags over all code points
+struct unicode_regex_flag_groups {
+    uint8_t               group[2*UNICODE_REGEX_SPACE];  // flags -> group
+    std::vector<uint16_t> flags;                         // group -> flags
+};
+
+static const unicode_regex_flag_groups & unicode_regex_get_flag_groups() {
+    static const unicode_regex_flag_groups groups = [] {
+        unicode_regex_flag_groups res;
+        std::fill(std::begin(res.group), std::end(res.group), 0);
+        std::vector<bool> seen(2*UNICODE_REGEX_SPACE, false);
+        for (uint32_t cpt = 0; cpt <= MAX_CODEPOINTS; ++cpt) {
+            const uint16_t flags = unicode_regex_flags(cpt);
+            if (!seen[flags]) {
+                seen[flags] = true;
+                res.group[flags] = (uint8_t) res.flags.size();
+                res.flags.push_back(flags);
+            }
+        }
+        return res;
+    }();
+    return groups;
+}
+
+// a set of code points: inclusive ranges, unicode categories, \s and \S
+struct unicode_regex_cset {
+    std::vector<std::pair<uint32_t, uint32_t>> ranges;
+
+    uint16_t categories = 0;
+    bool     space      = false;
+    bool     non_space  = false;
+    bool     negated    = false;
+
+    bool contains(uint32_t cpt, uint16_t flags) const {
+        bool res = (flags & categories) != 0 ||
+                   (space     &&  (flags & UNICODE_REGEX_SPACE)) ||
+                   (non_space && !(flags & UNICODE_REGEX_SPACE));
+        for (const auto & range : ranges) {
+            res = res || (range.first <= cpt && cpt <= range.second);
+        }
+        return res != negated;
+    }
+};
+
+struct unicode_regex_node {
+    enum type_t { CHAR, ASSERT, END, CAT, ALT, REPEAT };
+
+    type_t  type;
+    int32_t atom    = -1;     // CHAR, ASSERT: index of the code point set
+    bool    negated = false;  // ASSERT: (?!X)
+    int32_t min     = 1;      // REPEAT
+    int32_t max     = 1;      // REPEAT, -1 = unbounded
+
+    std::vector<unicode_regex_node> kids;
+};
+
+// thrown for the regex features the DFA does not implement
+struct unicode_regex_unsupported : public std::runtime_error {
+    using std::runtime_error::runtime_error;
+};
+
+struct unicode_regex_parser {
+    std::vector<uint32_t> re;
+    size_t                pos = 0;
+
+    std::vector<unicode_regex_cset> atoms;
+
+    uint32_t peek() const {
+        return pos < re.size() ? re[pos] : 0;
+    }
+
+    uint32_t next() {
+        if (pos >= re.size()) {
+            throw unicode_regex_unsupported("unexpected end of regex");
+        }
+        return re[pos++];
+    }
+
+    bool accept(const char * s) {
+        size_t i = 0;
+        for (; s[i]; ++i) {
+            if (pos + i >= re.size() || re[pos + i] != (uint32_t) s[i]) {
+                return false;
+            }
+        }
+        pos += i;
+        return true;
+    }
+
+    int32_t add_atom(const unicode_regex_cset & cset) {
+        if (atoms.size() == 64) {
+            throw unicode_regex_unsupported("too many character sets");
+        }
+        atoms.push_back(cset);
+        return (int32_t) atoms.size() - 1;
+    }
+
+    static unicode_regex_cset literal(uint32_t cpt) {
+        unicode_regex_cset res;
+        res.ranges.push_back({cpt, cpt});
+        return res;
+    }
+
+    static uint16_t category(uint32_t c) {
+        switch (c) {
+            case 'N': return unicode_cpt_flags::NUMBER;
+            case 'L': return unicode_cpt_flags::LETTER;
+            case 'Z': return unicode_cpt_flags::SEPARATOR;
+            case 'M': return unicode_cpt_flags::ACCENT_MARK;
+            case 'P': return unicode_cpt_flags::PUNCTUATION;
+            case 'S': return unicode_cpt_flags::SYMBOL;
+            case 'C': return unicode_cpt_flags::CONTROL;
+        }
+        throw unicode_regex_unsupported("unknown unicode category");
+    }
+
+    // after '\', returns true for a single literal code point
+    bool parse_escape(unicode_regex_cset & res) {
+        const uint32_t c = next();
+        switch (c) {
+            case 'd': case 'D':
+                res.ranges.push_back({'0', '9'});
+                res.negated = c == 'D';
+                return false;
+            case 'w': case 'W':
+                res.ranges = { {'0', '9'}, {'A', 'Z'}, {'_', '_'}, {'a', 'z'} };
+                res.negated = c == 'W';
+                return false;
+            case 's': res.space     = true; return false;
+            case 'S': res.non_space = true; return false;
+            case 'p': case 'P':
+                if (next() != '{') {
+                    throw unicode_regex_unsupported("bad unicode category");
+                }
+                res.categories = category(next());
+                if (next() != '}') {
+                    throw unicode_regex_unsupported("unicode subcategories are not supported");
+                }
+                res.negated = c == 'P';
+                return false;
+            case 'r': res = literal('\r'); return true;
+            case 'n': res = literal('\n'); return true;
+            case 't': res = literal('\t'); return true;
+            case 'f': res = literal('\f'); return true;
+            case 'v': res = literal('\v'); return true;
+        }
+        if (('0' <= c && c <= '9') || ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z')) {
+            throw unicode_regex_unsupported("unsupported escape");
+        }
+        res = literal(c);
+        return true;
+    }
+
+    // after '['
+    unicode_regex_cset parse_class() {
+        unicode_regex_cset res;
+        if (peek() == '^') {
+            res.negated = true;
+            ++pos;
+        }
+
+        while (true) {
+            uint32_t lo = next();
+            if (lo == ']') {
+                break;
+            }
+            if (lo == '[') {
+                throw unicode_regex_unsupported("nested character classes are not supported");
+            }
+            if (lo == '\\') {
+                unicode_regex_cset esc;
+                if (!parse_escape(esc)) {
+                    if (esc.negated) {
+                        // \D, \W and \P{X} would need the complement of a category
+                        if (esc.categories) {
+                            throw unicode_regex_unsupported("negated category in a class");
+                        }
+                        uint32_t start = 0;
+                        for (const auto & range : esc.ranges) {
+                            if (range.first > start) {
+                                res.ranges.push_back({start, range.first - 1});
+                            }
+                            start = range.second + 1;
+                        }
+                        res.ranges.push_back({start, MAX_CODEPOINTS - 1});
+                    } else {
+                        res.ranges.insert(res.ranges.end(), esc.ranges.begin(), esc.ranges.end());
+                        res.categories |= esc.categories;
+                        res.space      |= esc.space;
+                        res.non_space  |= esc.non_space;
+                    }
+                    continue;
+                }
+                lo = esc.ranges[0].first;
+            }
+
+            uint32_t hi = lo;
+            if (peek() == '-' && pos + 1 < re.size() && re[pos + 1] != ']') {
+                ++pos;
+                hi = next();
+                if (hi == '\\') {
+                    unicode_regex_cset esc;
+                    if (!parse_escape(esc)) {
+                        throw unicode_regex_unsupported("bad range in a class");
+                    }
+                    hi = esc.ranges[0].first;
+                }
+                if (hi < lo) {
+                    throw unicode_regex_unsupported("bad range in a class");
+                }
+            }
+            res.ranges.push_back({lo, hi});
+        }
+
+        return res;
+    }
+
+    unicode_regex_node parse_primary() {
+        const uint32_t c = next();
+
+        unicode_regex_node node;
+        node.type = unicode_regex_node::CHAR;
+
+        switch (c) {
+            case '(':
+                {
+                    bool lookahead = false;
+                    bool negated   = false;
+                    if (accept("?:")) {
+                    } else if (accept("?=")) {
+                        lookahead = true;
+                    } else if (accept("?!")) {
+                        lookahead = negated = true;
+                    } else if (peek() == '?') {
+                        throw unicode_regex_unsupported("unsupported group");
+                    }
+                    unicode_regex_node inner = parse_alt();
+                    if (next() != ')') {
+                        throw unicode_regex_unsupported("unbalanced parenthesis");
+                    }
+                    if (!lookahead) {
+                        return inner;
+                    }
+                    if (inner.type != unicode_regex_node::CHAR) {
+                        throw unicode_regex_unsupported("lookaheads longer than one code point are not supported");
+                    }
+                    inner.type    = unicode_regex_node::ASSERT;
+                    inner.negated = negated;
+                    return inner;
+                }
+            case '[':
+                node.atom = add_atom(parse_class());
+                return node;
+            case '.':
+                {
+                    unicode_regex_cset any;
+                    any.ranges  = { {'\n', '\n'}, {'\r', '\r'}, {0x2028, 0x2029} };
+                    any.negated = true;
+                    node.atom = add_atom(any);
+                    return node;
+                }
+            case '$':
+                node.type = unicode_regex_node::END;
+                return node;
+            case '\\':
+                {
+                    unicode_regex_cset esc;
+                    parse_escape(esc);
+                    node.atom = add_atom(esc);
+                    return node;
+                }
+            case '^': case ')': case '|': case '*': case '+': case '?': case '{':
+                throw unicode_regex_unsupported("unexpected character");
+        }
+
+        node.atom = add_atom(literal(c));
+        return node;
+    }
+
+    int32_t parse_int() {
+        int32_t res = 0;
+        if (peek() < '0' || peek() > '9') {
+            throw unicode_regex_unsupported("bad repetition");
+        }
+        while ('0' <= peek() && peek() <= '9') {
+            res = 10*res + (int32_t) (next() - '0');
+            if (res > 1000) {
+                throw unicode_regex_unsupported("repetition too large");
+            }
+        }
+        return res;
+    }
+
+    unicode_regex_node parse_repeat() {
+        unicode_regex_node node = parse_primary();
+
+        while (true) {
+            int32_t min = 0;
+            int32_t max = -1;
+            if (accept("*")) {
+            } else if (accept("+")) {
+                min = 1;
+            } else if (accept("?")) {
+                max = 1;
+            } else if (accept("{")) {
+                min = max = parse_int();
+                if (accept(",")) {
+                    max = peek() == '}' ? -1 : parse_int();
+                }
+                if (next() != '}' || (max >= 0 && max < min)) {
+                    throw unicode_regex_unsupported("bad repetition");
+                }
+            } else {
+                break;
+            }
+            if (peek() == '?' || peek() == '+') {
+                throw unicode_regex_unsupported("lazy and possessive quantifiers are not supported");
+            }
+            if (node.type == unicode_regex_node::ASSERT || node.type == unicode_regex_node::END) {
+                throw unicode_regex_unsupported("repeated assertion");
+            }
+
+            unicode_regex_node rep;
+            rep.type = unicode_regex_node::REPEAT;
+            rep.min  = min;
+            rep.max  = max;
+            rep.kids.push_back(std::move(node));
+            node = std::move(rep);
+        }
+
+        return node;
+    }
+
+    unicode_regex_node parse_cat() {
+        unicode_regex_node cat;
+        cat.type = unicode_regex_node::CAT;
+        while (pos < re.size() && peek() != '|' && peek() != ')') {
+            cat.kids.push_back(parse_repeat());
+        }
+        if (cat.kids.size() == 1) {
+            return std::move(cat.kids[0]);
+        }
+        return cat;
+    }
+
+    unicode_regex_node parse_alt() {
+        unicode_regex_node alt;
+        alt.type = unicode_regex_node::ALT;
+        alt.kids.push_back(parse_cat());
+        while (accept("|")) {
+            alt.kids.push_back(parse_cat());
+        }
+        if (alt.kids.size() == 1) {
+            return std::move(alt.kids[0]);
+        }
+        return alt;
+    }
+};
+
+struct unicode_regex_inst {
+    enum op_t : uint8_t { CHAR, ASSERT, SPLIT, JMP, MATCH };
+
+    op_t    op;
+    bool    negated = false;  // ASSERT
+    int32_t x       = 0;      // CHAR, ASSERT: code point set, -1 = end of text; SPLIT, JMP: target
+    int32_t y       = 0;      // SPLIT: lower priority target
+};
+
+static void unicode_regex_emit(const unicode_regex_node & node, std::vector<unicode_regex_inst> & prog) {
+    using inst = unicode_regex_inst;
+
+    if (prog.size() > 16384) {
+        throw unicode_regex_unsupported("regex too large");
+    }
+
+    switch (node.type) {
+        case unicode_regex_node::CHAR:
+            prog.push_back({inst::CHAR, false, node.atom, 0});
+            break;
+        case unicode_regex_node::ASSERT:
+            prog.push_back({inst::ASSERT, node.negated, node.atom, 0});
+            break;
+        case unicode_regex_node::END:
+            prog.push_back({inst::ASSERT, false, -1, 0});
+            break;
+        case unicode_regex_node::CAT:
+            for (const auto & kid : node.kids) {
+                unicode_regex_emit(kid, prog);
+            }
+            break;
+        case unicode_regex_node::ALT:
+            {
+                std::vector<size_t> jumps;
+                for (size_t i = 0; i < node.kids.size(); ++i) {
+                    if (i + 1 == node.kids.size()) {
+                        unicode_regex_emit(node.kids[i], prog);
+                        break;
+                    }
+                    const size_t split = prog.size();
+                    prog.push_back({inst::SPLIT, false, (int32_t) split + 1, 0});
+                    unicode_regex_emit(node.kids[i], prog);
+                    jumps.push_back(prog.size());
+                    prog.push_back({inst::JMP, false, 0, 0});
+                    prog[split].y = (int32_t) prog.size();
+                }
+                for (size_t jump : jumps) {
+                    prog[jump].x = (int32_t) prog.size();
+                }
+            } break;
+        case unicode_regex_node::REPEAT:
+            {
+                for (int32_t i = 0; i < node.min; ++i) {
+                    unicode_regex_emit(node.kids[0], prog);
+                }
+                if (node.max < 0) {
+                    const size_t split = prog.size();
+                    prog.push_back({inst::SPLIT, false, (int32_t) split + 1, 0});
+                    unicode_regex_emit(node.kids[0], prog);
+                    prog.push_back({inst::JMP, false, (int32_t) split, 0});
+                    prog[split].y = (int32_t) prog.size();
+                } else {
+                    std::vector<size_t> splits;
+                    for (int32_t i = node.min; i < node.max; ++i) {
+                        splits.push_back(prog.size());
+                        prog.push_back({inst::SPLIT, false, (int32_t) prog.size() + 1, 0});
+                        unicode_regex_emit(node.kids[0], prog);
+                    }
+                    for (size_t split : splits) {
+                        prog[split].y = (int32_t) prog.size();
+                    }
+                }
+            } break;
+    }
+}
+
+struct unicode_regex_dfa {
+    static const int32_t MATCH = 0x40000000;  // transition flag: the regex matches before the code point
+    static const int32_t DEAD  = 0;
+    static const int32_t START = 1;
+
+    // code point -> class: ASCII directly, above through the interval of the
+    // explicit ranges and the flag group
+    uint8_t               ascii_class[128];
+    std::vector<uint32_t> bounds;   // start of the intervals above ASCII, bounds[0] = 128
+    std::vector<uint8_t>  classes;  // [interval][flag group]
+    int32_t               n_groups  = 0;
+    int32_t               n_classes = 0;  // class n_classes is the end of the text
+
+    std::vector<int32_t> next;  // [state][class], state | MATCH
+
+    uint8_t class_of(uint32_t cpt) const {
+        if (cpt < 128) {
+            return ascii_class[cpt];
+        }
+        const size_t k = bounds.size() == 1 ? 0 : std::upper_bound(bounds.begin(), bounds.end(), cpt) - bounds.begin() - 1;
+        return classes[k*n_groups + unicode_regex_get_flag_groups().group[unicode_regex_flags(cpt)]];
+    }
+};
+
+static std::unique_ptr<unicode_regex_dfa> unicode_regex_dfa_compile(const std::string & regex_expr) {
+    using inst = unicode_regex_inst;
+
+    unicode_regex_parser parser;
+    parser.re = unicode_cpts_from_utf8(regex_expr);
+
+    const unicode_regex_node root = parser.parse_alt();
+    if (parser.pos != parser.re.size()) {
+        throw unicode_regex_unsupported("unbalanced parenthesis");
+    }
+
+    std::vector<inst> prog;
+    unicode_regex_emit(root, prog);
+    prog.push_back({inst::MATCH, false, 0, 0});
+
+    const auto & atoms  = parser.atoms;
+    const auto & groups = unicode_regex_get_flag_groups();
+
+    auto dfa = std::make_unique<unicode_regex_dfa>();
+
+    // intervals above ASCII in which every explicit range is either all in or all out
+    dfa->bounds = { 128 };
+    for (const auto & atom : atoms) {
+        for (const auto & range : atom.ranges) {
+            if (range.first > 128) {
+                dfa->bounds.push_back(range.first);
+            }
+            if (range.second + 1 > 128 && range.second + 1 < MAX_CODEPOINTS) {
+                dfa->bounds.push_back(range.second + 1);
+            }
+        }
+    }
+    std::sort(dfa->bounds.begin(), dfa->bounds.end());
+    dfa->bounds.erase(std::unique(dfa->bounds.begin(), dfa->bounds.end()), dfa->bounds.end());
+
+    // classes: code points that all code point sets of the regex treat alike
+    std::map<uint64_t, uint8_t> class_ids;
+    std::vector<uint64_t>       class_atoms;
+    auto get_class = [&](uint32_t cpt, uint16_t flags) -> uint8_t {
+        uint64_t bits = 0;
+        for (size_t i = 0; i < atoms.size(); ++i) {
+            bits |= (uint64_t) atoms[i].contains(cpt, flags) << i;
+        }
+        auto it = class_ids.find(bits);
+        if (it != class_ids.end()) {
+            return it->second;
+        }
+        if (class_atoms.size() == 255) {
+            throw unicode_regex_unsupported("too many classes");
+        }
+        class_atoms.push_back(bits);
+        return class_ids[bits] = (uint8_t) (class_atoms.size() - 1);
+    };
+
+    for (uint32_t cpt = 0; cpt < 128; ++cpt) {
+        dfa->ascii_class[cpt] = get_class(cpt, unicode_regex_flags(cpt));
+    }
+    dfa->n_groups = (int32_t) groups.flags.size();
+    dfa->classes.resize(dfa->bounds.size() * dfa->n_groups);
+    for (size_t k = 0; k < dfa->bounds.size(); ++k) {
+        for (int32_t g = 0; g < dfa->n_groups; ++g) {
+            dfa->classes[k*dfa->n_groups + g] = get_class(dfa->bounds[k], groups.flags[g]);
+        }
+    }
+    dfa->n_classes = (int32_t) class_atoms.size();
+
+    const int32_t n_trans = dfa->n_classes + 1;
+    const int32_t c_end   = dfa->n_classes;
+
+    auto has_atom = [&](int32_t c, int32_t atom) {
+        return c != c_end && (class_atoms[c] >> atom & 1);
+    };
+
+    // states: ordered lists of the threads waiting at CHAR instructions + 1
+    std::vector<std::vector<int32_t>>          states;
+    std::map<std::vector<int32_t>, int32_t>    state_ids;
+    auto get_state = [&](const std::vector<int32_t> & threads) -> int32_t {
+        auto it = state_ids.find(threads);
+        if (it != state_ids.end()) {
+            return it->second;
+        }
+        if (states.size() == 4096) {
+            throw unicode_regex_unsupported("too many states");
+        }
+        states.push_back(threads);
+        return state_ids[threads] = (int32_t) states.size() - 1;
+    };
+
+    get_state({});   // DEAD
+    get_state({0});  // START
+
+    std::vector<uint8_t> visited(prog.size());
+    std::vector<int32_t> stack;
+    std::vector<int32_t> waiting;
+    std::vector<int32_t> threads;
+
+    for (size_t s = 0; s < states.size(); ++s) {
+        for (int32_t c = 0; c < n_trans; ++c) {
+            // follow the threads in priority order, with c as the lookahead
+            std::fill(visited.begin(), visited.end(), 0);
+            waiting.clear();
+            bool matched = false;
+
+            for (size_t t = 0; t < states[s].size() && !matched; ++t) {
+                stack.assign(1, states[s][t]);
+                while (!stack.empty() && !matched) {
+                    const int32_t pc = stack.back();
+                    stack.pop_back();
+                    if (visited[pc]) {
+                        continue;
+                    }
+                    visited[pc] = 1;
+
+                    const inst & in = prog[pc];
+                    switch (in.op) {
+                        case inst::CHAR:
+                            waiting.push_back(pc);
+                            break;
+                        case inst::MATCH:
+                            // the threads of lower priority are dropped
+                            matched = true;
+                            break;
+                        case inst::JMP:
+                            stack.push_back(in.x);
+                            break;
+                        case inst::SPLIT:
+                            stack.push_back(in.y);
+                            stack.push_back(in.x);
+                            break;
+                        case inst::ASSERT:
+                            if ((in.x < 0 ? c == c_end : has_atom(c, in.x)) != in.negated) {
+                                stack.push_back(pc + 1);
+                            }
+                            break;
+                    }
+                }
+            }
+
+            threads.clear();
+            for (int32_t pc : waiting) {
+                if (has_atom(c, prog[pc].x) && std::find(threads.begin(), threads.end(), pc + 1) == threads.end()) {
+                    threads.push_back(pc + 1);
+                }
+            }
+
+            const int32_t id = get_state(threads);
+            dfa->next.resize(states.size() * n_trans);
+            dfa->next[s*n_trans + c] = id | (matched ? unicode_regex_dfa::MATCH : 0);
+        }
+    }
+
+    // an empty match would need the std::regex rules for advancing past it
+    for (int32_t c = 0; c < n_trans; ++c) {
+        if (dfa->next[unicode_regex_dfa::START*n_trans + c] & unicode_regex_dfa::MATCH) {
+            throw unicode_regex_unsupported("regex matches the empty string");
+        }
+    }
+
+    return dfa;
+}
+
+// compiled regexes, nullptr for the ones the DFA does not support
+static const unicode_regex_dfa * unicode_regex_dfa_get(const std::string & regex_expr) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::unique_ptr<unicode_regex_dfa>> cache;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = cache.find(regex_expr);
+    if (it == cache.end()) {
+        std::unique_ptr<unicode_regex_dfa> dfa;
+        try {
+            dfa = unicode_regex_dfa_compile(regex_expr);
+        } catch (const unicode_regex_unsupported & /*ex*/) {
+            // std::regex is used instead
+        }
+        it = cache.emplace(regex_expr, std::move(dfa)).first;
+    }
+
+    return it->second.get();
+}
+
+// length of the match at pos, 0 if there is none
+static size_t unicode_regex_dfa_match(const unicode_regex_dfa & dfa, const uint8_t * cls, size_t pos, size_t end) {
+    const int32_t n_trans = dfa.n_classes + 1;
+
+    size_t  len   = 0;
+    int32_t state = unicode_regex_dfa::START;
+    for (size_t i = pos; ; ++i) {
+        const int32_t t = dfa.next[state*n_trans + (i < end ? cls[i] : dfa.n_classes)];
+        if (t & unicode_regex_dfa::MATCH) {
+            len = i - pos;
+        }
+        state = t & ~unicode_regex_dfa::MATCH;
+        if (i == end || state == unicode_regex_dfa::DEAD) {
+            break;
+        }
+    }
+
+    return len;
+}
+
+// split the text like unicode_regex_split_stl does, code points that are not matched form their own words
+static std::vector<size_t> unicode_regex_split_dfa(const unicode_regex_dfa & dfa, const std::vector<uint32_t> & cpts, const std::vector<size_t> & offsets) {
+    std::vector<uint8_t> cls(cpts.size());
+    for (size_t i = 0; i < cpts.size(); ++i) {
+        cls[i] = dfa.class_of(cpts[i]);
+    }
+
+    std::vector<size_t> bpe_offsets; // store the offset of each word
+    bpe_offsets.reserve(offsets.size()); // Reserve memory for the approximate size
+
+    size_t start = 0;
+    for (auto offset : offsets) {
+        const size_t end = start + offset;
+
+        size_t prev_end = start;
+        for (size_t pos = start; pos < end; ) {
+            const size_t len = unicode_regex_dfa_match(dfa, cls.data(), pos, end);
+            if (len == 0) {
+                ++pos;
+                continue;
+            }
+            if (pos > prev_end) {
+                bpe_offsets.push_back(pos - prev_end);
+            }
+            bpe_offsets.push_back(len);
+            pos     += len;
+            prev_end = pos;
+        }
+
+        if (prev_end < end) {
+            bpe_offsets.push_back(end - prev_end);
+        }
+        start = end;
+    }
+
+    return bpe_offsets;
+}
+
+static std::vector<size_t> unicode_regex_split_custom(const std::vector<uint32_t> & cpts, const std::string & regex_expr, const std::vector<size_t> & offsets) {
     std::vector<size_t> bpe_offsets;
 
     if (regex_expr == "'s|'t|'re|'ve|'m|'ll|'d| ?\\p{L}+| ?\\p{N}+| ?[^\\s\\p{L}\\p{N}]+|\\s+(?!\\S)") {
-        bpe_offsets = unicode_regex_split_custom_gpt2(text, offsets);
+        bpe_offsets = unicode_regex_split_custom_gpt2(cpts, offsets);
     } else if (
             regex_expr == "(?i:'s|'t|'re|'ve|'m|'ll|'d)|[^\\r\\n\\p{L}\\p{N}]?\\p{L}+|\\p{N}{1,3}| ?[^\\s\\p{L}\\p{N}]+[\\r\\n]*|\\s*[\\r\\n]+|\\s+(?!\\S)|\\s+" ||
             regex_expr == "(?:'[sS]|'[tT]|'[rR][eE]|'[vV][eE]|'[mM]|'[lL][lL]|'[dD])|[^\\r\\n\\p{L}\\p{N}]?\\p{L}+|\\p{N}{1,3}| ?[^\\s\\p{L}\\p{N}]+[\\r\\n]*|\\s*[\\r\\n]+|\\s+(?!\\S)|\\s+") {
 
-        bpe_offsets = unicode_regex_split_custom_llama3(text, offsets);
+        bpe_offsets = unicode_regex_split_custom_llama3(cpts, offsets);
     }
 
     return bpe_offsets;
@@ -571,35 +1257,38 @@ static std::vector<size_t> unicode_regex_split_custom(const std::string & text,
 // interface
 //
 
-std::string unicode_cpt_to_utf8(uint32_t cpt) {
-    std::string result;
-
+size_t unicode_cpt_to_utf8(uint32_t cpt, char * utf8) {
     if (/* 0x00 <= cpt && */ cpt <= 0x7f) {
-        result.push_back(cpt);
-        return result;
+        utf8[0] = cpt;
+        return 1;
     }
     if (0x80 <= cpt && cpt <= 0x7ff) {
-        result.push_back(0xc0 | ((cpt >> 6) & 0x1f));
-        result.push_back(0x80 | (cpt & 0x3f));
-        return result;
+        utf8[0] = 0xc0 | ((cpt >> 6) & 0x1f);
+        utf8[1] = 0x80 | (cpt & 0x3f);
+        return 2;
     }
     if (0x800 <= cpt && cpt <= 0xffff) {
-        result.push_back(0xe0 | ((cpt >> 12) & 0x0f));
-        result.push_back(0x80 | ((cpt >> 6) & 0x3f));
-        result.push_back(0x80 | (cpt & 0x3f));
-        return result;
+        utf8[0] = 0xe0 | ((cpt >> 12) & 0x0f);
+        utf8[1] = 0x80 | ((cpt >> 6) & 0x3f);
+        utf8[2] = 0x80 | (cpt & 0x3f);
+        return 3;
     }
     if (0x10000 <= cpt && cpt <= 0x10ffff) {
-        result.push_back(0xf0 | ((cpt >> 18) & 0x07));
-        result.push_back(0x80 | ((cpt >> 12) & 0x3f));
-        result.push_back(0x80 | ((cpt >> 6) & 0x3f));
-        result.push_back(0x80 | (cpt & 0x3f));
-        return result;
+        utf8[0] = 0xf0 | ((cpt >> 18) & 0x07);
+        utf8[1] = 0x80 | ((cpt >> 12) & 0x3f);
+        utf8[2] = 0x80 | ((cpt >> 6) & 0x3f);
+        utf8[3] = 0x80 | (cpt & 0x3f);
+        return 4;
     }
 
     throw std::invalid_argument("invalid codepoint");
 }
 
+std::string unicode_cpt_to_utf8(uint32_t cpt) {
+    char utf8[4];
+    return std::string(utf8, unicode_cpt_to_utf8(cpt, utf8));
+}
+
 std::vector<uint32_t> unicode_cpts_normalize_nfd(const std::vector<uint32_t> & cpts) {
     auto comp = [] (const uint32_t cpt, const range_nfd & range) {
         return cpt < range.first;
@@ -631,9 +1320,9 @@ std::vector<uint32_t> unicode_cpts_from_utf8(const std::string & utf8) {
 }
 
 unicode_cpt_flags unicode_cpt_flags_from_cpt(const uint32_t cpt) {
-    static const unicode_cpt_flags undef(unicode_cpt_flags::UNDEFINED);
-    static const auto cpt_flags = unicode_cpt_flags_array();
-    return cpt < cpt_flags.size() ? cpt_flags[cpt] : undef;
+    // codepoints past the end share the last, UNDEFINED block
+    const uint32_t c = std::min(cpt, MAX_CODEPOINTS);
+    return unicode_cpt_flags(unicode_flags_stage2[unicode_flags_stage1[c >> 8]*256 + (c & 0xFF)]);
 }
 
 unicode_cpt_flags unicode_cpt_flags_from_utf8(const std::string & utf8) {
@@ -646,13 +1335,22 @@ unicode_cpt_flags unicode_cpt_flags_from_utf8(const std::string & utf8) {
 }
 
 std::string unicode_byte_to_utf8(uint8_t byte) {
-    static std::unordered_map<uint8_t, std::string> map = unicode_byte_to_utf8_map();
-    return map.at(byte);
+    return std::string(k_unicode_byte_map.utf8[byte], k_unicode_byte_map.utf8_len[byte]);
 }
 
 uint8_t unicode_utf8_to_byte(const std::string & utf8) {
-    static std::unordered_map<std::string, uint8_t> map = unicode_utf8_to_byte_map();
-    return map.at(utf8);
+    // the byte codepoints are encoded in one or two bytes
+    uint32_t cpt = 0xFFFFFFFF;
+    if (utf8.size() == 1 && !(utf8[0] & 0x80)) {
+        cpt = utf8[0];
+    } else if (utf8.size() == 2 && (utf8[0] & 0xE0) == 0xC0 && (utf8[1] & 0xC0) == 0x80) {
+        cpt = ((utf8[0] & 0x1F) << 6) | (utf8[1] & 0x3F);
+        cpt = cpt < 0x80 ? 0xFFFFFFFF : cpt;  // overlong
+    }
+    if (cpt >= 256 + 68 || k_unicode_byte_map.byte[cpt] < 0) {
+        throw std::out_of_range("not a byte-level BPE codepoint");
+    }
+    return (uint8_t) k_unicode_byte_map.byte[cpt];
 }
 
 uint32_t unicode_tolower(uint32_t cpt) {
@@ -696,6 +1394,10 @@ std::vector<std::string> unicode_regex_split(const std::string & text, const std
     // compute collapsed codepoints only if needed by at least one regex
     bool need_collapse = false;
     for (const auto & regex_expr : regex_exprs) {
+        // the DFA matches the codepoints directly
+        if (unicode_regex_dfa_get(regex_expr)) {
+            continue;
+        }
         // search for unicode categories
         for (const auto & ucat : k_ucat_enum) {
             if (std::string::npos != regex_expr.find(ucat.first)) {
@@ -739,13 +1441,19 @@ std::vector<std::string> unicode_regex_split(const std::string & text, const std
 
     for (const auto & regex_expr : regex_exprs) {
         // first, see if we have an efficient custom regex implementation
-        auto tmp = unicode_regex_split_custom(text, regex_expr, bpe_offsets);
+        auto tmp = unicode_regex_split_custom(cpts, regex_expr, bpe_offsets);
 
         if (!tmp.empty()) {
             bpe_offsets = std::move(tmp);
             continue;
         }
 
+        // then the DFA, which handles the pre-tokenizer regexes in linear time
+        if (const unicode_regex_dfa * dfa = unicode_regex_dfa_get(regex_expr)) {
+            bpe_offsets = unicode_regex_split_dfa(*dfa, cpts, bpe_offsets);
+            continue;
+        }
+
         // fallback to general-purpose std::regex / std::wregex
         try {
             // if a unicode category is used in the regex, we use the collapsed text and replace the unicode category
@@ -833,17 +1541,5 @@ std::vector<std::string> unicode_regex_split(const std::string & text, const std
         }
     }
 
-    std::vector<std::string> bpe_words;
-    bpe_words.reserve(bpe_offsets.size()); // reserve memory for the approximate size
-
-    size_t start = 0;
-    for (size_t & offset : bpe_offsets) {
-        bpe_words.emplace_back();
-        for (size_t i = start; i < start + offset; ++i) {
-            bpe_words.back() += unicode_cpt_to_utf8(cpts[i]);
-        }
-        start += offset;
-    }
-
-    return unicode_byte_encoding_process(bpe_words);
+    return unicode_byte_encoding_process(cpts, bpe_offsets);
 }
@@ -49,6 +49,7 @@ struct unicode_cpt_flags {
 size_t unicode_len_utf8(char src);
 
 std::string unicode_cpt_to_utf8  (uint32_t cpt);
+size_t      unicode_cpt_to_utf8  (uint32_t cpt, char * utf8); // writes up to 4 bytes, returns the length
 uint32_t    unicode_cpt_from_utf8(const std::string & utf8, size_t & offset);
 
 std::vector<uint32_t> unicode_cpts_from_utf8(const std::string & utf8);
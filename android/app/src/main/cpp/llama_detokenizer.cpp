@@ -0,0 +1,199 @@
+#include "llama_detokenizer.h"
+
+#include <android/log.h>
+#include <cstring>
+
+#define LOG_TAG "LlamaCpp"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+struct piece_table {
+    std::vector<uint32_t> offsets;   // piece i is blob[offsets[i], offsets[i + 1])
+    std::vector<char>     blob;
+    std::vector<uint8_t>  complete;  // the piece is valid UTF-8 made of whole characters
+};
+
+static const char k_replacement[] = "\xEF\xBF\xBD";  // U+FFFD
+
+// Length of the UTF-8 character that starts with c, 0 if c cannot start one
+static int32_t utf8_len(uint8_t c) {
+    if (c < 0x80) {
+        return 1;
+    }
+    if (c < 0xC2) {
+        return 0;  // continuation byte, or the lead of an overlong 2-byte form
+    }
+    if (c < 0xE0) {
+        return 2;
+    }
+    if (c < 0xF0) {
+        return 3;
+    }
+    return c < 0xF5 ? 4 : 0;
+}
+
+// Whether c can be byte i (> 0) of a character that starts with lead. The second
+// byte excludes overlong forms, surrogates and code points past U+10FFFF.
+static bool utf8_continues(uint8_t lead, int32_t i, uint8_t c) {
+    if (i == 1) {
+        switch (lead) {
+            case 0xE0: return c >= 0xA0 && c <= 0xBF;
+            case 0xED: return c >= 0x80 && c <= 0x9F;
+            case 0xF0: return c >= 0x90 && c <= 0xBF;
+            case 0xF4: return c >= 0x80 && c <= 0x8F;
+        }
+    }
+    return (c & 0xC0) == 0x80;
+}
+
+static bool utf8_is_complete(const char * text, size_t n) {
+    for (size_t i = 0; i < n; ) {
+        const uint8_t lead = text[i];
+        const int32_t len = utf8_len(lead);
+        if (len == 0 || i + len > n) {
+            return false;
+        }
+        for (int32_t k = 1; k < len; ++k) {
+            if (!utf8_continues(lead, k, text[i + k])) {
+                return false;
+            }
+        }
+        i += len;
+    }
+    return true;
+}
+
+piece_table * piece_table_init(const llama_vocab * vocab) {
+    const int32_t n_tokens = llama_vocab_n_tokens(vocab);
+
+    piece_table * pieces = new piece_table;
+    pieces->offsets.resize(n_tokens + 1);
+    pieces->complete.resize(n_tokens);
+    pieces->blob.reserve((size_t) n_tokens * 8);
+
+    std::vector<char> buf(256);
+    for (llama_token id = 0; id < n_tokens; ++id) {
+        int32_t n = llama_token_to_piece(vocab, id, buf.data(), (int32_t) buf.size(), 0, false);
+        if (n < 0) {
+            buf.resize(-n);
+            n = llama_token_to_piece(vocab, id, buf.data(), (int32_t) buf.size(), 0, false);
+        }
+        if (n < 0) {
+            LOGE("Failed to convert token %d to string", id);
+            n = 0;
+        }
+
+        pieces->offsets[id] = (uint32_t) pieces->blob.size();
+        pieces->blob.insert(pieces->blob.end(), buf.data(), buf.data() + n);
+        pieces->complete[id] = utf8_is_complete(buf.data(), n);
+    }
+    pieces->offsets[n_tokens] = (uint32_t) pieces->blob.size();
+    pieces->blob.shrink_to_fit();
+
+    LOGI("Piece table: %d tokens, %zu bytes", n_tokens, piece_table_size(pieces));
+    return pieces;
+}
+
+void piece_table_free(piece_table * pieces) {
+    delete pieces;
+}
+
+int32_t piece_table_n_tokens(const piece_table * pieces) {
+    return (int32_t) pieces->complete.size();
+}
+
+size_t piece_table_size(const piece_table * pieces) {
+    return pieces->offsets.size() * sizeof(uint32_t) + pieces->blob.size() + pieces->complete.size();
+}
+
+void detokenizer_init(detokenizer & detok, const piece_table * pieces) {
+    detok.pieces    = pieces;
+    detok.n_partial = 0;
+    detok.n_needed  = 0;
+}
+
+// Appends the complete characters of text, holding back a character cut off at the end
+static void detokenizer_append(detokenizer & detok, const char * text, size_t n, std::string & out) {
+    size_t i = 0;
+
+    // finish the character left over from the previous token
+    while (detok.n_partial > 0 && i < n) {
+        if (!utf8_continues(detok.partial[0], detok.n_partial, text[i])) {
+            out.append(k_replacement);
+            detok.n_partial = 0;
+            break;
+        }
+        detok.partial[detok.n_partial++] = text[i++];
+        if (detok.n_partial == detok.n_needed) {
+            out.append(detok.partial, detok.n_needed);
+            detok.n_partial = 0;
+        }
+    }
+
+    // copy runs of complete characters at once
+    size_t run = i;
+    while (i < n) {
+        const uint8_t lead = text[i];
+        if (lead < 0x80) {
+            ++i;
+            continue;
+        }
+
+        const int32_t len = utf8_len(lead);
+        int32_t k = 1;
+        while (k < len && i + k < n && utf8_continues(lead, k, text[i + k])) {
+            ++k;
+        }
+        if (len > 0 && k == len) {
+            i += len;
+            continue;
+        }
+
+        out.append(text + run, i - run);
+        if (len > 0 && i + k == n) {
+            memcpy(detok.partial, text + i, k);
+            detok.n_partial = k;
+            detok.n_needed  = len;
+            return;
+        }
+        out.append(k_replacement);
+        i += k;
+        run = i;
+    }
+    out.append(text + run, n - run);
+}
+
+void detokenizer_push(detokenizer & detok, llama_token token, std::string & out) {
+    const piece_table * pieces = detok.pieces;
+    if (token < 0 || token >= piece_table_n_tokens(pieces)) {
+        LOGE("Token %d is not in the vocab", token);
+        return;
+    }
+
+    const char * text = pieces->blob.data() + pieces->offsets[token];
+    const size_t n    = pieces->offsets[token + 1] - pieces->offsets[token];
+
+    if (detok.n_partial == 0 && pieces->complete[token]) {
+        out.append(text, n);
+    } else {
+        detokenizer_append(detok, text, n, out);
+    }
+}
+
+void detokenizer_flush(detokenizer & detok, std::string & out) {
+    if (detok.n_partial > 0) {
+        out.append(k_replacement);
+        detok.n_partial = 0;
+    }
+}
+
+std::string detokenize(const piece_table * pieces, const std::vector<llama_token> & tokens) {
+    std::string result;
+    detokenizer detok;
+    detokenizer_init(detok, pieces);
+    for (const llama_token id : tokens) {
+        detokenizer_push(detok, id, result);
+    }
+    detokenizer_flush(detok, result);
+    return result;
+}
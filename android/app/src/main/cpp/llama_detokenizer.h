@@ -0,0 +1,50 @@
+#pragma once
+
+#include "llama.h"
+
+#include <string>
+#include <vector>
+
+// Token ids to text while generating
+//
+// The text of every token is rendered once when the model is loaded, into one
+// blob with an offset per token, so turning a token into text is a table lookup
+// and a copy instead of a llama_token_to_piece call.
+//
+// Byte-level vocabs split multi-byte characters (emoji, CJK) over several tokens.
+// The detokenizer only emits complete UTF-8 characters: the start of a character
+// is held back until the tokens that complete it arrive. Bytes that cannot be
+// part of valid UTF-8 become U+FFFD, so every chunk of output is valid UTF-8 on
+// its own and can be handed to NewStringUTF as it is.
+
+struct piece_table;
+
+// Renders the pieces like llama_token_to_piece with special = false (control
+// tokens are empty)
+piece_table * piece_table_init(const llama_vocab * vocab);
+void          piece_table_free(piece_table * pieces);
+
+int32_t piece_table_n_tokens(const piece_table * pieces);
+
+// Bytes of the blob, offsets included
+size_t piece_table_size(const piece_table * pieces);
+
+struct detokenizer {
+    const piece_table * pieces = nullptr;
+
+    // start of a UTF-8 character that the next token continues
+    char    partial[4];
+    int32_t n_partial = 0;
+    int32_t n_needed  = 0;  // total length of that character
+};
+
+void detokenizer_init(detokenizer & detok, const piece_table * pieces);
+
+// Appends the text of token to out, up to the last complete character
+void detokenizer_push(detokenizer & detok, llama_token token, std::string & out);
+
+// Ends the stream, an incomplete character at the end becomes U+FFFD
+void detokenizer_flush(detokenizer & detok, std::string & out);
+
+// Text of a whole token sequence
+std::string detokenize(const piece_table * pieces, const std::vector<llama_token> & tokens);
@@ -0,0 +1,203 @@
+#include "llama_embedding.h"
+
+#include <android/log.h>
+#include <algorithm>
+#include <cmath>
+
+#define LOG_TAG "LlamaCpp"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+struct embedding_context {
+    llama_context * ctx = nullptr;
+
+    int32_t n_embd  = 0;
+    int32_t n_batch = 0;
+
+    // encoder-only models (BERT) are evaluated with llama_encode
+    bool use_encode = false;
+
+    llama_batch batch;
+
+    embedding_stats stats;
+};
+
+float embedding_stats::texts_per_second() const {
+    return t_us > 0 ? 1e6f * n_texts / t_us : 0.0f;
+}
+
+static llama_context * new_embedding_context(llama_model * model, const embedding_params & params, enum llama_pooling_type pooling) {
+    auto cparams = llama_context_default_params();
+    cparams.n_ctx           = params.n_ctx;
+    cparams.n_batch         = params.n_ctx;
+    cparams.n_ubatch        = params.n_ctx;  // a pooled sequence must not be split across ubatches
+    cparams.n_seq_max       = params.n_seq_max;
+    cparams.n_threads       = params.n_threads;
+    cparams.n_threads_batch = params.n_threads;
+    cparams.embeddings      = true;
+    cparams.pooling_type    = pooling;
+
+    return llama_init_from_model(model, cparams);
+}
+
+embedding_context * embedding_init(llama_model * model, const embedding_params & params) {
+    llama_context * ctx = new_embedding_context(model, params, LLAMA_POOLING_TYPE_UNSPECIFIED);
+    if (!ctx) {
+        LOGE("Failed to create embedding context");
+        return nullptr;
+    }
+
+    const enum llama_pooling_type pooling = llama_pooling_type(ctx);
+    if (pooling == LLAMA_POOLING_TYPE_RANK) {
+        LOGE("Reranking models do not produce embeddings");
+        llama_free(ctx);
+        return nullptr;
+    }
+    if (pooling == LLAMA_POOLING_TYPE_NONE) {
+        llama_free(ctx);
+        ctx = new_embedding_context(model, params, LLAMA_POOLING_TYPE_MEAN);
+        if (!ctx) {
+            LOGE("Failed to create embedding context");
+            return nullptr;
+        }
+    }
+
+    auto * emb = new embedding_context;
+    emb->ctx        = ctx;
+    emb->n_embd     = llama_model_n_embd(model);
+    emb->n_batch    = (int32_t) std::min(llama_n_batch(ctx), llama_n_ctx(ctx));  // n_batch may be padded above n_ctx
+    emb->use_encode = llama_model_has_encoder(model) && !llama_model_has_decoder(model);
+    emb->batch      = llama_batch_init(emb->n_batch, 0, 1);
+
+    LOGI("Embedding context: n_embd = %d, pooling = %d, n_batch = %d, n_seq_max = %u",
+         emb->n_embd, (int) llama_pooling_type(ctx), emb->n_batch, llama_n_seq_max(ctx));
+
+    return emb;
+}
+
+void embedding_free(embedding_context * emb) {
+    if (!emb) {
+        return;
+    }
+
+    llama_batch_free(emb->batch);
+    llama_free(emb->ctx);
+    delete emb;
+}
+
+int32_t embedding_n_embd(const embedding_context * emb) {
+    return emb->n_embd;
+}
+
+const embedding_stats & embedding_get_stats(const embedding_context * emb) {
+    return emb->stats;
+}
+
+// evaluate the packed batch and write the normalized embedding of every sequence
+static bool flush_batch(embedding_context * emb, const std::vector<int32_t> & seq_text, float * out) {
+    llama_context * ctx = emb->ctx;
+
+    llama_memory_clear(llama_get_memory(ctx), true);
+
+    const int ret = emb->use_encode ? llama_encode(ctx, emb->batch) : llama_decode(ctx, emb->batch);
+    if (ret != 0) {
+        LOGE("Failed to evaluate embedding batch, error %d", ret);
+        return false;
+    }
+
+    for (size_t s = 0; s < seq_text.size(); ++s) {
+        const float * embd = llama_get_embeddings_seq(ctx, (llama_seq_id) s);
+        if (!embd) {
+            LOGE("No pooled embedding for sequence %zu", s);
+            return false;
+        }
+
+        float * dst = out + (size_t) seq_text[s] * emb->n_embd;
+
+        double sum = 0.0;
+        for (int32_t i = 0; i < emb->n_embd; ++i) {
+            sum += (double) embd[i] * embd[i];
+        }
+        const float norm = sum > 0.0 ? (float) (1.0 / std::sqrt(sum)) : 0.0f;
+
+        for (int32_t i = 0; i < emb->n_embd; ++i) {
+            dst[i] = embd[i] * norm;
+        }
+    }
+
+    emb->stats.n_batches++;
+    emb->batch.n_tokens = 0;
+
+    return true;
+}
+
+bool embedding_encode(
+        embedding_context              * emb,
+        const std::vector<std::string> & texts,
+        float                          * out) {
+    const llama_vocab * vocab = llama_model_get_vocab(llama_get_model(emb->ctx));
+    const uint32_t n_seq_max = llama_n_seq_max(emb->ctx);
+
+    emb->stats = {};
+    const int64_t t_start_us = llama_time_us();
+
+    llama_batch & batch = emb->batch;
+    batch.n_tokens = 0;
+
+    std::vector<int32_t>     seq_text;  // text index of every sequence in the batch
+    std::vector<llama_token> tokens;
+
+    for (size_t t = 0; t < texts.size(); ++t) {
+        const std::string & text = texts[t];
+
+        tokens.resize(text.size() + 2);
+        int n_tokens = llama_tokenize(vocab, text.c_str(), (int32_t) text.size(),
+                                      tokens.data(), (int32_t) tokens.size(), true, false);
+        if (n_tokens < 0) {
+            tokens.resize(-n_tokens);
+            n_tokens = llama_tokenize(vocab, text.c_str(), (int32_t) text.size(),
+                                      tokens.data(), (int32_t) tokens.size(), true, false);
+        }
+        if (n_tokens <= 0) {
+            LOGE("Tokenization of text %zu failed with error: %d", t, n_tokens);
+            return false;
+        }
+        if (n_tokens > emb->n_batch) {
+            n_tokens = emb->n_batch;
+            emb->stats.n_trunc++;
+        }
+
+        // start a new batch when this text does not fit
+        if (batch.n_tokens + n_tokens > emb->n_batch || seq_text.size() == n_seq_max) {
+            if (!flush_batch(emb, seq_text, out)) {
+                return false;
+            }
+            seq_text.clear();
+        }
+
+        const llama_seq_id seq_id = (llama_seq_id) seq_text.size();
+        for (int i = 0; i < n_tokens; ++i) {
+            const int j = batch.n_tokens++;
+            batch.token   [j]    = tokens[i];
+            batch.pos     [j]    = i;
+            batch.n_seq_id[j]    = 1;
+            batch.seq_id  [j][0] = seq_id;
+            batch.logits  [j]    = true;
+        }
+        seq_text.push_back((int32_t) t);
+
+        emb->stats.n_texts++;
+        emb->stats.n_tokens += n_tokens;
+    }
+
+    if (!seq_text.empty() && !flush_batch(emb, seq_text, out)) {
+        return false;
+    }
+
+    emb->stats.t_us = llama_time_us() - t_start_us;
+
+    LOGI("Embedded %d texts (%d tokens) in %d batches, %.1f texts/s",
+         emb->stats.n_texts, emb->stats.n_tokens, emb->stats.n_batches, emb->stats.texts_per_second());
+
+    return true;
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "llama.h"
+
+#include <string>
+#include <vector>
+
+// Pooled sentence embeddings for on-device semantic search
+//
+// A dedicated context with embeddings enabled evaluates many texts per call:
+// the tokenized texts are packed, one sequence each, into batches of up to
+// n_ubatch tokens and n_seq_max sequences, so every llama_decode pools several
+// texts at once. The pooled vectors are L2-normalized and written straight into
+// a caller-provided buffer.
+
+struct embedding_params {
+    int32_t  n_ctx     = 2048;  // also the max tokens per batch (n_batch = n_ubatch = n_ctx)
+    uint32_t n_seq_max = 32;    // max texts per batch
+    int32_t  n_threads = 4;
+};
+
+struct embedding_stats {
+    int32_t n_texts   = 0;
+    int32_t n_tokens  = 0;
+    int32_t n_batches = 0;
+    int32_t n_trunc   = 0;  // texts cut to n_ctx tokens
+    int64_t t_us      = 0;
+
+    float texts_per_second() const;
+};
+
+struct embedding_context;
+
+// Pooling follows the model (e.g. CLS or mean for BERT-like models), models
+// without a pooling type (generative models) use mean pooling
+embedding_context * embedding_init(llama_model * model, const embedding_params & params);
+void                embedding_free(embedding_context * emb);
+
+int32_t embedding_n_embd(const embedding_context * emb);
+
+// Embeds texts into out, n_embd floats per text in the order of texts.
+// Returns false on a tokenization or decode error.
+bool embedding_encode(
+        embedding_context              * emb,
+        const std::vector<std::string> & texts,
+        float                          * out);
+
+const embedding_stats & embedding_get_stats(const embedding_context * emb);
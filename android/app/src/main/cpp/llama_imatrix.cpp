@@ -0,0 +1,361 @@
+#include "llama_imatrix.h"
+
+#include "ggml-backend.h"
+#include "gguf.h"
+
+#include <android/log.h>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#define LOG_TAG "LlamaCpp"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+struct imatrix_entry {
+    std::vector<double>  sums;    // n_mat rows of n_per_row squared activation sums
+    std::vector<int64_t> counts;  // activation rows per matrix
+};
+
+// the table of one decoding thread
+struct imatrix_accum {
+    // held by the owning thread while it adds a node and by the readers while they
+    // merge, so it is only ever contended when the matrix is saved
+    std::mutex mutex;
+
+    std::unordered_map<std::string, imatrix_entry> entries;
+
+    // copies of activations that are not in host memory
+    std::vector<uint8_t> buf_src1;
+    std::vector<uint8_t> buf_ids;
+};
+
+struct imatrix_collector {
+    uint64_t       id;
+    imatrix_params params;
+
+    mutable std::mutex                          mutex;   // guards accums
+    std::vector<std::unique_ptr<imatrix_accum>> accums;
+};
+
+// collectors are never matched by address, a freed one may be reallocated
+static std::atomic<uint64_t> next_collector_id { 1 };
+
+// the table of the calling thread, created on its first node
+static imatrix_accum * thread_accum(imatrix_collector * collector) {
+    thread_local std::vector<std::pair<uint64_t, imatrix_accum *>> cache;
+
+    for (const auto & it : cache) {
+        if (it.first == collector->id) {
+            return it.second;
+        }
+    }
+
+    imatrix_accum * accum = new imatrix_accum;
+    {
+        std::lock_guard<std::mutex> lock(collector->mutex);
+        collector->accums.emplace_back(accum);
+    }
+    cache.emplace_back(collector->id, accum);
+    return accum;
+}
+
+static bool ends_with(const char * str, const char * suffix) {
+    const size_t n = strlen(str);
+    const size_t m = strlen(suffix);
+    return n >= m && strcmp(str + n - m, suffix) == 0;
+}
+
+// a matrix of the model, not a view, a LoRA tensor or an intermediate result
+static bool is_model_weight(const imatrix_collector * collector, const ggml_tensor * w) {
+    if (w->view_src != nullptr || w->buffer == nullptr ||
+        ggml_backend_buffer_get_usage(w->buffer) != GGML_BACKEND_BUFFER_USAGE_WEIGHTS) {
+        return false;
+    }
+    if (strncmp(w->name, "blk.", 4) == 0) {
+        return ends_with(w->name, ".weight");
+    }
+    return collector->params.process_output && strcmp(w->name, "output.weight") == 0;
+}
+
+static bool wants(const imatrix_collector * collector, const ggml_tensor * t) {
+    const ggml_tensor * src0 = t->src[0];
+    const ggml_tensor * src1 = t->src[1];
+
+    if (src1->type != GGML_TYPE_F32 || src1->nb[0] != sizeof(float) || src1->ne[0] != src0->ne[0]) {
+        return false;
+    }
+
+    const int64_t n_tokens = t->op == GGML_OP_MUL_MAT_ID ? src1->ne[2] : src1->ne[1] * src1->ne[2] * src1->ne[3];
+    if (n_tokens < collector->params.min_tokens) {
+        return false;
+    }
+
+    return is_model_weight(collector, src0);
+}
+
+static const uint8_t * host_data(const ggml_tensor * t, std::vector<uint8_t> & buf) {
+    if (ggml_backend_buffer_is_host(t->buffer)) {
+        return (const uint8_t *) t->data;
+    }
+    buf.resize(ggml_nbytes(t));
+    ggml_backend_tensor_get(t, buf.data(), 0, buf.size());
+    return buf.data();
+}
+
+static inline void add_squares(double * sums, const float * x, int64_t n) {
+    for (int64_t j = 0; j < n; ++j) {
+        sums[j] += (double) x[j] * x[j];
+    }
+}
+
+static void collect(imatrix_accum * accum, const ggml_tensor * t) {
+    const ggml_tensor * src0 = t->src[0];
+    const ggml_tensor * src1 = t->src[1];
+
+    const int64_t n_per_row = src0->ne[0];
+    const int64_t n_mat     = t->op == GGML_OP_MUL_MAT_ID ? src0->ne[2] : 1;
+
+    std::lock_guard<std::mutex> lock(accum->mutex);
+
+    imatrix_entry & e = accum->entries[src0->name];
+    if (e.sums.empty()) {
+        e.sums.assign(n_mat * n_per_row, 0.0);
+        e.counts.assign(n_mat, 0);
+    } else if ((int64_t) e.sums.size() != n_mat * n_per_row) {
+        LOGE("imatrix: %s changed size from %zu to %lld", src0->name, e.sums.size(), (long long) (n_mat * n_per_row));
+        return;
+    }
+
+    const uint8_t * x = host_data(src1, accum->buf_src1);
+
+    if (t->op == GGML_OP_MUL_MAT) {
+        for (int64_t i3 = 0; i3 < src1->ne[3]; ++i3) {
+            for (int64_t i2 = 0; i2 < src1->ne[2]; ++i2) {
+                for (int64_t i1 = 0; i1 < src1->ne[1]; ++i1) {
+                    const float * row = (const float *) (x + i1*src1->nb[1] + i2*src1->nb[2] + i3*src1->nb[3]);
+                    add_squares(e.sums.data(), row, n_per_row);
+                }
+            }
+        }
+        e.counts[0] += src1->ne[1] * src1->ne[2] * src1->ne[3];
+        return;
+    }
+
+    // MUL_MAT_ID: src1 is [n_per_row, 1 or n_expert_used, n_tokens], ids is [n_expert_used, n_tokens]
+    const ggml_tensor * ids = t->src[2];
+    const uint8_t * ids_data = host_data(ids, accum->buf_ids);
+
+    for (int64_t it = 0; it < ids->ne[1]; ++it) {
+        for (int64_t k = 0; k < ids->ne[0]; ++k) {
+            const int32_t expert = *(const int32_t *) (ids_data + k*ids->nb[0] + it*ids->nb[1]);
+            if (expert < 0 || expert >= n_mat) {
+                continue;
+            }
+            const float * row = (const float *) (x + (k % src1->ne[1])*src1->nb[1] + it*src1->nb[2]);
+            add_squares(e.sums.data() + expert*n_per_row, row, n_per_row);
+            e.counts[expert]++;
+        }
+    }
+}
+
+imatrix_collector * imatrix_init(const imatrix_params & params) {
+    imatrix_collector * collector = new imatrix_collector;
+
+    collector->id     = next_collector_id++;
+    collector->params = params;
+
+    return collector;
+}
+
+void imatrix_free(imatrix_collector * collector) {
+    delete collector;
+}
+
+bool imatrix_eval_callback(struct ggml_tensor * t, bool ask, void * user_data) {
+    auto * collector = (imatrix_collector *) user_data;
+
+    if (t->op != GGML_OP_MUL_MAT && t->op != GGML_OP_MUL_MAT_ID) {
+        // returning false to a node that was not asked for would stop the graph
+        return !ask;
+    }
+
+    if (ask) {
+        return wants(collector, t);
+    }
+
+    collect(thread_accum(collector), t);
+    return true;
+}
+
+// the tables of all threads added up, in name order
+static std::map<std::string, imatrix_entry> merge(const imatrix_collector * collector) {
+    std::map<std::string, imatrix_entry> merged;
+
+    std::lock_guard<std::mutex> lock(collector->mutex);
+    for (const auto & accum : collector->accums) {
+        std::lock_guard<std::mutex> accum_lock(accum->mutex);
+        for (const auto & it : accum->entries) {
+            imatrix_entry & dst = merged[it.first];
+            if (dst.sums.empty()) {
+                dst = it.second;
+                continue;
+            }
+            if (dst.sums.size() != it.second.sums.size()) {
+                continue;
+            }
+            for (size_t j = 0; j < dst.sums.size(); ++j) {
+                dst.sums[j] += it.second.sums[j];
+            }
+            for (size_t j = 0; j < dst.counts.size(); ++j) {
+                dst.counts[j] += it.second.counts[j];
+            }
+        }
+    }
+
+    return merged;
+}
+
+int64_t imatrix_n_tokens(const imatrix_collector * collector) {
+    int64_t n_tokens = 0;
+    for (const auto & it : merge(collector)) {
+        if (it.second.counts.size() == 1) {
+            n_tokens = std::max(n_tokens, it.second.counts[0]);
+        }
+    }
+    return n_tokens;
+}
+
+int32_t imatrix_n_entries(const imatrix_collector * collector) {
+    return (int32_t) merge(collector).size();
+}
+
+bool imatrix_save(const imatrix_collector * collector, const char * path, const char * dataset) {
+    const std::map<std::string, imatrix_entry> merged = merge(collector);
+    if (merged.empty()) {
+        LOGE("imatrix: nothing collected yet");
+        return false;
+    }
+
+    int64_t n_tokens = 0;
+    size_t  n_bytes  = 0;
+    for (const auto & it : merged) {
+        if (it.second.counts.size() == 1) {
+            n_tokens = std::max(n_tokens, it.second.counts[0]);
+        }
+        n_bytes += (it.second.sums.size() + it.second.counts.size()) * sizeof(float);
+    }
+
+    ggml_init_params ip = {
+        /*.mem_size   =*/ 2 * merged.size() * (ggml_tensor_overhead() + GGML_MEM_ALIGN) + n_bytes,
+        /*.mem_buffer =*/ nullptr,
+        /*.no_alloc   =*/ false,
+    };
+    ggml_context * ctx = ggml_init(ip);
+    gguf_context * gguf = gguf_init_empty();
+
+    gguf_set_val_str(gguf, "general.type", "imatrix");
+    gguf_set_arr_str(gguf, "imatrix.datasets", &dataset, 1);
+    // every token counts as a chunk of one
+    gguf_set_val_u32(gguf, "imatrix.chunk_count", (uint32_t) n_tokens);
+    gguf_set_val_u32(gguf, "imatrix.chunk_size", 1);
+
+    for (const auto & it : merged) {
+        const imatrix_entry & e = it.second;
+        const int64_t n_mat     = (int64_t) e.counts.size();
+        const int64_t n_per_row = (int64_t) e.sums.size() / n_mat;
+
+        if (it.first.size() + strlen(".in_sum2") >= GGML_MAX_NAME) {
+            LOGE("imatrix: name %s is too long, skipped", it.first.c_str());
+            continue;
+        }
+
+        ggml_tensor * in_sum2 = ggml_new_tensor_2d(ctx, GGML_TYPE_F32, n_per_row, n_mat);
+        ggml_tensor * counts  = ggml_new_tensor_2d(ctx, GGML_TYPE_F32, 1, n_mat);
+        ggml_format_name(in_sum2, "%s.in_sum2", it.first.c_str());
+        ggml_format_name(counts,  "%s.counts",  it.first.c_str());
+
+        for (size_t j = 0; j < e.sums.size(); ++j) {
+            ((float *) in_sum2->data)[j] = (float) e.sums[j];
+        }
+        for (int64_t j = 0; j < n_mat; ++j) {
+            ((float *) counts->data)[j] = (float) e.counts[j];
+        }
+
+        gguf_add_tensor(gguf, in_sum2);
+        gguf_add_tensor(gguf, counts);
+    }
+
+    const bool ok = gguf_write_to_file(gguf, path, false);
+    if (ok) {
+        LOGI("imatrix: %zu weights from %lld tokens written to %s", merged.size(), (long long) n_tokens, path);
+    } else {
+        LOGE("imatrix: failed to write %s", path);
+    }
+
+    gguf_free(gguf);
+    ggml_free(ctx);
+    return ok;
+}
+
+bool imatrix_load(const char * path, std::unordered_map<std::string, std::vector<float>> & data) {
+    ggml_context * ctx = nullptr;
+    gguf_init_params gp = {
+        /*.no_alloc =*/ false,
+        /*.ctx      =*/ &ctx,
+    };
+    gguf_context * gguf = gguf_init_from_file(path, gp);
+    if (!gguf) {
+        LOGE("imatrix: failed to read %s", path);
+        return false;
+    }
+
+    const int64_t kid = gguf_find_key(gguf, "general.type");
+    if (kid < 0 || gguf_get_kv_type(gguf, kid) != GGUF_TYPE_STRING || strcmp(gguf_get_val_str(gguf, kid), "imatrix") != 0) {
+        LOGE("imatrix: %s is not an imatrix file", path);
+        gguf_free(gguf);
+        ggml_free(ctx);
+        return false;
+    }
+
+    data.clear();
+
+    bool ok = true;
+    for (ggml_tensor * sums = ggml_get_first_tensor(ctx); sums; sums = ggml_get_next_tensor(ctx, sums)) {
+        if (!ends_with(sums->name, ".in_sum2")) {
+            continue;
+        }
+
+        const std::string name(sums->name, strlen(sums->name) - strlen(".in_sum2"));
+        const ggml_tensor * counts = ggml_get_tensor(ctx, (name + ".counts").c_str());
+        if (!counts || sums->type != GGML_TYPE_F32 || counts->type != GGML_TYPE_F32 ||
+            counts->ne[0] != 1 || counts->ne[1] != sums->ne[1]) {
+            LOGE("imatrix: malformed entry %s in %s", name.c_str(), path);
+            ok = false;
+            break;
+        }
+
+        const int64_t n_per_row = sums->ne[0];
+        std::vector<float> & e = data[name];
+        e.resize(n_per_row * sums->ne[1]);
+
+        for (int64_t i = 0; i < sums->ne[1]; ++i) {
+            const float count = ((const float *) counts->data)[i];
+            for (int64_t j = 0; j < n_per_row; ++j) {
+                // a matrix that never saw an activation gets uniform weights
+                e[i*n_per_row + j] = count > 0.0f ? ((const float *) sums->data)[i*n_per_row + j] / count : 1.0f;
+            }
+        }
+    }
+
+    gguf_free(gguf);
+    ggml_free(ctx);
+
+    if (ok) {
+        LOGI("imatrix: loaded %zu weights from %s", data.size(), path);
+    }
+    return ok;
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "llama.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Importance matrix collection from normal use
+//
+// The low-bit quant types weigh the rounding error of every column of a weight
+// matrix by how large the activations multiplied with it are. A collector is
+// installed as the graph eval callback of a context (cb_eval / cb_eval_user_data)
+// and sees the input of every MUL_MAT and MUL_MAT_ID with a model weight; it adds
+// up the squared activations per column (per expert for MUL_MAT_ID) and counts the
+// rows. Each decoding thread accumulates into its own table, so contexts of the
+// same model can share one collector and decode concurrently without a shared lock;
+// the tables are merged when the matrix is saved.
+//
+// The file is written in the GGUF imatrix layout (<weight>.in_sum2 and
+// <weight>.counts tensors) that llama-quantize reads as well. imatrix_load turns it
+// into the map that llama_model_quantize_params::imatrix points to.
+//
+// Every node that is collected ends a part of the graph, so collection costs some
+// speed. Batches of fewer than min_tokens tokens are skipped without that cost; the
+// default of 2 keeps single-token generation steps at full speed.
+
+struct imatrix_params {
+    int32_t min_tokens     = 2;      // smallest batch that is collected
+    bool    process_output = false;  // collect output.weight as well
+};
+
+struct imatrix_collector;
+
+imatrix_collector * imatrix_init(const imatrix_params & params);
+void                imatrix_free(imatrix_collector * collector);
+
+// Graph eval callback, install it with cb_eval_user_data = the collector
+bool imatrix_eval_callback(struct ggml_tensor * t, bool ask, void * user_data);
+
+// Tokens that went through the dense weights so far
+int64_t imatrix_n_tokens(const imatrix_collector * collector);
+
+// Number of weights with data
+int32_t imatrix_n_entries(const imatrix_collector * collector);
+
+// Writes the GGUF imatrix, dataset is recorded in imatrix.datasets
+bool imatrix_save(const imatrix_collector * collector, const char * path, const char * dataset);
+
+// Reads a GGUF imatrix into mean squared activations per weight, ready for
+// llama_model_quantize_params::imatrix
+bool imatrix_load(const char * path, std::unordered_map<std::string, std::vector<float>> & data);
@@ -0,0 +1,492 @@
+#include "llama_lookahead.h"
+
+#include <android/log.h>
+#include <algorithm>
+#include <random>
+
+#define LOG_TAG "LlamaCpp"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+// n-grams observed in the lookahead window, up to G per first token
+// the first token is implied by the index in the container so it is not stored
+struct ngram_container {
+    ngram_container(int n_vocab, int N, int G) {
+        cnt.resize(n_vocab);
+        head.resize(n_vocab);
+        tokens.resize(n_vocab * G * (N - 1));
+    }
+
+    int n_total = 0;
+
+    std::vector<int> cnt;
+    std::vector<int> head;
+
+    // [n_vocab][G][N - 1]
+    std::vector<llama_token> tokens;
+};
+
+// n-gram under verification in the current batch
+struct ngram_data {
+    bool active = false;
+
+    llama_seq_id seq_id = -1;
+
+    std::vector<int>         i_batch;
+    std::vector<llama_token> tokens;
+};
+
+struct lookahead_session {
+    lookahead_session(llama_context * ctx, llama_sampler * smpl, const lookahead_params & params, int n_vocab)
+        : ctx(ctx), smpl(smpl), params(params), ngrams_observed(n_vocab, params.n_gram, params.n_guess) {}
+
+    llama_context * ctx;
+    llama_sampler * smpl;
+
+    lookahead_params  params;
+    speculative_stats stats;
+
+    llama_batch batch;
+
+    // lookahead branch, tokens_j[j][i] is level j of column i
+    std::vector<std::vector<llama_token>> tokens_j;
+    std::vector<llama_token>              tokens_j_prev;
+
+    ngram_container         ngrams_observed;
+    std::vector<ngram_data> ngrams_cur;
+
+    std::vector<llama_seq_id> seq_id_all;
+    std::vector<llama_seq_id> seq_id_look;
+
+    std::mt19937 rng{ 0 };
+};
+
+static void batch_add(llama_batch & batch, llama_token id, llama_pos pos, const std::vector<llama_seq_id> & seq_ids, bool logits) {
+    const int i = batch.n_tokens;
+
+    batch.token   [i] = id;
+    batch.pos     [i] = pos;
+    batch.n_seq_id[i] = (int32_t) seq_ids.size();
+    for (size_t s = 0; s < seq_ids.size(); ++s) {
+        batch.seq_id[i][s] = seq_ids[s];
+    }
+    batch.logits  [i] = logits;
+
+    batch.n_tokens++;
+}
+
+static llama_token argmax_ith(llama_context * ctx, int32_t i) {
+    const float * logits  = llama_get_logits_ith(ctx, i);
+    const int     n_vocab = llama_vocab_n_tokens(llama_model_get_vocab(llama_get_model(ctx)));
+
+    return (llama_token) (std::max_element(logits, logits + n_vocab) - logits);
+}
+
+// prompt goes to sequence 0 and is then shared by all the other sequences
+static bool decode_prompt(llama_context * ctx, llama_batch & batch, const std::vector<llama_token> & prompt, int n_seq) {
+    const int n_batch  = (int) llama_n_batch(ctx);
+    const int n_prompt = (int) prompt.size();
+
+    llama_memory_t mem = llama_get_memory(ctx);
+    llama_memory_clear(mem, true);
+
+    for (int i = 0; i < n_prompt; i += n_batch) {
+        const int n = std::min(n_batch, n_prompt - i);
+
+        batch.n_tokens = 0;
+        for (int j = 0; j < n; ++j) {
+            batch_add(batch, prompt[i + j], i + j, { 0 }, i + j == n_prompt - 1);
+        }
+
+        if (llama_decode(ctx, batch) != 0) {
+            return false;
+        }
+    }
+
+    for (int s = 1; s < n_seq; ++s) {
+        llama_memory_seq_cp(mem, 0, s, -1, -1);
+    }
+
+    return true;
+}
+
+uint32_t lookahead_n_seq(const lookahead_params & params) {
+    return params.n_window + params.n_guess + 1;
+}
+
+lookahead_session * lookahead_init(llama_context * ctx, llama_sampler * smpl, const lookahead_params & params) {
+    if (llama_model_is_recurrent(llama_get_model(ctx))) {
+        LOGE("Lookahead decoding needs multi-sequence KV cells, recurrent models are not supported");
+        return nullptr;
+    }
+
+    lookahead_params lparams = params;
+    lparams.n_window = std::max(2, params.n_window);
+    lparams.n_gram   = std::max(3, params.n_gram);
+    lparams.n_guess  = std::max(1, params.n_guess);
+
+    const int W = lparams.n_window;
+    const int N = lparams.n_gram;
+    const int G = lparams.n_guess;
+
+    if (llama_n_seq_max(ctx) < lookahead_n_seq(lparams)) {
+        LOGE("Lookahead decoding needs n_seq_max >= %u, the context has %u", lookahead_n_seq(lparams), llama_n_seq_max(ctx));
+        return nullptr;
+    }
+
+    // the largest step: current token + verification n-grams + lookahead window
+    const int n_batch_max = 1 + G*(N - 1) + W*(N - 1);
+    if ((int) llama_n_batch(ctx) < n_batch_max) {
+        LOGE("Lookahead decoding needs n_batch >= %d, the context has %u", n_batch_max, llama_n_batch(ctx));
+        return nullptr;
+    }
+
+    const int n_vocab = llama_vocab_n_tokens(llama_model_get_vocab(llama_get_model(ctx)));
+
+    auto * la = new lookahead_session(ctx, smpl, lparams, n_vocab);
+
+    la->batch = llama_batch_init(llama_n_batch(ctx), 0, W + G + 1);
+
+    la->tokens_j.assign(N - 1, std::vector<llama_token>(W));
+    la->tokens_j_prev.resize(W);
+
+    for (int s = 0; s < W + G + 1; ++s) {
+        la->seq_id_all.push_back(s);
+    }
+
+    return la;
+}
+
+void lookahead_free(lookahead_session * la) {
+    if (la == nullptr) {
+        return;
+    }
+
+    llama_batch_free(la->batch);
+
+    delete la;
+}
+
+const speculative_stats & lookahead_get_stats(const lookahead_session * la) {
+    return la->stats;
+}
+
+void lookahead_get_params(const lookahead_session * la, lookahead_params & params) {
+    params = la->params;
+}
+
+bool lookahead_generate(
+        lookahead_session              * la,
+        const std::vector<llama_token> & prompt,
+        int32_t                          max_tokens,
+        std::vector<llama_token>       & result) {
+    llama_context * ctx  = la->ctx;
+    llama_sampler * smpl = la->smpl;
+
+    const llama_vocab * vocab = llama_model_get_vocab(llama_get_model(ctx));
+
+    const int W = la->params.n_window;
+    const int N = la->params.n_gram;
+    const int G = la->params.n_guess;
+
+    const int n_ctx = (int) llama_n_ctx(ctx);
+
+    auto & stats = la->stats;
+    stats = {};
+
+    result.clear();
+
+    if (prompt.empty() || max_tokens <= 0 || (int) prompt.size() >= n_ctx) {
+        return false;
+    }
+
+    const int64_t t_start_us = llama_time_us();
+
+    llama_memory_t mem = llama_get_memory(ctx);
+
+    if (!decode_prompt(ctx, la->batch, prompt, W + G + 1)) {
+        LOGE("Failed to decode prompt");
+        return false;
+    }
+
+    auto & ngrams_observed = la->ngrams_observed;
+    std::fill(ngrams_observed.cnt.begin(),  ngrams_observed.cnt.end(),  0);
+    std::fill(ngrams_observed.head.begin(), ngrams_observed.head.end(), 0);
+    ngrams_observed.n_total = 0;
+
+    // the Jacobi iteration starts from random tokens of the prompt
+    for (int j = 0; j < N - 1; ++j) {
+        for (int i = 0; i < W; ++i) {
+            la->tokens_j[j][i] = prompt[la->rng() % prompt.size()];
+        }
+    }
+
+    int n_past = (int) prompt.size();
+
+    llama_token id = llama_sampler_sample(smpl, ctx, -1);
+    result.push_back(id);
+
+    auto & batch      = la->batch;
+    auto & tokens_j   = la->tokens_j;
+    auto & ngrams_cur = la->ngrams_cur;
+
+    bool ok   = true;
+    bool done = llama_vocab_is_eog(vocab, id) || (int) result.size() >= max_tokens;
+
+    while (!done) {
+        if (n_past + N + W >= n_ctx) {
+            LOGI("Lookahead decoding reached the end of the context");
+            break;
+        }
+
+        // batch layout, e.g. W = 5, N = 4, G = 2 (I = input, L = lookahead, V = verification):
+        //
+        // Info:   I  V  V  V  V  V  V  L  L  L  L  L  L  L  L  L  L  L  L  L  L
+        // Pos:    0  1  2  3  1  2  3  1  2  3  4  1  2  3  4  5  2  3  4  5  6   (+ n_past)
+        // Seq:    all      6        7  2-5 3-5 4-5 5  1  2  3  4  5  1  2  3  4  5
+        {
+            batch.n_tokens = 0;
+
+            // current token - first token of the first level
+            batch_add(batch, id, n_past, la->seq_id_all, true);
+
+            // verification n-grams - queued before the lookahead tokens for less KV cache fragmentation
+            const int g_cur = ngrams_observed.cnt[id];
+
+            ngrams_cur.resize(g_cur);
+            for (int g = 0; g < g_cur; ++g) {
+                ngrams_cur[g].active = true;
+                ngrams_cur[g].tokens.resize(N);
+                ngrams_cur[g].i_batch.resize(N);
+                ngrams_cur[g].seq_id     = W + 1 + g;
+                ngrams_cur[g].i_batch[0] = 0;
+                ngrams_cur[g].tokens [0] = id;
+            }
+
+            for (int j = 0; j < N - 1; ++j) {
+                for (int g = 0; g < g_cur; ++g) {
+                    const int idx = id*(N - 1)*G + g*(N - 1);
+
+                    const llama_token t = ngrams_observed.tokens[idx + j];
+
+                    ngrams_cur[g].tokens [j + 1] = t;
+                    ngrams_cur[g].i_batch[j + 1] = batch.n_tokens;
+
+                    batch_add(batch, t, n_past + j + 1, { W + 1 + g }, true);
+                }
+            }
+
+            stats.n_drafted += g_cur > 0 ? N - 1 : 0;
+
+            // the remaining W - 1 tokens of the first level
+            for (int i = 1; i < W; ++i) {
+                la->seq_id_look.resize(W - i);
+                for (int j = 0; j < W - i; ++j) {
+                    la->seq_id_look[j] = i + j + 1;
+                }
+
+                batch_add(batch, tokens_j[0][i], n_past + i, la->seq_id_look, false);
+            }
+
+            // the rest of the levels, only the last one needs logits
+            for (int j = 1; j < N - 1; ++j) {
+                for (int i = 0; i < W; ++i) {
+                    batch_add(batch, tokens_j[j][i], n_past + j + i, { i + 1 }, j == N - 2);
+                }
+            }
+        }
+
+        if (llama_decode(ctx, batch) != 0) {
+            LOGE("Failed to decode lookahead batch");
+            ok = false;
+            break;
+        }
+
+        stats.n_steps++;
+
+        int seq_id_best = 0;
+
+        for (int v = 0; v < N; ++v) {
+            int i_batch = 0;
+
+            // continue only while an n-gram agrees with every sampled token so far
+            if (v > 0) {
+                for (const auto & ngram : ngrams_cur) {
+                    if (ngram.active) {
+                        i_batch     = ngram.i_batch[v];
+                        seq_id_best = ngram.seq_id;
+
+                        stats.n_accepted++;
+                        break;
+                    }
+                }
+
+                if (i_batch == 0) {
+                    break;
+                }
+            }
+
+            id = llama_sampler_sample(smpl, ctx, i_batch);
+            result.push_back(id);
+
+            ++n_past;
+
+            if (llama_vocab_is_eog(vocab, id) || (int) result.size() >= max_tokens) {
+                done = true;
+                break;
+            }
+
+            for (auto & ngram : ngrams_cur) {
+                if (ngram.active && (v == N - 1 || id != ngram.tokens[v + 1])) {
+                    ngram.active = false;
+                }
+            }
+
+            // advance the Jacobi iteration by one level
+            {
+                for (int i = 0; i < W; ++i) {
+                    la->tokens_j_prev[i] = tokens_j[0][i];
+                }
+
+                for (int j = 0; j < N - 2; ++j) {
+                    tokens_j[j] = tokens_j[j + 1];
+                }
+
+                if (v == 0) {
+                    for (int i = 0; i < W; ++i) {
+                        tokens_j[N - 2][i] = argmax_ith(ctx, (int) ngrams_cur.size()*(N - 1) + W*(N - 2) + i);
+                    }
+                } else {
+                    for (int i = 0; i < W; ++i) {
+                        tokens_j[N - 2][i] = tokens_j[0][i];
+                    }
+                }
+            }
+
+            // every column of the window now yields an n-gram
+            if (v == 0) {
+                for (int f = 0; f < W; ++f) {
+                    const llama_token ft = la->tokens_j_prev[f];
+
+                    bool is_unique = true;
+                    for (int k = 0; k < ngrams_observed.cnt[ft] && is_unique; ++k) {
+                        const int idx = ft*(N - 1)*G + k*(N - 1);
+
+                        bool is_match = true;
+                        for (int j = 0; j < N - 1; ++j) {
+                            if (ngrams_observed.tokens[idx + j] != tokens_j[j][f]) {
+                                is_match = false;
+                                break;
+                            }
+                        }
+
+                        is_unique = !is_match;
+                    }
+
+                    if (!is_unique) {
+                        continue;
+                    }
+
+                    const int head = ngrams_observed.head[ft];
+                    const int idx  = ft*(N - 1)*G + head*(N - 1);
+
+                    for (int j = 0; j < N - 1; ++j) {
+                        ngrams_observed.tokens[idx + j] = tokens_j[j][f];
+                    }
+
+                    ngrams_observed.cnt [ft] = std::min(G, ngrams_observed.cnt[ft] + 1);
+                    ngrams_observed.head[ft] = (head + 1) % G;
+                    ngrams_observed.n_total++;
+                }
+            }
+        }
+
+        // drop everything after the accepted tokens; if an n-gram was verified
+        // its cells become the new history of all the sequences
+        llama_memory_seq_rm(mem, -1, n_past, -1);
+
+        if (seq_id_best != 0) {
+            llama_memory_seq_keep(mem, seq_id_best);
+            llama_memory_seq_cp  (mem, seq_id_best, 0, -1, -1);
+            llama_memory_seq_rm  (mem, seq_id_best, -1, -1);
+
+            for (int s = 1; s < W + G + 1; ++s) {
+                llama_memory_seq_cp(mem, 0, s, -1, -1);
+            }
+        }
+    }
+
+    stats.n_generated = (int) result.size();
+    stats.t_gen_us    = llama_time_us() - t_start_us;
+
+    LOGI("Lookahead decoding: %d tokens in %d steps (%.2f tokens/step), %d n-grams observed, %.2f tokens/s",
+         stats.n_generated, stats.n_steps, stats.n_steps > 0 ? (float) stats.n_generated / stats.n_steps : 0.0f,
+         ngrams_observed.n_total, stats.tokens_per_second());
+
+    return ok;
+}
+
+bool lookahead_benchmark(
+        llama_context                  * ctx,
+        const lookahead_params         & params,
+        const std::vector<llama_token> & prompt,
+        int32_t                          n_tokens,
+        speculative_stats              & stats_plain,
+        speculative_stats              & stats_lookahead,
+        bool                           & identical) {
+    llama_sampler * smpl = llama_sampler_init_greedy();
+
+    identical = false;
+
+    lookahead_session * la = lookahead_init(ctx, smpl, params);
+    if (!la) {
+        llama_sampler_free(smpl);
+        return false;
+    }
+
+    // plain decoding: one llama_decode per token
+    std::vector<llama_token> output_plain;
+    stats_plain = {};
+
+    const int64_t t_start_us = llama_time_us();
+
+    bool ok = decode_prompt(ctx, la->batch, prompt, 1);
+
+    for (int n_past = (int) prompt.size(); ok && (int) output_plain.size() < n_tokens; ++n_past) {
+        const llama_token id = llama_sampler_sample(smpl, ctx, -1);
+        output_plain.push_back(id);
+
+        if (llama_vocab_is_eog(llama_model_get_vocab(llama_get_model(ctx)), id) || (int) output_plain.size() >= n_tokens) {
+            break;
+        }
+
+        la->batch.n_tokens = 0;
+        batch_add(la->batch, id, n_past, { 0 }, true);
+
+        ok = llama_decode(ctx, la->batch) == 0;
+        stats_plain.n_steps++;
+    }
+
+    stats_plain.n_generated = (int) output_plain.size();
+    stats_plain.t_gen_us    = llama_time_us() - t_start_us;
+
+    std::vector<llama_token> output_lookahead;
+    ok = ok && lookahead_generate(la, prompt, n_tokens, output_lookahead);
+
+    stats_lookahead = la->stats;
+
+    // with greedy sampling both should produce the same text
+    identical = ok && output_plain == output_lookahead;
+    if (ok && !identical) {
+        LOGE("Lookahead output differs from plain decoding");
+    }
+
+    LOGI("Lookahead benchmark: plain %.2f tokens/s, lookahead %.2f tokens/s (%.2fx)",
+         stats_plain.tokens_per_second(), stats_lookahead.tokens_per_second(),
+         stats_plain.tokens_per_second() > 0.0f ? stats_lookahead.tokens_per_second() / stats_plain.tokens_per_second() : 0.0f);
+
+    lookahead_free(la);
+    llama_sampler_free(smpl);
+
+    return ok;
+}
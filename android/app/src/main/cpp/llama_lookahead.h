@@ -0,0 +1,56 @@
+#pragma once
+
+#include "llama.h"
+#include "llama_speculative.h"
+
+#include <vector>
+
+// Lookahead (Jacobi) decoding
+//
+// ref: https://lmsys.org/blog/2023-11-21-lookahead-decoding/
+//
+// Every step decodes, in a single batch, the current token together with
+//  - a 2D window of n_window x (n_gram - 1) Jacobi guesses, one KV sequence per column,
+//    whose fixed-point iterates produce candidate n-grams
+//  - up to n_guess previously observed n-grams that start with the current token,
+//    one KV sequence each, that are verified against the sampled tokens
+// The longest verified n-gram is kept and moved to sequence 0, the other cells are
+// dropped. No draft model is needed; the context must be created with
+// n_seq_max >= lookahead_n_seq(params).
+
+struct lookahead_params {
+    int32_t n_window = 5;  // W - parallel Jacobi columns
+    int32_t n_gram   = 4;  // N - length of the generated n-grams
+    int32_t n_guess  = 5;  // G - max n-grams verified per step
+};
+
+struct lookahead_session;
+
+uint32_t lookahead_n_seq(const lookahead_params & params);
+
+// smpl picks the emitted tokens, it is not owned by the session
+lookahead_session * lookahead_init(llama_context * ctx, llama_sampler * smpl, const lookahead_params & params);
+void                lookahead_free(lookahead_session * la);
+
+// Clears the KV cache, evaluates the prompt and generates up to max_tokens tokens,
+// stopping after an end-of-generation token. n_drafted/n_accepted in the stats count
+// the verified n-gram tokens.
+bool lookahead_generate(
+        lookahead_session              * la,
+        const std::vector<llama_token> & prompt,
+        int32_t                          max_tokens,
+        std::vector<llama_token>       & result);
+
+const speculative_stats & lookahead_get_stats(const lookahead_session * la);
+void                      lookahead_get_params(const lookahead_session * la, lookahead_params & params);
+
+// Greedy plain decoding vs greedy lookahead decoding of n_tokens on the same prompt.
+// identical tells whether both produced the same tokens; a mismatch is not a failure.
+bool lookahead_benchmark(
+        llama_context                  * ctx,
+        const lookahead_params         & params,
+        const std::vector<llama_token> & prompt,
+        int32_t                          n_tokens,
+        speculative_stats              & stats_plain,
+        speculative_stats              & stats_lookahead,
+        bool                           & identical);
@@ -0,0 +1,181 @@
+#include "llama_parallel.h"
+
+#include <android/log.h>
+#include <algorithm>
+
+#define LOG_TAG "LlamaCpp"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+struct parallel_slot {
+    llama_sampler * smpl = nullptr;
+
+    llama_pos   n_past  = 0;
+    int32_t     i_batch = -1;  // index of the logits of this slot in the current batch, -1 if none
+    llama_token next    = LLAMA_TOKEN_NULL;
+    bool        done    = false;
+};
+
+static void batch_add(llama_batch & batch, llama_token id, llama_pos pos, llama_seq_id seq_id, bool logits) {
+    const int i = batch.n_tokens;
+
+    batch.token   [i]    = id;
+    batch.pos     [i]    = pos;
+    batch.n_seq_id[i]    = 1;
+    batch.seq_id  [i][0] = seq_id;
+    batch.logits  [i]    = logits;
+
+    batch.n_tokens++;
+}
+
+// decode the batch and sample the next token of every slot that has logits in it
+static bool decode_and_sample(llama_context * ctx, llama_batch & batch, std::vector<parallel_slot> & slots) {
+    if (llama_decode(ctx, batch) != 0) {
+        return false;
+    }
+
+    for (auto & slot : slots) {
+        if (slot.i_batch < 0) {
+            continue;
+        }
+
+        slot.next = llama_sampler_sample(slot.smpl, ctx, slot.i_batch);
+        llama_sampler_accept(slot.smpl, slot.next);
+        slot.i_batch = -1;
+    }
+
+    batch.n_tokens = 0;
+
+    return true;
+}
+
+// decode the prompts of all the slots, n_batch tokens at a time
+static bool decode_prompts(
+        llama_context                       * ctx,
+        llama_batch                         & batch,
+        const std::vector<parallel_request> & requests,
+        std::vector<parallel_slot>          & slots) {
+    const int n_batch = (int) llama_n_batch(ctx);
+
+    batch.n_tokens = 0;
+    for (size_t s = 0; s < requests.size(); ++s) {
+        const auto & prompt = requests[s].prompt;
+
+        for (size_t i = 0; i < prompt.size(); ++i) {
+            const bool last = i + 1 == prompt.size();
+            if (last) {
+                slots[s].i_batch = batch.n_tokens;
+            }
+            batch_add(batch, prompt[i], (llama_pos) i, (llama_seq_id) s, last);
+
+            if (batch.n_tokens == n_batch && !decode_and_sample(ctx, batch, slots)) {
+                return false;
+            }
+        }
+        slots[s].n_past = (llama_pos) prompt.size();
+    }
+
+    if (batch.n_tokens > 0 && !decode_and_sample(ctx, batch, slots)) {
+        return false;
+    }
+
+    return true;
+}
+
+bool parallel_generate(
+        llama_context                       * ctx,
+        const llama_sampler                 * smpl,
+        const std::vector<parallel_request> & requests,
+        int32_t                               max_tokens,
+        std::vector<std::vector<llama_token>> & results,
+        speculative_stats                   & stats) {
+    const int32_t n_seq = (int32_t) requests.size();
+
+    results.assign(n_seq, {});
+    stats = {};
+
+    if (n_seq == 0) {
+        return true;
+    }
+    if ((uint32_t) n_seq > llama_n_seq_max(ctx)) {
+        LOGE("Parallel generation of %d requests needs n_seq_max >= %d, the context has %u",
+             n_seq, n_seq, llama_n_seq_max(ctx));
+        return false;
+    }
+    for (const auto & req : requests) {
+        if (req.prompt.empty()) {
+            LOGE("Parallel generation: empty prompt");
+            return false;
+        }
+    }
+
+    const llama_vocab * vocab = llama_model_get_vocab(llama_get_model(ctx));
+
+    const int64_t t_start_us = llama_time_us();
+
+    llama_memory_clear(llama_get_memory(ctx), true);
+    llama_clear_adapter_lora_seq(ctx, -1);
+
+    std::vector<parallel_slot> slots(n_seq);
+    for (int32_t s = 0; s < n_seq; ++s) {
+        slots[s].smpl = llama_sampler_clone(smpl);
+        llama_sampler_reset(slots[s].smpl);
+
+        if (requests[s].adapter) {
+            llama_set_adapter_lora_seq(ctx, requests[s].adapter, s, requests[s].adapter_scale);
+        }
+    }
+
+    // the prompts may be split in several batches, each step needs one token per slot
+    const int32_t n_batch_alloc = std::max<int32_t>(llama_n_batch(ctx), n_seq);
+    llama_batch batch = llama_batch_init(n_batch_alloc, 0, 1);
+
+    bool ok = decode_prompts(ctx, batch, requests, slots);
+    if (!ok) {
+        LOGE("Parallel generation: failed to decode the prompts");
+    }
+
+    for (int32_t i = 0; ok && i < max_tokens; ++i) {
+        for (int32_t s = 0; s < n_seq; ++s) {
+            auto & slot = slots[s];
+            if (slot.done) {
+                continue;
+            }
+
+            results[s].push_back(slot.next);
+            stats.n_generated++;
+
+            if (llama_vocab_is_eog(vocab, slot.next) || i + 1 == max_tokens) {
+                slot.done = true;
+                continue;
+            }
+
+            slot.i_batch = batch.n_tokens;
+            batch_add(batch, slot.next, slot.n_past++, s, true);
+        }
+
+        if (batch.n_tokens == 0) {
+            break;
+        }
+
+        stats.n_steps++;
+        if (!decode_and_sample(ctx, batch, slots)) {
+            LOGE("Parallel generation: failed to decode step %d", i);
+            ok = false;
+        }
+    }
+
+    llama_batch_free(batch);
+
+    for (auto & slot : slots) {
+        llama_sampler_free(slot.smpl);
+    }
+    llama_clear_adapter_lora_seq(ctx, -1);
+
+    stats.t_gen_us = llama_time_us() - t_start_us;
+
+    LOGI("Parallel generation: %d requests, %d tokens in %d steps, %.2f tokens/s",
+         n_seq, stats.n_generated, stats.n_steps, stats.tokens_per_second());
+
+    return ok;
+}
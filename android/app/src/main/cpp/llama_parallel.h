@@ -0,0 +1,34 @@
+#pragma once
+
+#include "llama.h"
+#include "llama_speculative.h"
+
+#include <vector>
+
+// Parallel generation for several prompts on one context
+//
+// Every request owns one KV sequence (request i uses seq_id i) and the
+// requests are decoded together: one batch for the prompts and then one batch
+// per step with the last token of every unfinished request. Each request can
+// select its own LoRA adapter, applied only to the tokens of its sequence
+// (llama_set_adapter_lora_seq), so several adapters share one copy of the base
+// model and one batch.
+
+struct parallel_request {
+    std::vector<llama_token> prompt;
+
+    llama_adapter_lora * adapter       = nullptr;  // nullptr: base model only
+    float                adapter_scale = 1.0f;
+};
+
+// Clears the KV cache and generates up to max_tokens tokens for every request,
+// each stopping after an end-of-generation token. smpl is cloned for every
+// request. The context needs n_seq_max >= requests.size(). The per-sequence
+// adapters are removed again before returning.
+bool parallel_generate(
+        llama_context                       * ctx,
+        const llama_sampler                 * smpl,
+        const std::vector<parallel_request> & requests,
+        int32_t                               max_tokens,
+        std::vector<std::vector<llama_token>> & results,
+        speculative_stats                   & stats);
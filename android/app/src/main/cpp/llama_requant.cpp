@@ -0,0 +1,573 @@
+#include "llama_requant.h"
+#include "llama_imatrix.h"
+
+#include "ggml-alloc.h"
+#include "ggml-backend.h"
+#include "ggml-cpu.h"
+#include "gguf.h"
+
+#include <android/log.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <fcntl.h>
+#include <unistd.h>
+
+#define LOG_TAG "LlamaCpp"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+// shape of the benchmarked weight, about the size of an FFN matrix of a 1-3B model
+#define REQUANT_BENCH_N_PER_ROW 4096
+#define REQUANT_BENCH_N_ROWS    2048
+
+struct requant_job {
+    std::string    path_in;
+    std::string    path_out;
+    requant_params params;
+
+    std::thread thread;
+
+    std::atomic<int>   state    { REQUANT_STATE_BENCHMARKING };
+    std::atomic<float> progress { 0.0f };
+    std::atomic<bool>  cancel   { false };
+
+    // written by the job thread, read by requant_status_json
+    mutable std::mutex             mutex;
+    std::string                    features;
+    std::vector<requant_candidate> candidates;
+    int32_t                        i_pick     = -1;
+    bool                           unchanged  = false;
+    int64_t                        t_bench_us = 0;
+    int64_t                        t_quant_us = 0;
+};
+
+std::string requant_cpu_features() {
+    static const struct {
+        int (*has)(void);
+        const char * name;
+    } features[] = {
+        { ggml_cpu_has_neon,        "NEON"     },
+        { ggml_cpu_has_arm_fma,     "ARM_FMA"  },
+        { ggml_cpu_has_fp16_va,     "FP16_VA"  },
+        { ggml_cpu_has_dotprod,     "DOTPROD"  },
+        { ggml_cpu_has_matmul_int8, "I8MM"     },
+        { ggml_cpu_has_sve,         "SVE"      },
+        { ggml_cpu_has_sme,         "SME"      },
+        { ggml_cpu_has_avx,         "AVX"      },
+        { ggml_cpu_has_avx2,        "AVX2"     },
+        { ggml_cpu_has_avx_vnni,    "AVX_VNNI" },
+        { ggml_cpu_has_avx512,      "AVX512"   },
+        { ggml_cpu_has_f16c,        "F16C"     },
+        { ggml_cpu_has_fma,         "FMA"      },
+    };
+
+    std::string result;
+    for (const auto & f : features) {
+        if (f.has()) {
+            if (!result.empty()) {
+                result += ' ';
+            }
+            result += f.name;
+        }
+    }
+    return result;
+}
+
+std::vector<requant_candidate> requant_default_candidates() {
+    return {
+        { LLAMA_FTYPE_MOSTLY_Q4_K_M, GGML_TYPE_Q4_K,   "Q4_K_M" },
+        { LLAMA_FTYPE_MOSTLY_IQ4_NL, GGML_TYPE_IQ4_NL, "IQ4_NL" },
+        { LLAMA_FTYPE_MOSTLY_Q4_0,   GGML_TYPE_Q4_0,   "Q4_0"   },
+    };
+}
+
+// the first extra buffer type of the CPU device (repacking) that can run op with its
+// weight, else the plain CPU buffer type
+static ggml_backend_buffer_type_t select_weight_buft(ggml_backend_dev_t dev, ggml_tensor * weight, ggml_tensor * op) {
+    auto * reg = ggml_backend_dev_backend_reg(dev);
+    auto get_extra_bufts = (ggml_backend_dev_get_extra_bufts_t)
+        ggml_backend_reg_get_proc_address(reg, "ggml_backend_dev_get_extra_bufts");
+
+    if (get_extra_bufts) {
+        for (ggml_backend_buffer_type_t * buft = get_extra_bufts(dev); buft && *buft; ++buft) {
+            ggml_backend_buffer_t dummy = ggml_backend_buft_alloc_buffer(*buft, 0);
+            if (!dummy) {
+                continue;
+            }
+            weight->buffer = dummy;
+            const bool supported = ggml_backend_dev_supports_op(dev, op);
+            weight->buffer = nullptr;
+            ggml_backend_buffer_free(dummy);
+
+            if (supported) {
+                return *buft;
+            }
+        }
+    }
+
+    return ggml_backend_dev_buffer_type(dev);
+}
+
+// average time of a single-token matrix-vector product with a weight of the given type
+static double bench_mul_mat(ggml_backend_dev_t dev, ggml_backend_t backend, enum ggml_type type, int32_t n_iter, bool & repacked) {
+    const int64_t n_per_row = REQUANT_BENCH_N_PER_ROW;
+    const int64_t n_rows    = REQUANT_BENCH_N_ROWS;
+
+    ggml_init_params ip = {
+        /*.mem_size   =*/ 8 * ggml_tensor_overhead() + ggml_graph_overhead(),
+        /*.mem_buffer =*/ nullptr,
+        /*.no_alloc   =*/ true,
+    };
+    ggml_context * ctx_w = ggml_init(ip);
+    ggml_context * ctx_x = ggml_init(ip);
+
+    ggml_tensor * w   = ggml_new_tensor_2d(ctx_w, type, n_per_row, n_rows);
+    ggml_tensor * x   = ggml_new_tensor_2d(ctx_x, GGML_TYPE_F32, n_per_row, 1);
+    ggml_tensor * out = ggml_mul_mat(ctx_x, w, x);
+
+    ggml_cgraph * gf = ggml_new_graph(ctx_x);
+    ggml_build_forward_expand(gf, out);
+
+    ggml_backend_buffer_type_t buft = select_weight_buft(dev, w, out);
+    repacked = buft != ggml_backend_dev_buffer_type(dev);
+
+    ggml_backend_buffer_t buf_w = ggml_backend_alloc_ctx_tensors_from_buft(ctx_w, buft);
+    ggml_backend_buffer_t buf_x = ggml_backend_alloc_ctx_tensors(ctx_x, backend);
+
+    double t_us = 0.0;
+
+    if (buf_w && buf_x) {
+        std::mt19937 rng(42);
+        std::normal_distribution<float> nd(0.0f, 0.02f);
+
+        // only the memory traffic matters: quantize a few rows and repeat them, the
+        // quantization of the whole weight would take longer than the benchmark
+        const int64_t n_rows_chunk = 64;
+        const size_t  chunk_size   = ggml_row_size(type, n_per_row) * n_rows_chunk;
+
+        std::vector<float>   src(n_rows_chunk * n_per_row);
+        std::vector<uint8_t> data(chunk_size * (n_rows / n_rows_chunk));
+
+        for (float & v : src) {
+            v = nd(rng);
+        }
+        ggml_quantize_chunk(type, src.data(), data.data(), 0, n_rows_chunk, n_per_row, nullptr);
+        for (size_t offs = chunk_size; offs < data.size(); offs += chunk_size) {
+            memcpy(data.data() + offs, data.data(), chunk_size);
+        }
+        ggml_backend_tensor_set(w, data.data(), 0, data.size());
+
+        std::vector<float> xs(n_per_row);
+        for (float & v : xs) {
+            v = nd(rng);
+        }
+        ggml_backend_tensor_set(x, xs.data(), 0, xs.size() * sizeof(float));
+
+        // warm-up
+        ggml_backend_graph_compute(backend, gf);
+
+        const int64_t t_start_us = ggml_time_us();
+        for (int32_t i = 0; i < n_iter; ++i) {
+            ggml_backend_graph_compute(backend, gf);
+        }
+        t_us = (double) (ggml_time_us() - t_start_us) / std::max(n_iter, 1);
+    } else {
+        LOGE("Failed to allocate the %s benchmark tensors", ggml_type_name(type));
+    }
+
+    ggml_backend_buffer_free(buf_w);
+    ggml_backend_buffer_free(buf_x);
+    ggml_free(ctx_w);
+    ggml_free(ctx_x);
+
+    return t_us;
+}
+
+int32_t requant_pick(const requant_params & params, std::vector<requant_candidate> & candidates) {
+    ggml_backend_dev_t dev = ggml_backend_dev_by_type(GGML_BACKEND_DEVICE_TYPE_CPU);
+    if (!dev || candidates.empty()) {
+        return -1;
+    }
+
+    ggml_backend_t backend = ggml_backend_dev_init(dev, nullptr);
+    if (!backend) {
+        return -1;
+    }
+
+    const int n_threads = params.n_threads > 0 ? params.n_threads : (int) std::thread::hardware_concurrency();
+    ggml_backend_cpu_set_n_threads(backend, n_threads);
+
+    double t_min = 0.0;
+    for (auto & c : candidates) {
+        c.t_us = bench_mul_mat(dev, backend, c.type, params.n_bench_iter, c.repacked);
+        if (c.t_us > 0.0 && (t_min == 0.0 || c.t_us < t_min)) {
+            t_min = c.t_us;
+        }
+        LOGI("Requantization benchmark: %-6s %8.1f us%s", c.name, c.t_us, c.repacked ? " (repacked)" : "");
+    }
+
+    ggml_backend_free(backend);
+
+    for (size_t i = 0; i < candidates.size(); ++i) {
+        const double t_us = candidates[i].t_us;
+        if (t_us > 0.0 && t_us <= t_min * (1.0 + params.speed_tolerance)) {
+            return (int32_t) i;
+        }
+    }
+
+    return -1;
+}
+
+static int64_t gguf_file_type(const char * path) {
+    gguf_init_params gp = {
+        /*.no_alloc =*/ true,
+        /*.ctx      =*/ nullptr,
+    };
+    gguf_context * ctx = gguf_init_from_file(path, gp);
+    if (!ctx) {
+        return -1;
+    }
+
+    const int64_t key = gguf_find_key(ctx, "general.file_type");
+    const int64_t ftype = key >= 0 ? (int64_t) gguf_get_val_u32(ctx, key) : -1;
+
+    gguf_free(ctx);
+    return ftype;
+}
+
+static bool quantize_progress(float progress, void * user_data) {
+    auto * job = (requant_job *) user_data;
+    job->progress = progress;
+    return !job->cancel;
+}
+
+static requant_state requant_run(requant_job * job) {
+    const int64_t t_bench_start_us = ggml_time_us();
+
+    std::vector<requant_candidate> candidates = requant_default_candidates();
+    const int32_t i_pick = requant_pick(job->params, candidates);
+
+    {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->candidates = candidates;
+        job->i_pick     = i_pick;
+        job->t_bench_us = ggml_time_us() - t_bench_start_us;
+    }
+
+    if (i_pick < 0) {
+        LOGE("Requantization: no usable quant type");
+        return REQUANT_STATE_FAILED;
+    }
+    if (job->cancel) {
+        return REQUANT_STATE_CANCELLED;
+    }
+
+    const requant_candidate & pick = candidates[i_pick];
+
+    const int64_t ftype_in = gguf_file_type(job->path_in.c_str());
+    if (ftype_in < 0) {
+        LOGE("Requantization: failed to read %s", job->path_in.c_str());
+        return REQUANT_STATE_FAILED;
+    }
+    if (ftype_in == pick.ftype && job->path_in == job->path_out) {
+        LOGI("Requantization: model is already %s", pick.name);
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->unchanged = true;
+        job->progress  = 1.0f;
+        return REQUANT_STATE_DONE;
+    }
+
+    job->state = REQUANT_STATE_QUANTIZING;
+    LOGI("Requantization: converting %s to %s", job->path_in.c_str(), pick.name);
+
+    auto qparams = llama_model_quantize_default_params();
+    qparams.nthread                     = job->params.n_threads;
+    qparams.ftype                       = pick.ftype;
+    qparams.allow_requantize            = true;
+    qparams.progress_callback           = quantize_progress;
+    qparams.progress_callback_user_data = job;
+
+    std::unordered_map<std::string, std::vector<float>> imatrix;
+    if (!job->params.imatrix_path.empty()) {
+        if (!imatrix_load(job->params.imatrix_path.c_str(), imatrix)) {
+            return REQUANT_STATE_FAILED;
+        }
+        qparams.imatrix = &imatrix;
+    }
+
+    const std::string path_tmp = job->path_out + ".tmp";
+
+    const int64_t t_quant_start_us = ggml_time_us();
+    const uint32_t rc = llama_model_quantize(job->path_in.c_str(), path_tmp.c_str(), &qparams);
+    {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        job->t_quant_us = ggml_time_us() - t_quant_start_us;
+    }
+
+    if (rc != 0) {
+        remove(path_tmp.c_str());
+        return job->cancel ? REQUANT_STATE_CANCELLED : REQUANT_STATE_FAILED;
+    }
+
+    // the data must be on disk before the rename makes it visible
+    const int fd = open(path_tmp.c_str(), O_RDONLY);
+    if (fd < 0 || fsync(fd) != 0) {
+        LOGE("Requantization: failed to sync %s", path_tmp.c_str());
+        if (fd >= 0) {
+            close(fd);
+        }
+        remove(path_tmp.c_str());
+        return REQUANT_STATE_FAILED;
+    }
+    close(fd);
+
+    if (rename(path_tmp.c_str(), job->path_out.c_str()) != 0) {
+        LOGE("Requantization: failed to move %s to %s", path_tmp.c_str(), job->path_out.c_str());
+        remove(path_tmp.c_str());
+        return REQUANT_STATE_FAILED;
+    }
+
+    job->progress = 1.0f;
+    LOGI("Requantization: %s written as %s", job->path_out.c_str(), pick.name);
+    return REQUANT_STATE_DONE;
+}
+
+requant_job * requant_start(const char * path_in, const char * path_out, const requant_params & params) {
+    requant_job * job = new requant_job;
+
+    job->path_in  = path_in;
+    job->path_out = path_out;
+    job->params   = params;
+    job->features = requant_cpu_features();
+
+    LOGI("Requantization: CPU features: %s", job->features.c_str());
+
+    job->thread = std::thread([job]() {
+        job->state = requant_run(job);
+    });
+
+    return job;
+}
+
+void requant_free(requant_job * job) {
+    if (!job) {
+        return;
+    }
+
+    job->cancel = true;
+    if (job->thread.joinable()) {
+        job->thread.join();
+    }
+    delete job;
+}
+
+void requant_cancel(requant_job * job) {
+    job->cancel = true;
+}
+
+requant_state requant_get_state(const requant_job * job) {
+    return (requant_state) job->state.load();
+}
+
+float requant_get_progress(const requant_job * job) {
+    return job->progress;
+}
+
+std::string requant_status_json(const requant_job * job) {
+    static const char * state_names[] = { "benchmarking", "quantizing", "done", "failed", "cancelled" };
+
+    std::lock_guard<std::mutex> lock(job->mutex);
+
+    char buf[256];
+    snprintf(buf, sizeof(buf),
+             "{\"state\":\"%s\",\"progress\":%.3f,\"features\":\"%s\",\"type\":\"%s\",\"unchanged\":%s,"
+             "\"bench_ms\":%.1f,\"quant_ms\":%.1f,\"candidates\":[",
+             state_names[job->state.load()], job->progress.load(), job->features.c_str(),
+             job->i_pick >= 0 ? job->candidates[job->i_pick].name : "",
+             job->unchanged ? "true" : "false", job->t_bench_us / 1000.0, job->t_quant_us / 1000.0);
+
+    std::string result = buf;
+    for (size_t i = 0; i < job->candidates.size(); ++i) {
+        const requant_candidate & c = job->candidates[i];
+        snprintf(buf, sizeof(buf), "%s{\"type\":\"%s\",\"us\":%.1f,\"repacked\":%s}",
+                 i > 0 ? "," : "", c.name, c.t_us, c.repacked ? "true" : "false");
+        result += buf;
+    }
+    result += "]}";
+
+    return result;
+}
+
+// writes a Llama-shaped F16 model with about n_params weights, the tensor data is one
+// random block repeated so that writing is bound by the disk
+static int64_t write_synthetic_model(const char * path, int64_t n_params) {
+    const int64_t n_embd    = 2048;
+    const int64_t n_ff      = 8192;
+    const int64_t n_head    = 32;
+    const int64_t n_head_kv = 8;
+    const int64_t n_vocab   = 32000;
+    const int64_t n_embd_kv = n_embd / n_head * n_head_kv;
+
+    const int64_t n_per_layer = 2 * n_embd * n_embd + 2 * n_embd * n_embd_kv + 3 * n_embd * n_ff;
+    const int64_t n_layer     = std::max<int64_t>(1, (n_params - 2 * n_vocab * n_embd + n_per_layer / 2) / n_per_layer);
+
+    gguf_context * gctx = gguf_init_empty();
+    gguf_set_val_str(gctx, "general.architecture", "llama");
+    gguf_set_val_u32(gctx, "general.file_type", LLAMA_FTYPE_MOSTLY_F16);
+    gguf_set_val_u32(gctx, "llama.vocab_size", n_vocab);
+    gguf_set_val_u32(gctx, "llama.context_length", 2048);
+    gguf_set_val_u32(gctx, "llama.embedding_length", n_embd);
+    gguf_set_val_u32(gctx, "llama.block_count", n_layer);
+    gguf_set_val_u32(gctx, "llama.feed_forward_length", n_ff);
+    gguf_set_val_u32(gctx, "llama.attention.head_count", n_head);
+    gguf_set_val_u32(gctx, "llama.attention.head_count_kv", n_head_kv);
+    gguf_set_val_u32(gctx, "llama.rope.dimension_count", n_embd / n_head);
+    gguf_set_val_f32(gctx, "llama.attention.layer_norm_rms_epsilon", 1e-5f);
+
+    ggml_init_params ip = {
+        /*.mem_size   =*/ (size_t) (4 + 9 * n_layer) * ggml_tensor_overhead(),
+        /*.mem_buffer =*/ nullptr,
+        /*.no_alloc   =*/ true,
+    };
+    ggml_context * ctx = ggml_init(ip);
+
+    int64_t n_params_model = 0;
+    auto add = [&](const std::string & name, enum ggml_type type, int64_t ne0, int64_t ne1) {
+        ggml_tensor * t = ne1 > 0 ? ggml_new_tensor_2d(ctx, type, ne0, ne1) : ggml_new_tensor_1d(ctx, type, ne0);
+        ggml_set_name(t, name.c_str());
+        gguf_add_tensor(gctx, t);
+        n_params_model += ggml_nelements(t);
+    };
+
+    add("token_embd.weight",  GGML_TYPE_F16, n_embd, n_vocab);
+    add("output_norm.weight", GGML_TYPE_F32, n_embd, 0);
+    add("output.weight",      GGML_TYPE_F16, n_embd, n_vocab);
+    for (int64_t il = 0; il < n_layer; ++il) {
+        const std::string p = "blk." + std::to_string(il) + ".";
+        add(p + "attn_norm.weight",   GGML_TYPE_F32, n_embd, 0);
+        add(p + "attn_q.weight",      GGML_TYPE_F16, n_embd, n_embd);
+        add(p + "attn_k.weight",      GGML_TYPE_F16, n_embd, n_embd_kv);
+        add(p + "attn_v.weight",      GGML_TYPE_F16, n_embd, n_embd_kv);
+        add(p + "attn_output.weight", GGML_TYPE_F16, n_embd, n_embd);
+        add(p + "ffn_norm.weight",    GGML_TYPE_F32, n_embd, 0);
+        add(p + "ffn_gate.weight",    GGML_TYPE_F16, n_embd, n_ff);
+        add(p + "ffn_up.weight",      GGML_TYPE_F16, n_embd, n_ff);
+        add(p + "ffn_down.weight",    GGML_TYPE_F16, n_ff,   n_embd);
+    }
+
+    FILE * f = fopen(path, "wb");
+    bool ok = f != nullptr;
+
+    if (ok) {
+        std::vector<uint8_t> meta(gguf_get_meta_size(gctx));
+        gguf_get_meta_data(gctx, meta.data());
+        ok = fwrite(meta.data(), 1, meta.size(), f) == meta.size();
+    }
+
+    std::mt19937 rng(42);
+    std::normal_distribution<float> nd(0.0f, 0.02f);
+
+    std::vector<float> block_f32(1 << 20);
+    for (float & v : block_f32) {
+        v = nd(rng);
+    }
+    std::vector<ggml_fp16_t> block(block_f32.size());
+    ggml_fp32_to_fp16_row(block_f32.data(), block.data(), (int64_t) block.size());
+
+    const size_t align = gguf_get_alignment(gctx);
+    const std::vector<uint8_t> zeros(align, 0);
+
+    for (int64_t i = 0; ok && i < gguf_get_n_tensors(gctx); ++i) {
+        const ggml_tensor * t = ggml_get_tensor(ctx, gguf_get_tensor_name(gctx, i));
+        const size_t nbytes = ggml_nbytes(t);
+
+        if (t->type == GGML_TYPE_F32) {
+            std::vector<float> ones(ggml_nelements(t), 1.0f);
+            ok = fwrite(ones.data(), 1, nbytes, f) == nbytes;
+        } else {
+            for (size_t offs = 0; ok && offs < nbytes; offs += block.size() * sizeof(ggml_fp16_t)) {
+                const size_t n = std::min(nbytes - offs, block.size() * sizeof(ggml_fp16_t));
+                ok = fwrite(block.data(), 1, n, f) == n;
+            }
+        }
+
+        const size_t pad = GGML_PAD(nbytes, align) - nbytes;
+        ok = ok && fwrite(zeros.data(), 1, pad, f) == pad;
+    }
+
+    if (f && fclose(f) != 0) {
+        ok = false;
+    }
+
+    ggml_free(ctx);
+    gguf_free(gctx);
+
+    if (!ok) {
+        LOGE("Failed to write the synthetic model to %s", path);
+        remove(path);
+        return 0;
+    }
+
+    return n_params_model;
+}
+
+bool requant_benchmark_threads(
+        const char                       * dir,
+        int64_t                            n_params,
+        llama_ftype                        ftype,
+        bool                               pin_threads,
+        int64_t                          & n_params_model,
+        std::vector<requant_bench_point> & results) {
+    results.clear();
+
+    const std::string path = std::string(dir) + "/quant-bench-f16.gguf";
+
+    n_params_model = write_synthetic_model(path.c_str(), n_params);
+    if (n_params_model == 0) {
+        return false;
+    }
+
+    std::vector<int32_t> thread_counts;
+    const int32_t n_cores = (int32_t) std::max(1u, std::thread::hardware_concurrency());
+    for (int32_t n = 1; n < n_cores; n *= 2) {
+        thread_counts.push_back(n);
+    }
+    thread_counts.push_back(n_cores);
+
+    bool ok = true;
+    for (const int32_t n_threads : thread_counts) {
+        auto qparams = llama_model_quantize_default_params();
+        qparams.nthread     = n_threads;
+        qparams.ftype       = ftype;
+        qparams.pin_threads = pin_threads;
+
+        const int64_t t_start_us = ggml_time_us();
+        if (llama_model_quantize(path.c_str(), "/dev/null", &qparams) != 0) {
+            LOGE("Quantization benchmark failed with %d threads", n_threads);
+            ok = false;
+            break;
+        }
+
+        requant_bench_point point;
+        point.n_threads    = n_threads;
+        point.t_ms         = (ggml_time_us() - t_start_us) / 1000.0;
+        if (point.t_ms <= 0.0) {
+            LOGE("Quantization benchmark: no time measured with %d threads", n_threads);
+            ok = false;
+            break;
+        }
+        point.params_per_s = n_params_model / (point.t_ms / 1000.0);
+        results.push_back(point);
+
+        LOGI("Quantization benchmark: %2d threads, %8.1f ms, %.1f M params/s, speedup %.2fx",
+             n_threads, point.t_ms, point.params_per_s / 1e6, results[0].t_ms / point.t_ms);
+    }
+
+    remove(path.c_str());
+    return ok;
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "llama.h"
+
+#include <string>
+#include <vector>
+
+// On-device requantization
+//
+// The app ships one GGUF; the quant type that decodes fastest differs between
+// devices (Q4_0 is repacked into the i8mm / AVX2 matmul layouts, the K-quants are
+// not). A requantization job runs in the background:
+//  1. times a weight-sized matrix-vector product of every candidate type with the
+//     CPU backend, including its repacking buffer types when they apply
+//  2. picks the candidate to use: the highest-quality one whose time is within
+//     speed_tolerance of the fastest
+//  3. converts the model with llama_model_quantize into path_out + ".tmp",
+//     weighted by the importance matrix when one was collected, reporting
+//     progress and stopping between tensors when cancelled
+//  4. renames the result over path_out, so readers see either the old or the
+//     new file. A model that is currently loaded from path_out keeps its mapping.
+//
+// The shipped model should be Q8_0 or F16, requantizing an already 4-bit model
+// compounds the quantization error.
+
+struct requant_params {
+    int32_t n_threads       = 0;      // 0 = hardware concurrency
+    float   speed_tolerance = 0.10f;  // a better candidate may be this much slower than the fastest
+    int32_t n_bench_iter    = 20;     // timed products per candidate
+
+    std::string imatrix_path;         // GGUF imatrix to quantize with (see llama_imatrix.h), empty = none
+};
+
+struct requant_candidate {
+    llama_ftype    ftype;
+    enum ggml_type type;        // type of most of the weights
+    const char   * name;
+    double         t_us  = 0.0; // time of one product, 0 = not measured
+    bool           repacked = false;
+};
+
+enum requant_state {
+    REQUANT_STATE_BENCHMARKING,
+    REQUANT_STATE_QUANTIZING,
+    REQUANT_STATE_DONE,
+    REQUANT_STATE_FAILED,
+    REQUANT_STATE_CANCELLED,
+};
+
+// CPU features used by the quantized kernels, e.g. "NEON DOTPROD I8MM"
+std::string requant_cpu_features();
+
+// Benchmarks the candidates (best quality first) and returns the index of the one to use
+int32_t requant_pick(const requant_params & params, std::vector<requant_candidate> & candidates);
+
+// Default candidates, best quality first: Q4_K_M, IQ4_NL, Q4_0
+std::vector<requant_candidate> requant_default_candidates();
+
+struct requant_job;
+
+// Starts the job on a background thread
+requant_job * requant_start(const char * path_in, const char * path_out, const requant_params & params);
+
+// Cancels the job if it is still running and waits for its thread
+void requant_free(requant_job * job);
+
+void requant_cancel(requant_job * job);
+
+requant_state requant_get_state   (const requant_job * job);
+float         requant_get_progress(const requant_job * job);
+
+// State, progress, CPU features, benchmark and chosen type as a JSON object
+std::string requant_status_json(const requant_job * job);
+
+struct requant_bench_point {
+    int32_t n_threads    = 0;
+    double  t_ms         = 0.0;
+    double  params_per_s = 0.0;
+};
+
+// Quantization throughput by thread count. A synthetic model of about n_params
+// weights (Llama 1B shapes, F16) is written to dir, quantized to ftype with 1, 2,
+// 4, ... threads up to the core count (the output goes to /dev/null) and removed.
+bool requant_benchmark_threads(
+        const char                       * dir,
+        int64_t                            n_params,
+        llama_ftype                        ftype,
+        bool                               pin_threads,
+        int64_t                          & n_params_model,
+        std::vector<requant_bench_point> & results);
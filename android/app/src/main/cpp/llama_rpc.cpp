@@ -0,0 +1,401 @@
+#include "llama_rpc.h"
+
+#include "ggml-cpu.h"
+#include "ggml-rpc.h"
+
+#include <android/log.h>
+#include <arpa/inet.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+#define LOG_TAG "LlamaCpp"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+llama_model * rpc_load_model(const char * path, const rpc_split_params & params) {
+    if (params.endpoints.empty() || params.endpoints.size() > GGML_RPC_MAX_SERVERS) {
+        LOGE("RPC split needs 1 to %d endpoints, got %zu", GGML_RPC_MAX_SERVERS, params.endpoints.size());
+        return nullptr;
+    }
+    if (!params.split.empty() && params.split.size() != params.endpoints.size()) {
+        LOGE("RPC split has %zu shares for %zu endpoints", params.split.size(), params.endpoints.size());
+        return nullptr;
+    }
+    if (params.endpoints.size() > llama_max_devices()) {
+        LOGE("RPC split supports at most %zu devices", llama_max_devices());
+        return nullptr;
+    }
+
+    // NULL-terminated, in endpoint order
+    std::vector<ggml_backend_dev_t> devices;
+    for (const auto & endpoint : params.endpoints) {
+        size_t free  = 0;
+        size_t total = 0;
+        ggml_backend_rpc_get_device_memory(endpoint.c_str(), &free, &total);
+        if (total == 0) {
+            LOGE("RPC server %s is not reachable", endpoint.c_str());
+            return nullptr;
+        }
+        LOGI("RPC server %s: %zu MB free of %zu MB", endpoint.c_str(), free / (1024 * 1024), total / (1024 * 1024));
+
+        devices.push_back(ggml_backend_rpc_add_device(endpoint.c_str()));
+    }
+    devices.push_back(nullptr);
+
+    std::vector<float> tensor_split(llama_max_devices(), 0.0f);
+    std::copy(params.split.begin(), params.split.end(), tensor_split.begin());
+
+    ggml_backend_rpc_set_pipelining(params.pipelined);
+    ggml_backend_rpc_set_wire_type(params.wire_type);
+
+    auto mparams = llama_model_default_params();
+    mparams.devices      = devices.data();
+    mparams.n_gpu_layers = params.n_remote_layers < 0 ? INT32_MAX : params.n_remote_layers;
+    mparams.split_mode   = LLAMA_SPLIT_MODE_LAYER;
+    mparams.tensor_split = params.split.empty() ? nullptr : tensor_split.data();
+    mparams.use_mmap     = true;
+    mparams.use_mlock    = false;
+
+    llama_model * model = llama_model_load_from_file(path, mparams);
+    if (!model) {
+        LOGE("Failed to load %s with RPC split", path);
+        return nullptr;
+    }
+
+    LOGI("Loaded %s with %d of %d layers on %zu RPC server(s)", path,
+         std::min(mparams.n_gpu_layers, llama_model_n_layer(model) + 1), llama_model_n_layer(model) + 1,
+         params.endpoints.size());
+
+    return model;
+}
+
+bool rpc_serve(const char * endpoint, const char * cache_dir, int32_t n_threads, size_t mem) {
+    ggml_backend_t backend = ggml_backend_cpu_init();
+    if (!backend) {
+        LOGE("Failed to initialize the CPU backend for the RPC server");
+        return false;
+    }
+    ggml_backend_cpu_set_n_threads(backend, n_threads);
+
+    // the server writes cached tensors there but does not create it
+    if (cache_dir) {
+        mkdir(cache_dir, 0755);
+    }
+
+    if (mem == 0) {
+        mem = (size_t) sysconf(_SC_PHYS_PAGES) * (size_t) sysconf(_SC_PAGE_SIZE);
+    }
+
+    LOGI("Serving RPC on %s (cache: %s, %zu MB)", endpoint, cache_dir ? cache_dir : "none", mem / (1024 * 1024));
+
+    // only returns when the server socket cannot be created or accept fails
+    ggml_backend_rpc_start_server(backend, endpoint, cache_dir, mem, mem);
+
+    ggml_backend_free(backend);
+
+    LOGE("RPC server on %s stopped", endpoint);
+
+    return false;
+}
+
+// Loopback TCP proxy to one RPC server that delays every chunk by latency_us in both directions
+struct rpc_latency_proxy {
+    std::string target;
+    std::string endpoint;  // where the proxy listens
+
+    int listen_fd = -1;
+
+    std::atomic<int64_t> latency_us { 0 };
+
+    std::mutex               mutex;
+    std::vector<int>         fds;
+    std::vector<std::thread> threads;
+    std::thread              acceptor;
+};
+
+// src -> dst with the delay, reader and writer threads share a queue of timestamped chunks
+static void proxy_pump(rpc_latency_proxy * proxy, int src, int dst) {
+    struct chunk {
+        std::chrono::steady_clock::time_point t_deliver;
+        std::vector<uint8_t>                  data;  // empty = end of stream
+    };
+
+    std::mutex              mutex;
+    std::condition_variable cv;
+    std::deque<chunk>       queue;
+
+    std::thread writer([&]() {
+        while (true) {
+            chunk c;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [&]() { return !queue.empty(); });
+                c = std::move(queue.front());
+                queue.pop_front();
+            }
+            if (c.data.empty()) {
+                break;
+            }
+            std::this_thread::sleep_until(c.t_deliver);
+            size_t sent = 0;
+            while (sent < c.data.size()) {
+                const ssize_t n = send(dst, c.data.data() + sent, c.data.size() - sent, MSG_NOSIGNAL);
+                if (n <= 0) {
+                    break;
+                }
+                sent += n;
+            }
+        }
+        shutdown(dst, SHUT_WR);
+    });
+
+    std::vector<uint8_t> buf(256 * 1024);
+    while (true) {
+        const ssize_t n = recv(src, buf.data(), buf.size(), 0);
+        const auto t_deliver = std::chrono::steady_clock::now() + std::chrono::microseconds(proxy->latency_us.load());
+
+        std::lock_guard<std::mutex> lock(mutex);
+        queue.push_back({ t_deliver, n > 0 ? std::vector<uint8_t>(buf.begin(), buf.begin() + n) : std::vector<uint8_t>() });
+        cv.notify_one();
+        if (n <= 0) {
+            break;
+        }
+    }
+
+    writer.join();
+}
+
+static int proxy_connect(const std::string & endpoint) {
+    const size_t pos = endpoint.find(':');
+    if (pos == std::string::npos) {
+        return -1;
+    }
+
+    addrinfo hints = {};
+    hints.ai_family   = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    addrinfo * res = nullptr;
+    if (getaddrinfo(endpoint.substr(0, pos).c_str(), endpoint.substr(pos + 1).c_str(), &hints, &res) != 0) {
+        return -1;
+    }
+
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (fd >= 0 && connect(fd, res->ai_addr, res->ai_addrlen) != 0) {
+        close(fd);
+        fd = -1;
+    }
+    freeaddrinfo(res);
+
+    if (fd >= 0) {
+        int flag = 1;
+        setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+    }
+
+    return fd;
+}
+
+static rpc_latency_proxy * proxy_start(const std::string & target) {
+    int fd = socket(AF_INET, SOCK_STREAM, 0);
+
+    sockaddr_in addr = {};
+    addr.sin_family      = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port        = 0;
+    socklen_t len = sizeof(addr);
+
+    if (fd < 0 || bind(fd, (sockaddr *) &addr, sizeof(addr)) != 0 || listen(fd, 4) != 0 ||
+        getsockname(fd, (sockaddr *) &addr, &len) != 0) {
+        if (fd >= 0) {
+            close(fd);
+        }
+        return nullptr;
+    }
+
+    auto * proxy = new rpc_latency_proxy;
+    proxy->target    = target;
+    proxy->endpoint  = "127.0.0.1:" + std::to_string(ntohs(addr.sin_port));
+    proxy->listen_fd = fd;
+
+    proxy->acceptor = std::thread([proxy]() {
+        while (true) {
+            const int client = accept(proxy->listen_fd, nullptr, nullptr);
+            if (client < 0) {
+                break;
+            }
+            int flag = 1;
+            setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+
+            const int server = proxy_connect(proxy->target);
+            if (server < 0) {
+                close(client);
+                continue;
+            }
+
+            std::lock_guard<std::mutex> lock(proxy->mutex);
+            proxy->fds.push_back(client);
+            proxy->fds.push_back(server);
+            proxy->threads.emplace_back(proxy_pump, proxy, client, server);
+            proxy->threads.emplace_back(proxy_pump, proxy, server, client);
+        }
+    });
+
+    return proxy;
+}
+
+static void proxy_stop(rpc_latency_proxy * proxy) {
+    shutdown(proxy->listen_fd, SHUT_RDWR);
+    close(proxy->listen_fd);
+    proxy->acceptor.join();
+
+    for (int fd : proxy->fds) {
+        shutdown(fd, SHUT_RDWR);
+    }
+    for (auto & t : proxy->threads) {
+        t.join();
+    }
+    for (int fd : proxy->fds) {
+        close(fd);
+    }
+
+    delete proxy;
+}
+
+static bool bench_generate(
+        llama_context                  * ctx,
+        const std::vector<llama_token> & prompt,
+        int32_t                          n_tokens,
+        std::vector<llama_token>       & output,
+        speculative_stats              & stats) {
+    const llama_vocab * vocab = llama_model_get_vocab(llama_get_model(ctx));
+
+    llama_memory_clear(llama_get_memory(ctx), true);
+
+    std::vector<llama_token> tokens = prompt;
+    if (llama_decode(ctx, llama_batch_get_one(tokens.data(), (int32_t) tokens.size())) != 0) {
+        return false;
+    }
+
+    llama_sampler * smpl = llama_sampler_init_greedy();
+
+    stats = {};
+    output.clear();
+
+    const int64_t t_start_us = llama_time_us();
+
+    bool ok = true;
+    while (ok && (int32_t) output.size() < n_tokens) {
+        llama_token id = llama_sampler_sample(smpl, ctx, -1);
+        output.push_back(id);
+        if (llama_vocab_is_eog(vocab, id)) {
+            break;
+        }
+        ok = llama_decode(ctx, llama_batch_get_one(&id, 1)) == 0;
+        stats.n_steps++;
+    }
+
+    stats.n_generated = (int32_t) output.size();
+    stats.t_gen_us    = llama_time_us() - t_start_us;
+
+    llama_sampler_free(smpl);
+
+    return ok;
+}
+
+bool rpc_benchmark(
+        const char             * path,
+        const rpc_split_params & params,
+        const std::string      & prompt,
+        int32_t                  n_tokens,
+        int32_t                  latency_ms,
+        speculative_stats      & stats_blocking,
+        speculative_stats      & stats_pipelined) {
+    std::vector<rpc_latency_proxy *> proxies;
+
+    rpc_split_params bparams = params;
+    bparams.endpoints.clear();
+
+    bool ok = true;
+    for (const auto & endpoint : params.endpoints) {
+        rpc_latency_proxy * proxy = proxy_start(endpoint);
+        if (!proxy) {
+            LOGE("Failed to start the latency proxy for %s", endpoint.c_str());
+            ok = false;
+            break;
+        }
+        proxies.push_back(proxy);
+        bparams.endpoints.push_back(proxy->endpoint);
+    }
+
+    llama_model   * model = ok ? rpc_load_model(path, bparams) : nullptr;
+    llama_context * ctx   = nullptr;
+
+    std::vector<llama_token> tokens;
+    if (model) {
+        tokens.resize(prompt.size() + 2);
+        const int n_prompt = llama_tokenize(llama_model_get_vocab(model), prompt.c_str(), (int32_t) prompt.size(),
+                                            tokens.data(), (int32_t) tokens.size(), true, false);
+        tokens.resize(std::max(n_prompt, 0));
+
+        auto cparams = llama_context_default_params();
+        cparams.n_ctx   = (uint32_t) (tokens.size() + n_tokens + 16);
+        cparams.n_batch = cparams.n_ctx;
+
+        ctx = tokens.empty() ? nullptr : llama_init_from_model(model, cparams);
+    }
+    ok = ok && ctx != nullptr;
+
+    // the weights are uploaded without the delay
+    for (auto * proxy : proxies) {
+        proxy->latency_us = (int64_t) latency_ms * 1000;
+    }
+
+    std::vector<llama_token> output_blocking;
+    std::vector<llama_token> output_pipelined;
+
+    if (ok) {
+        ggml_backend_rpc_set_pipelining(false);
+        ok = bench_generate(ctx, tokens, n_tokens, output_blocking, stats_blocking);
+
+        ggml_backend_rpc_set_pipelining(true);
+        ok = ok && bench_generate(ctx, tokens, n_tokens, output_pipelined, stats_pipelined);
+
+        ggml_backend_rpc_set_pipelining(params.pipelined);
+    }
+
+    // pipelining does not change the results, the wire type does
+    if (ok && params.wire_type == GGML_TYPE_F32 && output_blocking != output_pipelined) {
+        LOGE("Pipelined RPC output differs from blocking RPC");
+        ok = false;
+    }
+
+    if (ok) {
+        LOGI("RPC benchmark (%d ms latency): blocking %.2f tokens/s, pipelined %.2f tokens/s (%.2fx)",
+             latency_ms, stats_blocking.tokens_per_second(), stats_pipelined.tokens_per_second(),
+             stats_blocking.tokens_per_second() > 0.0f ? stats_pipelined.tokens_per_second() / stats_blocking.tokens_per_second() : 0.0f);
+    }
+
+    if (ctx) {
+        llama_free(ctx);
+    }
+    if (model) {
+        llama_model_free(model);
+    }
+    for (auto * proxy : proxies) {
+        proxy_stop(proxy);
+    }
+
+    return ok;
+}
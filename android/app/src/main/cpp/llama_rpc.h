@@ -0,0 +1,55 @@
+#pragma once
+
+#include "llama.h"
+#include "llama_speculative.h"
+
+#include <string>
+#include <vector>
+
+// Split execution over ggml RPC
+//
+// The model is loaded with one ggml RPC device per endpoint ("host:port" of a
+// running rpc-server). The last n_remote_layers layers are placed on the remote
+// devices, split between them by split (or by the memory they report), and the
+// rest stay on the local CPU; ggml_backend_sched copies the activations across
+// the boundary on every evaluation. Weights above 10 MB are first offered by
+// hash (RPC_CMD_SET_TENSOR_HASH), so a server started with a cache directory
+// does not receive them again in later sessions.
+//
+// The client is pipelined by default: commands without a reply (the input tensors)
+// are coalesced into one write with the graph compute that uses them, instead of
+// one write each. F32 activations can also be sent as F16 or Q8_0, which is lossy
+// and off by default.
+//
+// rpc_serve runs the server side with the CPU backend. It is what a desktop or
+// a second phone runs, and also allows a loopback setup on a single machine
+// (server on 127.0.0.1 in another process).
+
+struct rpc_split_params {
+    std::vector<std::string> endpoints;
+    int32_t            n_remote_layers = -1;             // layers placed on the servers, -1 = all
+    std::vector<float> split;                            // share per endpoint, empty = by reported free memory
+    bool               pipelined       = true;           // see ggml_backend_rpc_set_pipelining
+    enum ggml_type     wire_type       = GGML_TYPE_F32;  // F32, F16 or Q8_0 for activations on the wire
+};
+
+// Returns nullptr if a server cannot be reached or the model fails to load. The
+// pipelining and wire type settings apply to all RPC connections of the process.
+llama_model * rpc_load_model(const char * path, const rpc_split_params & params);
+
+// Serves the CPU backend on endpoint until the listening socket fails. cache_dir
+// may be nullptr (no tensor cache). mem == 0 reports the physical memory.
+// Blocks the calling thread.
+bool rpc_serve(const char * endpoint, const char * cache_dir, int32_t n_threads, size_t mem);
+
+// Greedy decoding of n_tokens after prompt with the model split over params.endpoints,
+// once with blocking RPC and once pipelined. Each server is reached through a loopback
+// proxy in this process that delays every transfer by latency_ms in both directions.
+bool rpc_benchmark(
+        const char             * path,
+        const rpc_split_params & params,
+        const std::string      & prompt,
+        int32_t                  n_tokens,
+        int32_t                  latency_ms,
+        speculative_stats      & stats_blocking,
+        speculative_stats      & stats_pipelined);
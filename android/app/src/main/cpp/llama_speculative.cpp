@@ -0,0 +1,520 @@
+#include "llama_speculative.h"
+
+#include <android/log.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <unordered_map>
+
+#define LOG_TAG "LlamaCpp"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+// draft and target vocabularies may differ by a few trailing (special) tokens
+#define SPEC_VOCAB_MAX_SIZE_DIFFERENCE  128
+#define SPEC_VOCAB_CHECK_START_TOKEN_ID 5
+
+// rolling-hash index of the n-grams seen in the context, each mapped to the
+// position that follows its most recent occurrence
+struct ngram_index {
+    static constexpr uint64_t base = 0x100000001b3ULL;
+
+    int32_t  n   = 3;
+    uint64_t pow = 1;  // base^(n - 1)
+
+    std::unordered_map<uint64_t, int32_t> map;
+
+    int32_t  n_indexed = 0;  // n-grams ending before this position are in the map
+    uint64_t h         = 0;  // hash of tokens[n_indexed - n, n_indexed)
+
+    void init(int32_t ngram_size, size_t n_reserve) {
+        n   = ngram_size;
+        pow = 1;
+        for (int i = 1; i < n; ++i) {
+            pow *= base;
+        }
+        map.clear();
+        map.reserve(n_reserve);
+        n_indexed = 0;
+        h         = 0;
+    }
+
+    uint64_t hash(const llama_token * t) const {
+        uint64_t res = 0;
+        for (int i = 0; i < n; ++i) {
+            res = res*base + (uint32_t) t[i];
+        }
+        return res;
+    }
+
+    // index every n-gram that already has at least one token after it
+    void update(const std::vector<llama_token> & tokens) {
+        const int32_t n_tokens = (int32_t) tokens.size();
+
+        for (; n_indexed + 1 < n_tokens; ++n_indexed) {
+            if (n_indexed >= n) {
+                h -= (uint32_t) tokens[n_indexed - n] * pow;
+            }
+            h = h*base + (uint32_t) tokens[n_indexed];
+
+            if (n_indexed + 1 >= n) {
+                map[h] = n_indexed + 1;
+            }
+        }
+    }
+
+    // start of the continuation of the trailing n-gram, -1 if it was not seen before
+    int32_t find(const std::vector<llama_token> & tokens) const {
+        const int32_t n_tokens = (int32_t) tokens.size();
+        if (n_tokens <= n) {
+            return -1;
+        }
+
+        const llama_token * tail = tokens.data() + n_tokens - n;
+
+        const auto it = map.find(hash(tail));
+        if (it == map.end() || it->second >= n_tokens) {
+            return -1;
+        }
+
+        // guard against hash collisions
+        if (!std::equal(tail, tail + n, tokens.data() + it->second - n)) {
+            return -1;
+        }
+
+        return it->second;
+    }
+};
+
+struct speculative_session {
+    llama_context * ctx_tgt = nullptr;
+    llama_context * ctx_dft = nullptr;  // null when drafting by prompt lookup
+
+    int32_t n_past_dft = 0;
+    ngram_index lookup;
+
+    speculative_params params;
+    speculative_stats  stats;
+
+    // top-k/top-p/temp without the final dist sampler - the sampling itself is
+    // done here so that the target and draft probabilities can be compared
+    llama_sampler * filter = nullptr;
+
+    std::mt19937 rng;
+
+    llama_batch batch_tgt;
+    llama_batch batch_dft;
+
+    std::vector<llama_token_data>   cur;  // candidate scratch, n_vocab entries
+    std::vector<float>              p;    // target distribution at the current position
+    std::vector<std::vector<float>> q;    // draft distribution for every drafted position, unused for lookup
+};
+
+float speculative_stats::acceptance_rate() const {
+    return n_drafted > 0 ? (float) n_accepted / n_drafted : 0.0f;
+}
+
+float speculative_stats::tokens_per_second() const {
+    return t_gen_us > 0 ? 1e6f * n_generated / t_gen_us : 0.0f;
+}
+
+static void batch_add(llama_batch & batch, llama_token id, llama_pos pos, bool logits) {
+    const int i = batch.n_tokens;
+
+    batch.token   [i]    = id;
+    batch.pos     [i]    = pos;
+    batch.n_seq_id[i]    = 1;
+    batch.seq_id  [i][0] = 0;
+    batch.logits  [i]    = logits;
+
+    batch.n_tokens++;
+}
+
+// evaluate tokens[i0, i1) at positions i0.. and request logits for the last one
+static bool decode_range(llama_context * ctx, llama_batch & batch, const std::vector<llama_token> & tokens, int i0, int i1) {
+    const int n_batch = (int) llama_n_batch(ctx);
+
+    for (int i = i0; i < i1; i += n_batch) {
+        const int n = std::min(n_batch, i1 - i);
+
+        batch.n_tokens = 0;
+        for (int j = 0; j < n; ++j) {
+            batch_add(batch, tokens[i + j], i + j, i + j == i1 - 1);
+        }
+
+        if (llama_decode(ctx, batch) != 0) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// probabilities of the filtered candidate set, scattered into a dense n_vocab array
+static void compute_probs(speculative_session * spec, const float * logits, std::vector<float> & probs) {
+    const int n_vocab = (int) probs.size();
+
+    std::fill(probs.begin(), probs.end(), 0.0f);
+
+    if (spec->params.temp <= 0.0f) {
+        probs[std::max_element(logits, logits + n_vocab) - logits] = 1.0f;
+        return;
+    }
+
+    for (llama_token id = 0; id < n_vocab; ++id) {
+        spec->cur[id] = llama_token_data{ id, logits[id], 0.0f };
+    }
+
+    llama_token_data_array cur_p = { spec->cur.data(), spec->cur.size(), -1, false };
+    llama_sampler_apply(spec->filter, &cur_p);
+
+    float max_l = -INFINITY;
+    for (size_t i = 0; i < cur_p.size; ++i) {
+        max_l = std::max(max_l, cur_p.data[i].logit);
+    }
+
+    float sum = 0.0f;
+    for (size_t i = 0; i < cur_p.size; ++i) {
+        const float e = expf(cur_p.data[i].logit - max_l);
+        probs[cur_p.data[i].id] = e;
+        sum += e;
+    }
+
+    for (size_t i = 0; i < cur_p.size; ++i) {
+        probs[cur_p.data[i].id] /= sum;
+    }
+}
+
+// draw from a dense, possibly unnormalized distribution
+static llama_token sample_probs(const std::vector<float> & probs, std::mt19937 & rng) {
+    double sum = 0.0;
+    for (float v : probs) {
+        sum += v;
+    }
+
+    const double r = std::uniform_real_distribution<double>(0.0, sum)(rng);
+
+    double acc = 0.0;
+    llama_token last = 0;
+    for (llama_token id = 0; id < (llama_token) probs.size(); ++id) {
+        if (probs[id] <= 0.0f) {
+            continue;
+        }
+        acc += probs[id];
+        last = id;
+        if (r < acc) {
+            return id;
+        }
+    }
+
+    return last;
+}
+
+bool speculative_is_compatible(const llama_context * ctx_tgt, const llama_context * ctx_dft) {
+    const llama_vocab * vocab_tgt = llama_model_get_vocab(llama_get_model(ctx_tgt));
+    const llama_vocab * vocab_dft = llama_model_get_vocab(llama_get_model(ctx_dft));
+
+    if (llama_vocab_type(vocab_tgt) != llama_vocab_type(vocab_dft)) {
+        LOGE("Draft model vocab type differs from the target");
+        return false;
+    }
+
+    if (llama_vocab_get_add_bos(vocab_tgt) != llama_vocab_get_add_bos(vocab_dft) ||
+        llama_vocab_bos(vocab_tgt) != llama_vocab_bos(vocab_dft) ||
+        llama_vocab_eos(vocab_tgt) != llama_vocab_eos(vocab_dft)) {
+        LOGE("Draft model special tokens differ from the target");
+        return false;
+    }
+
+    const int n_vocab_tgt = llama_vocab_n_tokens(vocab_tgt);
+    const int n_vocab_dft = llama_vocab_n_tokens(vocab_dft);
+
+    if (std::abs(n_vocab_tgt - n_vocab_dft) > SPEC_VOCAB_MAX_SIZE_DIFFERENCE) {
+        LOGE("Draft model vocab size %d is too far from the target's %d", n_vocab_dft, n_vocab_tgt);
+        return false;
+    }
+
+    for (int i = SPEC_VOCAB_CHECK_START_TOKEN_ID; i < std::min(n_vocab_tgt, n_vocab_dft); ++i) {
+        if (std::strcmp(llama_vocab_get_text(vocab_tgt, i), llama_vocab_get_text(vocab_dft, i)) != 0) {
+            LOGE("Draft model token %d differs from the target", i);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+speculative_session * speculative_init(llama_context * ctx_tgt, llama_context * ctx_dft, const speculative_params & params) {
+    if (llama_model_is_recurrent(llama_get_model(ctx_tgt)) || (ctx_dft && llama_model_is_recurrent(llama_get_model(ctx_dft)))) {
+        LOGE("Speculative decoding needs partial KV rollback, recurrent models are not supported");
+        return nullptr;
+    }
+
+    if (ctx_dft && !speculative_is_compatible(ctx_tgt, ctx_dft)) {
+        return nullptr;
+    }
+
+    auto * spec = new speculative_session;
+
+    spec->ctx_tgt = ctx_tgt;
+    spec->ctx_dft = ctx_dft;
+    spec->params  = params;
+    spec->params.n_draft = std::max(1, params.n_draft);
+    spec->params.n_gram  = std::max(1, params.n_gram);
+
+    spec->filter = llama_sampler_chain_init(llama_sampler_chain_default_params());
+    llama_sampler_chain_add(spec->filter, llama_sampler_init_top_k(params.top_k));
+    llama_sampler_chain_add(spec->filter, llama_sampler_init_top_p(params.top_p, 1));
+    llama_sampler_chain_add(spec->filter, llama_sampler_init_temp(params.temp));
+
+    spec->rng.seed(params.seed == LLAMA_DEFAULT_SEED ? std::random_device{}() : params.seed);
+
+    spec->batch_tgt = llama_batch_init(std::max<int>(llama_n_batch(ctx_tgt), spec->params.n_draft + 1), 0, 1);
+    spec->batch_dft = llama_batch_init(ctx_dft ? llama_n_batch(ctx_dft) : 1, 0, 1);
+
+    // only tokens shared by both vocabularies can be drafted
+    int n_vocab = llama_vocab_n_tokens(llama_model_get_vocab(llama_get_model(ctx_tgt)));
+    if (ctx_dft) {
+        n_vocab = std::min(n_vocab, llama_vocab_n_tokens(llama_model_get_vocab(llama_get_model(ctx_dft))));
+        spec->q.assign(spec->params.n_draft, std::vector<float>(n_vocab));
+    }
+
+    spec->cur.resize(n_vocab);
+    spec->p.resize(n_vocab);
+
+    return spec;
+}
+
+void speculative_free(speculative_session * spec) {
+    if (spec == nullptr) {
+        return;
+    }
+
+    llama_batch_free(spec->batch_tgt);
+    llama_batch_free(spec->batch_dft);
+    llama_sampler_free(spec->filter);
+
+    delete spec;
+}
+
+const speculative_stats & speculative_get_stats(const speculative_session * spec) {
+    return spec->stats;
+}
+
+// propose up to n_draft tokens by sampling the draft model, filling q with its distributions
+static bool draft_with_model(speculative_session * spec, const std::vector<llama_token> & tokens, int n_draft, std::vector<llama_token> & draft) {
+    llama_context * ctx_dft = spec->ctx_dft;
+
+    if (!decode_range(ctx_dft, spec->batch_dft, tokens, spec->n_past_dft, (int) tokens.size())) {
+        LOGE("Failed to decode on the draft model");
+        return false;
+    }
+    spec->n_past_dft = (int) tokens.size();
+
+    for (int i = 0; i < n_draft; ++i) {
+        compute_probs(spec, llama_get_logits_ith(ctx_dft, -1), spec->q[i]);
+
+        const llama_token d = sample_probs(spec->q[i], spec->rng);
+        draft.push_back(d);
+
+        if (i + 1 == n_draft) {
+            break;
+        }
+
+        spec->batch_dft.n_tokens = 0;
+        batch_add(spec->batch_dft, d, spec->n_past_dft, true);
+
+        if (llama_decode(ctx_dft, spec->batch_dft) != 0) {
+            LOGE("Failed to decode draft token");
+            return false;
+        }
+        spec->n_past_dft++;
+    }
+
+    return true;
+}
+
+// propose the tokens that followed the previous occurrence of the trailing n-gram
+static void draft_with_lookup(speculative_session * spec, const std::vector<llama_token> & tokens, int n_draft, std::vector<llama_token> & draft) {
+    spec->lookup.update(tokens);
+
+    const int32_t i0 = spec->lookup.find(tokens);
+    if (i0 < 0) {
+        return;
+    }
+
+    const int32_t i1 = std::min<int32_t>(i0 + n_draft, (int32_t) tokens.size());
+    draft.insert(draft.end(), tokens.begin() + i0, tokens.begin() + i1);
+}
+
+bool speculative_generate(
+        speculative_session            * spec,
+        const std::vector<llama_token> & prompt,
+        int32_t                          max_tokens,
+        std::vector<llama_token>       & result) {
+    llama_context * ctx_tgt = spec->ctx_tgt;
+    llama_context * ctx_dft = spec->ctx_dft;
+
+    const llama_vocab * vocab = llama_model_get_vocab(llama_get_model(ctx_tgt));
+
+    const int n_ctx = (int) (ctx_dft ? std::min(llama_n_ctx(ctx_tgt), llama_n_ctx(ctx_dft)) : llama_n_ctx(ctx_tgt));
+
+    auto & stats = spec->stats;
+    stats = {};
+
+    result.clear();
+
+    if (prompt.empty() || max_tokens <= 0 || (int) prompt.size() >= n_ctx) {
+        return false;
+    }
+
+    const int64_t t_start_us = llama_time_us();
+
+    llama_memory_clear(llama_get_memory(ctx_tgt), true);
+    if (ctx_dft) {
+        llama_memory_clear(llama_get_memory(ctx_dft), true);
+    }
+
+    // tokens[0, tokens.size() - 1) are in the target KV cache, the last one is pending
+    std::vector<llama_token> tokens = prompt;
+    tokens.reserve(prompt.size() + max_tokens + spec->params.n_draft);
+
+    spec->n_past_dft = 0;
+    spec->lookup.init(spec->params.n_gram, tokens.capacity());
+
+    if (!decode_range(ctx_tgt, spec->batch_tgt, tokens, 0, (int) tokens.size())) {
+        LOGE("Failed to decode prompt on the target model");
+        return false;
+    }
+
+    compute_probs(spec, llama_get_logits_ith(ctx_tgt, -1), spec->p);
+
+    llama_token id = sample_probs(spec->p, spec->rng);
+    tokens.push_back(id);
+    result.push_back(id);
+
+    std::vector<llama_token> draft;
+
+    bool ok = true;
+
+    while ((int) result.size() < max_tokens && !llama_vocab_is_eog(vocab, id)) {
+        const int n_past = (int) tokens.size() - 1;
+
+        // a step emits at most n_draft + 1 tokens and must fit in both contexts
+        const int n_draft = std::min({
+            spec->params.n_draft,
+            max_tokens - (int) result.size() - 1,
+            n_ctx - n_past - 1,
+        });
+
+        if (n_draft < 0) {
+            break;
+        }
+
+        draft.clear();
+
+        if (n_draft > 0) {
+            if (ctx_dft) {
+                if (!draft_with_model(spec, tokens, n_draft, draft)) {
+                    ok = false;
+                    break;
+                }
+            } else {
+                draft_with_lookup(spec, tokens, n_draft, draft);
+            }
+        }
+
+        // verify the pending token and all drafts in one target pass
+        spec->batch_tgt.n_tokens = 0;
+        batch_add(spec->batch_tgt, id, n_past, true);
+        for (int i = 0; i < (int) draft.size(); ++i) {
+            batch_add(spec->batch_tgt, draft[i], n_past + 1 + i, true);
+        }
+
+        if (llama_decode(ctx_tgt, spec->batch_tgt) != 0) {
+            LOGE("Failed to decode draft batch on the target model");
+            ok = false;
+            break;
+        }
+
+        stats.n_steps++;
+        stats.n_drafted += (int) draft.size();
+
+        int n_accepted = 0;
+
+        for (int i = 0; i <= (int) draft.size(); ++i) {
+            compute_probs(spec, llama_get_logits_ith(ctx_tgt, i), spec->p);
+
+            bool accepted = false;
+
+            if (i == (int) draft.size()) {
+                // every draft was accepted - the target logits give one more token for free
+                id = sample_probs(spec->p, spec->rng);
+            } else {
+                // a lookup draft is deterministic, i.e. q is one-hot on d
+                const llama_token d  = draft[i];
+                const float       pd = spec->p[d];
+                const float       qd = ctx_dft ? spec->q[i][d] : 1.0f;
+
+                const float r = std::uniform_real_distribution<float>(0.0f, 1.0f)(spec->rng);
+
+                if (qd > 0.0f && r * qd <= pd) {
+                    id = d;
+                    accepted = true;
+                    n_accepted++;
+                } else {
+                    // resample from the residual max(0, p - q)
+                    float sum = 0.0f;
+                    if (ctx_dft) {
+                        for (size_t v = 0; v < spec->p.size(); ++v) {
+                            spec->p[v] = std::max(0.0f, spec->p[v] - spec->q[i][v]);
+                            sum += spec->p[v];
+                        }
+                    } else {
+                        spec->p[d] = 0.0f;
+                        for (float v : spec->p) {
+                            sum += v;
+                        }
+                    }
+                    if (sum <= 0.0f) {
+                        compute_probs(spec, llama_get_logits_ith(ctx_tgt, i), spec->p);
+                    }
+                    id = sample_probs(spec->p, spec->rng);
+                }
+            }
+
+            tokens.push_back(id);
+            result.push_back(id);
+
+            if (!accepted || llama_vocab_is_eog(vocab, id)) {
+                break;
+            }
+        }
+
+        stats.n_accepted += n_accepted;
+
+        // keep the pending token and the accepted drafts, drop the rest from both caches
+        const int n_keep = n_past + 1 + n_accepted;
+
+        llama_memory_seq_rm(llama_get_memory(ctx_tgt), 0, n_keep, -1);
+
+        if (ctx_dft) {
+            spec->n_past_dft = std::min(spec->n_past_dft, n_keep);
+            llama_memory_seq_rm(llama_get_memory(ctx_dft), 0, spec->n_past_dft, -1);
+        }
+    }
+
+    if ((int) result.size() > max_tokens) {
+        result.resize(max_tokens);
+    }
+
+    stats.n_generated = (int) result.size();
+    stats.t_gen_us    = llama_time_us() - t_start_us;
+
+    LOGI("Speculative decoding (%s): %d tokens in %d steps, accepted %d/%d drafts (%.1f%%), %.2f tokens/s",
+         ctx_dft ? "draft model" : "prompt lookup", stats.n_generated, stats.n_steps, stats.n_accepted, stats.n_drafted,
+         100.0f * stats.acceptance_rate(), stats.tokens_per_second());
+
+    return ok;
+}
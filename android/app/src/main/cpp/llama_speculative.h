@@ -0,0 +1,58 @@
+#pragma once
+
+#include "llama.h"
+
+#include <vector>
+
+// Speculative decoding for the bridge generation loop
+//
+// A drafter proposes up to n_draft tokens, the target scores all of them in a
+// single llama_decode and a rejection-sampling step accepts a prefix of the draft.
+// The accepted tokens follow exactly the distribution of sampling from the target
+// alone; rejected drafts are rolled back from the KV caches with llama_memory_seq_rm.
+//
+// Two drafters are available:
+//  - a small draft model that shares the target vocabulary
+//  - prompt lookup: no second model, the tokens that followed the previous occurrence
+//    of the last n_gram tokens in the context are proposed (good for summarizing,
+//    rewriting and answering from pasted text)
+
+struct speculative_params {
+    int32_t  n_draft = 5;     // tokens proposed by the drafter per target pass
+    int32_t  n_gram  = 3;     // prompt lookup: length of the n-gram to match
+    int32_t  top_k   = 40;
+    float    top_p   = 0.9f;
+    float    temp    = 0.8f;  // <= 0.0f selects greedy decoding
+    uint32_t seed    = LLAMA_DEFAULT_SEED;
+};
+
+struct speculative_stats {
+    int32_t n_steps     = 0;  // batched target verifications
+    int32_t n_drafted   = 0;  // tokens proposed by the drafter
+    int32_t n_accepted  = 0;  // proposed tokens accepted by the target
+    int32_t n_generated = 0;  // tokens emitted, including corrections and bonus tokens
+    int64_t t_gen_us    = 0;  // wall time of the generation, prompt included
+
+    float acceptance_rate() const;
+    float tokens_per_second() const;
+};
+
+struct speculative_session;
+
+// The draft model must use the same tokenizer as the target
+bool speculative_is_compatible(const llama_context * ctx_tgt, const llama_context * ctx_dft);
+
+// ctx_dft == nullptr selects the prompt-lookup drafter
+speculative_session * speculative_init(llama_context * ctx_tgt, llama_context * ctx_dft, const speculative_params & params);
+void                  speculative_free(speculative_session * spec);
+
+// Clears the KV caches, evaluates the prompt and generates up to max_tokens tokens,
+// stopping after an end-of-generation token. Returns false if a llama_decode call fails;
+// the tokens produced until then are still returned in result.
+bool speculative_generate(
+        speculative_session            * spec,
+        const std::vector<llama_token> & prompt,
+        int32_t                          max_tokens,
+        std::vector<llama_token>       & result);
+
+const speculative_stats & speculative_get_stats(const speculative_session * spec);
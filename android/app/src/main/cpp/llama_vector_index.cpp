@@ -0,0 +1,520 @@
+#include "llama_vector_index.h"
+
+#include "ggml-cpu.h"
+
+#include <android/log.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#define LOG_TAG "LlamaCpp"
+#define LOGI(...) __android_log_print(ANDROID_LOG_INFO, LOG_TAG, __VA_ARGS__)
+#define LOGE(...) __android_log_print(ANDROID_LOG_ERROR, LOG_TAG, __VA_ARGS__)
+
+#define VECTOR_INDEX_MAGIC   0x5849564cu  // "LVIX"
+#define VECTOR_INDEX_VERSION 1
+
+// max vectors sampled for k-means, per list
+#define VECTOR_INDEX_TRAIN_SAMPLES_PER_LIST 256
+
+struct vector_index_header {
+    uint32_t magic;
+    uint32_t version;
+    int32_t  dim;
+    int32_t  type;
+    int32_t  n_lists;
+    int32_t  trained;
+    int64_t  n_vectors;
+    uint8_t  reserved[32];
+};
+
+static_assert(sizeof(vector_index_header) == 64, "unexpected vector_index_header size");
+
+struct vector_index {
+    std::string path;
+    int         fd = -1;
+
+    vector_index_header hdr;
+
+    size_t row_size    = 0;  // quantized vector
+    size_t record_size = 0;  // list id + row, padded to 4 bytes
+    size_t data_offset = 0;  // first record
+
+    uint8_t * map      = nullptr;
+    size_t    map_size = 0;
+
+    const ggml_type_traits_cpu * traits   = nullptr;  // storage type
+    const ggml_type_traits_cpu * traits_q = nullptr;  // query type (vec_dot_type)
+    const ggml_type_traits     * to_float = nullptr;
+
+    std::vector<float>                centroids;  // n_lists x dim
+    std::vector<std::vector<int64_t>> lists;      // vector ids per list, trained index only
+};
+
+static const float * centroid(const vector_index * index, int32_t l) {
+    return index->centroids.data() + (size_t) l * index->hdr.dim;
+}
+
+static int32_t record_list(const vector_index * index, int64_t id) {
+    int32_t list;
+    memcpy(&list, index->map + index->data_offset + id * index->record_size, sizeof(list));
+    return list;
+}
+
+static const uint8_t * record_row(const vector_index * index, int64_t id) {
+    return index->map + index->data_offset + id * index->record_size + sizeof(int32_t);
+}
+
+static bool write_at(int fd, const void * data, size_t size, off_t offset) {
+    const uint8_t * p = (const uint8_t *) data;
+    while (size > 0) {
+        const ssize_t n = pwrite(fd, p, size, offset);
+        if (n <= 0) {
+            return false;
+        }
+        p      += n;
+        size   -= (size_t) n;
+        offset += n;
+    }
+    return true;
+}
+
+static bool remap(vector_index * index) {
+    if (index->map) {
+        munmap(index->map, index->map_size);
+        index->map      = nullptr;
+        index->map_size = 0;
+    }
+
+    const size_t size = index->data_offset + (size_t) index->hdr.n_vectors * index->record_size;
+
+    void * map = mmap(nullptr, size, PROT_READ, MAP_SHARED, index->fd, 0);
+    if (map == MAP_FAILED) {
+        LOGE("Failed to map vector index %s", index->path.c_str());
+        return false;
+    }
+
+    index->map      = (uint8_t *) map;
+    index->map_size = size;
+
+    return true;
+}
+
+static bool init_layout(vector_index * index) {
+    const int32_t   dim  = index->hdr.dim;
+    const ggml_type type = (ggml_type) index->hdr.type;
+
+    if (type != GGML_TYPE_Q8_0 && type != GGML_TYPE_F16) {
+        LOGE("Unsupported vector index type %s", ggml_type_name(type));
+        return false;
+    }
+    if (dim <= 0 || dim % ggml_blck_size(type) != 0) {
+        LOGE("Vector index dim %d is not a multiple of the %s block size", dim, ggml_type_name(type));
+        return false;
+    }
+
+    // also initializes the f16 tables used by the kernels
+    ggml_cpu_init();
+
+    index->traits   = ggml_get_type_traits_cpu(type);
+    index->traits_q = ggml_get_type_traits_cpu(index->traits->vec_dot_type);
+    index->to_float = ggml_get_type_traits(type);
+
+    index->row_size    = ggml_row_size(type, dim);
+    index->record_size = GGML_PAD(sizeof(int32_t) + index->row_size, 4);
+    index->data_offset = sizeof(vector_index_header) + (size_t) index->hdr.n_lists * dim * sizeof(float);
+
+    return true;
+}
+
+// rebuild the in-memory inverted lists from the list id of every record
+static void build_lists(vector_index * index) {
+    index->lists.assign(index->hdr.trained ? index->hdr.n_lists : 0, {});
+    if (!index->hdr.trained) {
+        return;
+    }
+
+    for (int64_t id = 0; id < index->hdr.n_vectors; ++id) {
+        const int32_t list = record_list(index, id);
+        if (list >= 0 && list < index->hdr.n_lists) {
+            index->lists[list].push_back(id);
+        }
+    }
+}
+
+static int32_t nearest_centroid(const vector_index * index, const float * x) {
+    int32_t best       = 0;
+    float   best_score = -INFINITY;
+
+    for (int32_t l = 0; l < index->hdr.n_lists; ++l) {
+        float score = 0.0f;
+        for (int32_t i = 0; i < index->hdr.dim; ++i) {
+            score += centroid(index, l)[i] * x[i];
+        }
+        if (score > best_score) {
+            best_score = score;
+            best       = l;
+        }
+    }
+
+    return best;
+}
+
+vector_index * vector_index_create(const char * path, int32_t dim, enum ggml_type type, int32_t n_lists) {
+    auto * index = new vector_index;
+    index->path = path;
+
+    memset(&index->hdr, 0, sizeof(index->hdr));
+    index->hdr.magic     = VECTOR_INDEX_MAGIC;
+    index->hdr.version   = VECTOR_INDEX_VERSION;
+    index->hdr.dim       = dim;
+    index->hdr.type      = (int32_t) type;
+    index->hdr.n_lists   = std::max(n_lists, 0);
+    index->hdr.trained   = 0;
+    index->hdr.n_vectors = 0;
+
+    if (!init_layout(index)) {
+        delete index;
+        return nullptr;
+    }
+
+    index->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (index->fd < 0) {
+        LOGE("Failed to create vector index %s", path);
+        delete index;
+        return nullptr;
+    }
+
+    index->centroids.assign((size_t) index->hdr.n_lists * dim, 0.0f);
+
+    if (!write_at(index->fd, &index->hdr, sizeof(index->hdr), 0) ||
+        !write_at(index->fd, index->centroids.data(), index->centroids.size() * sizeof(float), sizeof(index->hdr)) ||
+        !remap(index)) {
+        vector_index_free(index);
+        return nullptr;
+    }
+
+    LOGI("Created vector index %s: dim = %d, type = %s, n_lists = %d", path, dim, ggml_type_name(type), index->hdr.n_lists);
+
+    return index;
+}
+
+vector_index * vector_index_open(const char * path) {
+    auto * index = new vector_index;
+    index->path = path;
+
+    index->fd = open(path, O_RDWR);
+    if (index->fd < 0) {
+        delete index;
+        return nullptr;
+    }
+
+    if (pread(index->fd, &index->hdr, sizeof(index->hdr), 0) != (ssize_t) sizeof(index->hdr) ||
+        index->hdr.magic != VECTOR_INDEX_MAGIC || index->hdr.version != VECTOR_INDEX_VERSION) {
+        LOGE("%s is not a vector index", path);
+        vector_index_free(index);
+        return nullptr;
+    }
+
+    if (!init_layout(index)) {
+        vector_index_free(index);
+        return nullptr;
+    }
+
+    // drop a partially written trailing record
+    struct stat st;
+    if (fstat(index->fd, &st) != 0 || (size_t) st.st_size < index->data_offset) {
+        LOGE("Vector index %s is truncated", path);
+        vector_index_free(index);
+        return nullptr;
+    }
+    index->hdr.n_vectors = std::min<int64_t>(index->hdr.n_vectors, (st.st_size - index->data_offset) / index->record_size);
+
+    index->centroids.resize((size_t) index->hdr.n_lists * index->hdr.dim);
+    if (!index->centroids.empty() &&
+        pread(index->fd, index->centroids.data(), index->centroids.size() * sizeof(float), sizeof(index->hdr)) !=
+            (ssize_t) (index->centroids.size() * sizeof(float))) {
+        vector_index_free(index);
+        return nullptr;
+    }
+
+    if (!remap(index)) {
+        vector_index_free(index);
+        return nullptr;
+    }
+
+    build_lists(index);
+
+    LOGI("Opened vector index %s: %lld vectors, dim = %d, type = %s, n_lists = %d%s",
+         path, (long long) index->hdr.n_vectors, index->hdr.dim, ggml_type_name((ggml_type) index->hdr.type),
+         index->hdr.n_lists, index->hdr.trained ? " (trained)" : "");
+
+    return index;
+}
+
+void vector_index_free(vector_index * index) {
+    if (!index) {
+        return;
+    }
+
+    if (index->map) {
+        munmap(index->map, index->map_size);
+    }
+    if (index->fd >= 0) {
+        close(index->fd);
+    }
+    delete index;
+}
+
+int32_t vector_index_dim(const vector_index * index) {
+    return index->hdr.dim;
+}
+
+int64_t vector_index_size(const vector_index * index) {
+    return index->hdr.n_vectors;
+}
+
+bool vector_index_trained(const vector_index * index) {
+    return index->hdr.trained != 0;
+}
+
+bool vector_index_add(vector_index * index, const float * vectors, int64_t n) {
+    if (n <= 0) {
+        return true;
+    }
+
+    const int32_t dim = index->hdr.dim;
+
+    std::vector<uint8_t> records(n * index->record_size, 0);
+    for (int64_t i = 0; i < n; ++i) {
+        const float * x = vectors + i * dim;
+
+        const int32_t list = index->hdr.trained ? nearest_centroid(index, x) : -1;
+
+        uint8_t * rec = records.data() + i * index->record_size;
+        memcpy(rec, &list, sizeof(list));
+        index->traits->from_float(x, rec + sizeof(int32_t), dim);
+    }
+
+    const int64_t first = index->hdr.n_vectors;
+    const off_t   offs  = (off_t) (index->data_offset + first * index->record_size);
+
+    // records first, then the header, so a crash never exposes unwritten records
+    if (!write_at(index->fd, records.data(), records.size(), offs)) {
+        LOGE("Failed to append to vector index %s", index->path.c_str());
+        return false;
+    }
+
+    index->hdr.n_vectors += n;
+    if (!write_at(index->fd, &index->hdr, sizeof(index->hdr), 0)) {
+        index->hdr.n_vectors -= n;
+        return false;
+    }
+
+    if (index->hdr.trained) {
+        for (int64_t i = 0; i < n; ++i) {
+            int32_t list;
+            memcpy(&list, records.data() + i * index->record_size, sizeof(list));
+            index->lists[list].push_back(first + i);
+        }
+    }
+
+    return remap(index);
+}
+
+bool vector_index_train(vector_index * index, int32_t n_iter) {
+    const int32_t dim     = index->hdr.dim;
+    const int32_t n_lists = index->hdr.n_lists;
+    const int64_t n       = index->hdr.n_vectors;
+
+    if (n_lists == 0) {
+        LOGE("Vector index %s was created without IVF lists", index->path.c_str());
+        return false;
+    }
+    if (n < n_lists) {
+        LOGE("Training %d lists needs at least as many vectors, the index has %lld", n_lists, (long long) n);
+        return false;
+    }
+
+    const int64_t t_start_us = ggml_time_us();
+
+    // dequantized training sample
+    std::mt19937 rng(42);
+    std::vector<int64_t> sample(n);
+    for (int64_t i = 0; i < n; ++i) {
+        sample[i] = i;
+    }
+    std::shuffle(sample.begin(), sample.end(), rng);
+    sample.resize(std::min<int64_t>(n, (int64_t) n_lists * VECTOR_INDEX_TRAIN_SAMPLES_PER_LIST));
+
+    const int64_t n_sample = (int64_t) sample.size();
+
+    std::vector<float> xs(n_sample * dim);
+    for (int64_t i = 0; i < n_sample; ++i) {
+        index->to_float->to_float(record_row(index, sample[i]), xs.data() + i * dim, dim);
+    }
+
+    // spherical k-means, initialized with the first n_lists samples
+    std::vector<float> & c = index->centroids;
+    std::copy(xs.begin(), xs.begin() + (size_t) n_lists * dim, c.begin());
+
+    std::vector<int32_t> assign(n_sample, 0);
+    std::vector<float>   sum((size_t) n_lists * dim);
+    std::vector<int64_t> count(n_lists);
+
+    for (int32_t it = 0; it < n_iter; ++it) {
+        for (int64_t i = 0; i < n_sample; ++i) {
+            assign[i] = nearest_centroid(index, xs.data() + i * dim);
+        }
+
+        std::fill(sum.begin(), sum.end(), 0.0f);
+        std::fill(count.begin(), count.end(), 0);
+        for (int64_t i = 0; i < n_sample; ++i) {
+            const float * x = xs.data() + i * dim;
+            float       * s = sum.data() + (size_t) assign[i] * dim;
+            for (int32_t j = 0; j < dim; ++j) {
+                s[j] += x[j];
+            }
+            count[assign[i]]++;
+        }
+
+        for (int32_t l = 0; l < n_lists; ++l) {
+            float * dst = c.data() + (size_t) l * dim;
+            if (count[l] == 0) {
+                // re-seed an empty list with a random sample
+                const float * x = xs.data() + (rng() % n_sample) * dim;
+                std::copy(x, x + dim, dst);
+                continue;
+            }
+
+            const float * s = sum.data() + (size_t) l * dim;
+            double norm = 0.0;
+            for (int32_t j = 0; j < dim; ++j) {
+                norm += (double) s[j] * s[j];
+            }
+            const float scale = norm > 0.0 ? (float) (1.0 / std::sqrt(norm)) : 0.0f;
+            for (int32_t j = 0; j < dim; ++j) {
+                dst[j] = s[j] * scale;
+            }
+        }
+    }
+
+    // assign every stored vector and persist the list ids
+    std::vector<float> x(dim);
+    for (int64_t id = 0; id < n; ++id) {
+        index->to_float->to_float(record_row(index, id), x.data(), dim);
+
+        const int32_t list = nearest_centroid(index, x.data());
+        if (!write_at(index->fd, &list, sizeof(list), (off_t) (index->data_offset + id * index->record_size))) {
+            return false;
+        }
+    }
+
+    index->hdr.trained = 1;
+    if (!write_at(index->fd, c.data(), c.size() * sizeof(float), sizeof(index->hdr)) ||
+        !write_at(index->fd, &index->hdr, sizeof(index->hdr), 0)) {
+        index->hdr.trained = 0;
+        return false;
+    }
+
+    build_lists(index);
+
+    LOGI("Trained vector index %s: %d lists from %lld samples in %.1f ms",
+         index->path.c_str(), n_lists, (long long) n_sample, (ggml_time_us() - t_start_us) / 1000.0);
+
+    return true;
+}
+
+// bounded min-heap of (score, id), the worst of the current top-k on top
+struct top_k {
+    int32_t k;
+    std::vector<std::pair<float, int64_t>> heap;
+
+    static bool cmp(const std::pair<float, int64_t> & a, const std::pair<float, int64_t> & b) {
+        return a.first > b.first;
+    }
+
+    void push(float score, int64_t id) {
+        if ((int32_t) heap.size() < k) {
+            heap.emplace_back(score, id);
+            std::push_heap(heap.begin(), heap.end(), cmp);
+        } else if (score > heap.front().first) {
+            std::pop_heap(heap.begin(), heap.end(), cmp);
+            heap.back() = { score, id };
+            std::push_heap(heap.begin(), heap.end(), cmp);
+        }
+    }
+};
+
+int32_t vector_index_search(
+        const vector_index * index,
+        const float        * query,
+        int32_t              k,
+        int32_t              n_probe,
+        int64_t            * ids,
+        float              * scores) {
+    if (k <= 0 || index->hdr.n_vectors == 0) {
+        return 0;
+    }
+
+    const int32_t dim = index->hdr.dim;
+
+    // the query in the type the storage kernel expects
+    std::vector<uint8_t> q(ggml_row_size(index->traits->vec_dot_type, dim));
+    index->traits_q->from_float(query, q.data(), dim);
+
+    const ggml_vec_dot_t vec_dot = index->traits->vec_dot;
+
+    top_k best { k, {} };
+    best.heap.reserve(k);
+
+    auto score_id = [&](int64_t id) {
+        float s;
+        vec_dot(dim, &s, 0, record_row(index, id), 0, q.data(), 0, 1);
+        best.push(s, id);
+    };
+
+    if (!index->hdr.trained) {
+        for (int64_t id = 0; id < index->hdr.n_vectors; ++id) {
+            score_id(id);
+        }
+    } else {
+        // probe the lists with the closest centroids
+        std::vector<std::pair<float, int32_t>> order(index->hdr.n_lists);
+        for (int32_t l = 0; l < index->hdr.n_lists; ++l) {
+            float s = 0.0f;
+            for (int32_t i = 0; i < dim; ++i) {
+                s += centroid(index, l)[i] * query[i];
+            }
+            order[l] = { s, l };
+        }
+
+        n_probe = std::min(std::max(n_probe, 1), index->hdr.n_lists);
+        std::partial_sort(order.begin(), order.begin() + n_probe, order.end(),
+                [](const std::pair<float, int32_t> & a, const std::pair<float, int32_t> & b) { return a.first > b.first; });
+
+        for (int32_t p = 0; p < n_probe; ++p) {
+            for (const int64_t id : index->lists[order[p].second]) {
+                score_id(id);
+            }
+        }
+    }
+
+    std::sort_heap(best.heap.begin(), best.heap.end(), top_k::cmp);
+
+    const int32_t n = (int32_t) best.heap.size();
+    for (int32_t i = 0; i < n; ++i) {
+        scores[i] = best.heap[i].first;
+        ids[i]    = best.heap[i].second;
+    }
+
+    return n;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "ggml.h"
+
+#include <cstdint>
+
+// On-device nearest-neighbor index for retrieval
+//
+// Vectors are stored quantized (GGML_TYPE_Q8_0 or GGML_TYPE_F16) in a single
+// file that is memory-mapped for search and grown by appending. Scores are inner
+// products, i.e. cosine similarities for the normalized vectors produced by
+// embedding_encode, computed with the ggml CPU vec_dot kernels of the storage
+// type (NEON / AVX2 when available).
+//
+// Search is exact over all vectors until the index is trained. Training runs
+// k-means over the stored vectors and assigns every vector to one of n_lists
+// inverted lists (IVF); a search then only scans the n_probe lists whose
+// centroids are closest to the query. Vectors appended after training go to
+// the list of their nearest centroid.
+//
+// File layout: header, n_lists centroids (F32), then one record per vector:
+// int32 list id followed by the quantized row.
+
+struct vector_index;
+
+// Creates a new index file (an existing file is overwritten). Q8_0 needs dim to be
+// a multiple of 32. n_lists == 0 disables IVF.
+vector_index * vector_index_create(const char * path, int32_t dim, enum ggml_type type, int32_t n_lists);
+vector_index * vector_index_open  (const char * path);
+void           vector_index_free  (vector_index * index);
+
+int32_t vector_index_dim    (const vector_index * index);
+int64_t vector_index_size   (const vector_index * index);
+bool    vector_index_trained(const vector_index * index);
+
+// Appends n vectors of dim floats, their ids are size() .. size() + n - 1
+bool vector_index_add(vector_index * index, const float * vectors, int64_t n);
+
+// k-means over the stored vectors, then every vector is assigned to its list
+bool vector_index_train(vector_index * index, int32_t n_iter);
+
+// Top-k vectors by inner product with the query, best first. n_probe is the
+// number of lists scanned once the index is trained. Returns the number of
+// results written to ids and scores.
+int32_t vector_index_search(
+        const vector_index * index,
+        const float        * query,
+        int32_t              k,
+        int32_t              n_probe,
+        int64_t            * ids,
+        float              * scores);
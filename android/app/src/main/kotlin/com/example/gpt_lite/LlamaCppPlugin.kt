@@ -5,6 +5,8 @@ import io.flutter.plugin.common.MethodCall
 import io.flutter.plugin.common.MethodChannel
 import io.flutter.plugin.common.MethodChannel.MethodCallHandler
 import io.flutter.plugin.common.MethodChannel.Result
+import java.nio.ByteBuffer
+import java.nio.ByteOrder
 
 class LlamaCppPlugin : FlutterPlugin, MethodCallHandler {
     private lateinit var channel: MethodChannel
@@ -32,7 +34,48 @@ class LlamaCppPlugin : FlutterPlugin, MethodCallHandler {
                 } else {
                     result.error("INVALID_ARGUMENT", "Model path is required", null)
                 }
-            }            "createContext" -> {
+            }
+            "loadModelRpc" -> {
+                val modelPath = call.argument<String>("modelPath")
+                val endpoints = call.argument<List<String>>("endpoints")
+                val nRemoteLayers = call.argument<Int>("nRemoteLayers") ?: -1
+                val wireType = call.argument<Int>("wireType") ?: 0
+
+                if (modelPath != null && endpoints != null) {
+                    val modelId = loadModelRpc(modelPath, endpoints.toTypedArray(), nRemoteLayers, wireType)
+                    result.success(modelId)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Model path and endpoints are required", null)
+                }
+            }
+            "benchmarkRpc" -> {
+                val modelPath = call.argument<String>("modelPath")
+                val endpoints = call.argument<List<String>>("endpoints")
+                val nRemoteLayers = call.argument<Int>("nRemoteLayers") ?: -1
+                val wireType = call.argument<Int>("wireType") ?: 0
+                val inputText = call.argument<String>("inputText")
+                val nTokens = call.argument<Int>("nTokens") ?: 64
+                val latencyMs = call.argument<Int>("latencyMs") ?: 10
+
+                if (modelPath != null && endpoints != null && inputText != null) {
+                    val stats = benchmarkRpc(modelPath, endpoints.toTypedArray(), nRemoteLayers, wireType, inputText, nTokens, latencyMs)
+                    result.success(stats)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Model path, endpoints and input text are required", null)
+                }
+            }
+            "startRpcServer" -> {
+                val endpoint = call.argument<String>("endpoint")
+                val cacheDir = call.argument<String>("cacheDir") ?: ""
+                val nThreads = call.argument<Int>("nThreads") ?: 4
+
+                if (endpoint != null) {
+                    result.success(startRpcServer(endpoint, cacheDir, nThreads))
+                } else {
+                    result.error("INVALID_ARGUMENT", "Endpoint is required", null)
+                }
+            }
+            "createContext" -> {
                 val modelId = call.argument<Any>("modelId")?.let {
                     when (it) {
                         is Int -> it.toLong()
@@ -156,6 +199,580 @@ class LlamaCppPlugin : FlutterPlugin, MethodCallHandler {
                     result.error("INVALID_ARGUMENT", "Context ID is required", null)
                 }
             }
+            "attachDraftModel" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val draftModelPath = call.argument<String>("draftModelPath")
+                val nDraft = call.argument<Int>("nDraft") ?: 5
+
+                if (contextId != null && draftModelPath != null) {
+                    val success = attachDraftModel(contextId, draftModelPath, nDraft)
+                    result.success(success)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID and draft model path are required", null)
+                }
+            }
+            "enablePromptLookup" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val nDraft = call.argument<Int>("nDraft") ?: 8
+                val nGram = call.argument<Int>("nGram") ?: 3
+
+                if (contextId != null) {
+                    val success = enablePromptLookup(contextId, nDraft, nGram)
+                    result.success(success)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID is required", null)
+                }
+            }
+            "enableLookahead" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val window = call.argument<Int>("window") ?: 5
+                val ngram = call.argument<Int>("ngram") ?: 4
+                val guess = call.argument<Int>("guess") ?: 5
+
+                if (contextId != null) {
+                    val success = enableLookahead(contextId, window, ngram, guess)
+                    result.success(success)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID is required", null)
+                }
+            }
+            "benchmarkLookahead" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val inputText = call.argument<String>("inputText")
+                val nTokens = call.argument<Int>("nTokens") ?: 128
+
+                if (contextId != null && inputText != null) {
+                    val report = benchmarkLookahead(contextId, inputText, nTokens)
+                    result.success(report)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID and input text are required", null)
+                }
+            }
+            "registerLoraAdapter" -> {
+                val modelId = call.argument<Any>("modelId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val adapterPath = call.argument<String>("adapterPath")
+
+                if (modelId != null && adapterPath != null) {
+                    val adapterId = registerLoraAdapter(modelId, adapterPath)
+                    result.success(adapterId)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Model ID and adapter path are required", null)
+                }
+            }
+            "setLoraAdapter" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val adapterId = call.argument<Number>("adapterId")?.toLong() ?: 0L
+                val scale = call.argument<Double>("scale")?.toFloat() ?: 1.0f
+
+                if (contextId != null) {
+                    val success = setLoraAdapter(contextId, adapterId, scale)
+                    result.success(success)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID is required", null)
+                }
+            }
+            "generateParallel" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val inputTexts = call.argument<List<String>>("inputTexts")
+                val adapterIds = call.argument<List<Number>>("adapterIds")
+                val scales = call.argument<List<Double>>("scales")
+                val maxTokens = call.argument<Int>("maxTokens") ?: 100
+
+                if (contextId != null && inputTexts != null && adapterIds != null && scales != null) {
+                    val outputs = generateParallel(
+                        contextId,
+                        inputTexts.toTypedArray(),
+                        adapterIds.map { it.toLong() }.toLongArray(),
+                        scales.map { it.toFloat() }.toFloatArray(),
+                        maxTokens
+                    )
+                    result.success(outputs.toList())
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID, input texts, adapter IDs and scales are required", null)
+                }
+            }
+            "embedTexts" -> {
+                val modelId = call.argument<Any>("modelId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val inputTexts = call.argument<List<String>>("inputTexts")
+
+                if (modelId != null && inputTexts != null) {
+                    val nEmbd = getEmbeddingSize(modelId)
+                    if (nEmbd <= 0) {
+                        result.error("EMBEDDING_ERROR", "Model does not support embeddings", null)
+                        return
+                    }
+                    // the native side writes the vectors straight into this buffer
+                    val buffer = ByteBuffer.allocateDirect(inputTexts.size * nEmbd * 4).order(ByteOrder.nativeOrder())
+                    if (embedTexts(modelId, inputTexts.toTypedArray(), buffer)) {
+                        val vectors = FloatArray(inputTexts.size * nEmbd)
+                        buffer.asFloatBuffer().get(vectors)
+                        result.success(mapOf("dim" to nEmbd, "vectors" to vectors))
+                    } else {
+                        result.error("EMBEDDING_ERROR", "Failed to embed texts", null)
+                    }
+                } else {
+                    result.error("INVALID_ARGUMENT", "Model ID and input texts are required", null)
+                }
+            }
+            "getEmbeddingStats" -> {
+                val modelId = call.argument<Any>("modelId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                if (modelId != null) {
+                    val stats = getEmbeddingStats(modelId)
+                    result.success(stats)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Model ID is required", null)
+                }
+            }
+            "openVectorIndex" -> {
+                val path = call.argument<String>("path")
+                val dim = call.argument<Int>("dim")
+                val type = call.argument<Int>("type") ?: 0
+                val nLists = call.argument<Int>("nLists") ?: 0
+
+                if (path != null && dim != null) {
+                    val indexId = openVectorIndex(path, dim, type, nLists)
+                    if (indexId != 0L) {
+                        result.success(indexId)
+                    } else {
+                        result.error("VECTOR_INDEX_ERROR", "Failed to open vector index", null)
+                    }
+                } else {
+                    result.error("INVALID_ARGUMENT", "Path and dim are required", null)
+                }
+            }
+            "addVectors" -> {
+                val indexId = call.argument<Any>("indexId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val vectors = call.argument<FloatArray>("vectors")
+
+                if (indexId != null && vectors != null) {
+                    val firstId = addVectors(indexId, vectors)
+                    if (firstId >= 0) {
+                        result.success(firstId)
+                    } else {
+                        result.error("VECTOR_INDEX_ERROR", "Failed to add vectors", null)
+                    }
+                } else {
+                    result.error("INVALID_ARGUMENT", "Index ID and vectors are required", null)
+                }
+            }
+            "trainVectorIndex" -> {
+                val indexId = call.argument<Any>("indexId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val nIter = call.argument<Int>("nIter") ?: 10
+
+                if (indexId != null) {
+                    result.success(trainVectorIndex(indexId, nIter))
+                } else {
+                    result.error("INVALID_ARGUMENT", "Index ID is required", null)
+                }
+            }
+            "searchVectorIndex" -> {
+                val indexId = call.argument<Any>("indexId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val query = call.argument<FloatArray>("query")
+                val k = call.argument<Int>("k") ?: 5
+                val nProbe = call.argument<Int>("nProbe") ?: 4
+
+                if (indexId != null && query != null) {
+                    val ids = LongArray(k)
+                    val scores = FloatArray(k)
+                    val n = searchVectorIndex(indexId, query, k, nProbe, ids, scores)
+                    result.success(mapOf("ids" to ids.copyOf(n), "scores" to scores.copyOf(n)))
+                } else {
+                    result.error("INVALID_ARGUMENT", "Index ID and query are required", null)
+                }
+            }
+            "getVectorIndexSize" -> {
+                val indexId = call.argument<Any>("indexId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                if (indexId != null) {
+                    result.success(getVectorIndexSize(indexId))
+                } else {
+                    result.error("INVALID_ARGUMENT", "Index ID is required", null)
+                }
+            }
+            "closeVectorIndex" -> {
+                val indexId = call.argument<Any>("indexId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                if (indexId != null) {
+                    closeVectorIndex(indexId)
+                    result.success(null)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Index ID is required", null)
+                }
+            }
+            "startRequantization" -> {
+                val inputPath = call.argument<String>("inputPath")
+                val outputPath = call.argument<String>("outputPath")
+                val nThreads = call.argument<Int>("nThreads") ?: 0
+                val imatrixPath = call.argument<String>("imatrixPath") ?: ""
+
+                if (inputPath != null && outputPath != null) {
+                    result.success(startRequantization(inputPath, outputPath, nThreads, imatrixPath))
+                } else {
+                    result.error("INVALID_ARGUMENT", "Input and output paths are required", null)
+                }
+            }
+            "getRequantizationStatus" -> {
+                val jobId = call.argument<Any>("jobId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                if (jobId != null) {
+                    result.success(getRequantizationStatus(jobId))
+                } else {
+                    result.error("INVALID_ARGUMENT", "Job ID is required", null)
+                }
+            }
+            "cancelRequantization" -> {
+                val jobId = call.argument<Any>("jobId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                if (jobId != null) {
+                    cancelRequantization(jobId)
+                    result.success(null)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Job ID is required", null)
+                }
+            }
+            "benchmarkQuantization" -> {
+                val cacheDir = call.argument<String>("cacheDir")
+                val nParams = call.argument<Any>("nParams")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                } ?: 1_000_000_000L
+                val ftype = call.argument<Int>("ftype") ?: 2
+                val pinThreads = call.argument<Boolean>("pinThreads") ?: false
+
+                if (cacheDir != null) {
+                    result.success(benchmarkQuantization(cacheDir, nParams, ftype, pinThreads))
+                } else {
+                    result.error("INVALID_ARGUMENT", "Cache directory is required", null)
+                }
+            }
+            "enableImatrixCollection" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val minTokens = call.argument<Int>("minTokens") ?: 2
+
+                if (contextId != null) {
+                    result.success(enableImatrixCollection(contextId, minTokens))
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID is required", null)
+                }
+            }
+            "saveImatrix" -> {
+                val modelId = call.argument<Any>("modelId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val outputPath = call.argument<String>("outputPath")
+
+                if (modelId != null && outputPath != null) {
+                    result.success(saveImatrix(modelId, outputPath))
+                } else {
+                    result.error("INVALID_ARGUMENT", "Model ID and output path are required", null)
+                }
+            }
+            "getImatrixStats" -> {
+                val modelId = call.argument<Any>("modelId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                if (modelId != null) {
+                    result.success(getImatrixStats(modelId))
+                } else {
+                    result.error("INVALID_ARGUMENT", "Model ID is required", null)
+                }
+            }
+            "startConversation" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val systemPrompt = call.argument<String>("systemPrompt") ?: ""
+                val nKeep = call.argument<Int>("nKeep") ?: 0
+                val nDiscard = call.argument<Int>("nDiscard") ?: 0
+
+                if (contextId != null) {
+                    val success = startConversation(contextId, systemPrompt, nKeep, nDiscard)
+                    result.success(success)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID is required", null)
+                }
+            }
+            "endConversation" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                if (contextId != null) {
+                    endConversation(contextId)
+                    result.success(true)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID is required", null)
+                }
+            }
+            "getConversationStats" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                if (contextId != null) {
+                    val stats = getConversationStats(contextId)
+                    result.success(stats)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID is required", null)
+                }
+            }
+            "regenerate" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val maxTokens = call.argument<Int>("maxTokens") ?: 100
+
+                if (contextId != null) {
+                    val response = regenerate(contextId, maxTokens)
+                    result.success(response)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID is required", null)
+                }
+            }
+            "saveConversation" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val outputPath = call.argument<String>("outputPath")
+
+                if (contextId != null && outputPath != null) {
+                    val success = saveConversation(contextId, outputPath)
+                    result.success(success)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID and output path are required", null)
+                }
+            }
+            "loadConversation" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val inputPath = call.argument<String>("inputPath")
+                val nKeep = call.argument<Int>("nKeep") ?: 0
+                val nDiscard = call.argument<Int>("nDiscard") ?: 0
+
+                if (contextId != null && inputPath != null) {
+                    val success = loadConversation(contextId, inputPath, nKeep, nDiscard)
+                    result.success(success)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID and input path are required", null)
+                }
+            }
+            "benchmarkConversation" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val nTurns = call.argument<Int>("nTurns") ?: 16
+                val nTurnTokens = call.argument<Int>("nTurnTokens") ?: 256
+
+                if (contextId != null) {
+                    val stats = benchmarkConversation(contextId, nTurns, nTurnTokens)
+                    result.success(stats)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID is required", null)
+                }
+            }
+            "startChat" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val chatTemplate = call.argument<String>("chatTemplate") ?: ""
+                val systemPrompt = call.argument<String>("systemPrompt") ?: ""
+                val nDiscard = call.argument<Int>("nDiscard") ?: 0
+
+                if (contextId != null) {
+                    val success = startChat(contextId, chatTemplate, systemPrompt, nDiscard)
+                    result.success(success)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID is required", null)
+                }
+            }
+            "chat" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                val message = call.argument<String>("message")
+                val maxTokens = call.argument<Int>("maxTokens") ?: 100
+
+                if (contextId != null && message != null) {
+                    val response = chat(contextId, message, maxTokens)
+                    result.success(response)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID and message are required", null)
+                }
+            }
+            "getChatStats" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                if (contextId != null) {
+                    val stats = getChatStats(contextId)
+                    result.success(stats)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID is required", null)
+                }
+            }
+            "getGenerationStats" -> {
+                val contextId = call.argument<Any>("contextId")?.let {
+                    when (it) {
+                        is Int -> it.toLong()
+                        is Long -> it
+                        else -> null
+                    }
+                }
+                if (contextId != null) {
+                    val stats = getGenerationStats(contextId)
+                    result.success(stats)
+                } else {
+                    result.error("INVALID_ARGUMENT", "Context ID is required", null)
+                }
+            }
             else -> {
                 result.notImplemented()
             }
@@ -167,12 +784,49 @@ class LlamaCppPlugin : FlutterPlugin, MethodCallHandler {
     // Native method declarations
     external fun initBackend()
     external fun loadModel(modelPath: String): Long
+    external fun loadModelRpc(modelPath: String, endpoints: Array<String>, nRemoteLayers: Int, wireType: Int): Long
+    external fun benchmarkRpc(modelPath: String, endpoints: Array<String>, nRemoteLayers: Int, wireType: Int, inputText: String, nTokens: Int, latencyMs: Int): String
+    external fun startRpcServer(endpoint: String, cacheDir: String, nThreads: Int): Boolean
     external fun createContext(modelId: Long): Long
     external fun generateText(contextId: Long, inputText: String, maxTokens: Int): String
     external fun startStreaming(contextId: Long, inputText: String, maxTokens: Int): Boolean
     external fun getNextStreamingToken(contextId: Long): String
     external fun isStreamingComplete(contextId: Long): Boolean
     external fun stopStreaming(contextId: Long)
+    external fun attachDraftModel(contextId: Long, draftModelPath: String, nDraft: Int): Boolean
+    external fun enablePromptLookup(contextId: Long, nDraft: Int, nGram: Int): Boolean
+    external fun enableLookahead(contextId: Long, window: Int, ngram: Int, guess: Int): Boolean
+    external fun benchmarkLookahead(contextId: Long, inputText: String, nTokens: Int): String
+    external fun registerLoraAdapter(modelId: Long, adapterPath: String): Long
+    external fun setLoraAdapter(contextId: Long, adapterId: Long, scale: Float): Boolean
+    external fun generateParallel(contextId: Long, inputTexts: Array<String>, adapterIds: LongArray, scales: FloatArray, maxTokens: Int): Array<String>
+    external fun getEmbeddingSize(modelId: Long): Int
+    external fun embedTexts(modelId: Long, inputTexts: Array<String>, output: ByteBuffer): Boolean
+    external fun getEmbeddingStats(modelId: Long): String
+    external fun openVectorIndex(path: String, dim: Int, type: Int, nLists: Int): Long
+    external fun addVectors(indexId: Long, vectors: FloatArray): Long
+    external fun trainVectorIndex(indexId: Long, nIter: Int): Boolean
+    external fun searchVectorIndex(indexId: Long, query: FloatArray, k: Int, nProbe: Int, idsOut: LongArray, scoresOut: FloatArray): Int
+    external fun getVectorIndexSize(indexId: Long): Long
+    external fun closeVectorIndex(indexId: Long)
+    external fun startRequantization(inputPath: String, outputPath: String, nThreads: Int, imatrixPath: String): Long
+    external fun getRequantizationStatus(jobId: Long): String
+    external fun cancelRequantization(jobId: Long)
+    external fun benchmarkQuantization(cacheDir: String, nParams: Long, ftype: Int, pinThreads: Boolean): String
+    external fun enableImatrixCollection(contextId: Long, minTokens: Int): Boolean
+    external fun saveImatrix(modelId: Long, outputPath: String): Boolean
+    external fun getImatrixStats(modelId: Long): String
+    external fun startConversation(contextId: Long, systemPrompt: String, nKeep: Int, nDiscard: Int): Boolean
+    external fun endConversation(contextId: Long)
+    external fun getConversationStats(contextId: Long): String
+    external fun regenerate(contextId: Long, maxTokens: Int): String
+    external fun saveConversation(contextId: Long, outputPath: String): Boolean
+    external fun loadConversation(contextId: Long, inputPath: String, nKeep: Int, nDiscard: Int): Boolean
+    external fun benchmarkConversation(contextId: Long, nTurns: Int, nTurnTokens: Int): String
+    external fun startChat(contextId: Long, chatTemplate: String, systemPrompt: String, nDiscard: Int): Boolean
+    external fun chat(contextId: Long, message: String, maxTokens: Int): String
+    external fun getChatStats(contextId: Long): String
+    external fun getGenerationStats(contextId: Long): String
     external fun freeContext(contextId: Long)
     external fun freeModel(modelId: Long)
 }
@@ -1,3 +1,6 @@
+import 'dart:convert';
+import 'dart:typed_data';
+
 import 'package:flutter/services.dart';
 
 class LlamaCppService {
@@ -48,6 +51,79 @@ class LlamaCppService {
     }
   }
   
+  Future<bool> loadModelRpc(
+    String modelPath,
+    List<String> endpoints, {
+    int nRemoteLayers = -1,
+    int wireType = 0,
+  }) async {
+    await initBackend();
+    
+    try {
+      final result = await _channel.invokeMethod('loadModelRpc', {
+        'modelPath': modelPath,
+        'endpoints': endpoints,
+        'nRemoteLayers': nRemoteLayers,
+        'wireType': wireType,
+      });
+      
+      if (result != null && result is int && result > 0) {
+        _modelId = result;
+        return true;
+      }
+      return false;
+    } catch (e) {
+      print('Error loading model with RPC split: $e');
+      return false;
+    }
+  }
+  
+  Future<Map<String, dynamic>> benchmarkRpc(
+    String modelPath,
+    List<String> endpoints,
+    String prompt, {
+    int nRemoteLayers = -1,
+    int wireType = 0,
+    int nTokens = 64,
+    int latencyMs = 10,
+  }) async {
+    await initBackend();
+    
+    try {
+      final result = await _channel.invokeMethod('benchmarkRpc', {
+        'modelPath': modelPath,
+        'endpoints': endpoints,
+        'nRemoteLayers': nRemoteLayers,
+        'wireType': wireType,
+        'inputText': prompt,
+        'nTokens': nTokens,
+        'latencyMs': latencyMs,
+      });
+      
+      return result != null ? jsonDecode(result.toString()) as Map<String, dynamic> : {};
+    } catch (e) {
+      print('Error benchmarking RPC: $e');
+      return {};
+    }
+  }
+  
+  Future<bool> startRpcServer(String endpoint, {String cacheDir = '', int nThreads = 4}) async {
+    await initBackend();
+    
+    try {
+      final result = await _channel.invokeMethod('startRpcServer', {
+        'endpoint': endpoint,
+        'cacheDir': cacheDir,
+        'nThreads': nThreads,
+      });
+      
+      return result == true;
+    } catch (e) {
+      print('Error starting RPC server: $e');
+      return false;
+    }
+  }
+  
   Future<bool> createContext() async {
     if (_modelId == null) return false;
     
@@ -143,6 +219,550 @@ class LlamaCppService {
     }
   }
   
+  Future<bool> attachDraftModel(String draftModelPath, {int nDraft = 5}) async {
+    if (_contextId == null) return false;
+    
+    try {
+      final result = await _channel.invokeMethod('attachDraftModel', {
+        'contextId': _contextId,
+        'draftModelPath': draftModelPath,
+        'nDraft': nDraft,
+      });
+      
+      return result == true;
+    } catch (e) {
+      print('Error attaching draft model: $e');
+      return false;
+    }
+  }
+  
+  Future<bool> enablePromptLookup({int nDraft = 8, int nGram = 3}) async {
+    if (_contextId == null) return false;
+    
+    try {
+      final result = await _channel.invokeMethod('enablePromptLookup', {
+        'contextId': _contextId,
+        'nDraft': nDraft,
+        'nGram': nGram,
+      });
+      
+      return result == true;
+    } catch (e) {
+      print('Error enabling prompt lookup: $e');
+      return false;
+    }
+  }
+  
+  Future<bool> enableLookahead({int window = 5, int ngram = 4, int guess = 5}) async {
+    if (_contextId == null) return false;
+    
+    try {
+      final result = await _channel.invokeMethod('enableLookahead', {
+        'contextId': _contextId,
+        'window': window,
+        'ngram': ngram,
+        'guess': guess,
+      });
+      
+      return result == true;
+    } catch (e) {
+      print('Error enabling lookahead: $e');
+      return false;
+    }
+  }
+  
+  Future<Map<String, dynamic>> benchmarkLookahead(String prompt, {int nTokens = 128}) async {
+    if (_contextId == null) return {};
+    
+    try {
+      final result = await _channel.invokeMethod('benchmarkLookahead', {
+        'contextId': _contextId,
+        'inputText': prompt,
+        'nTokens': nTokens,
+      });
+      
+      return result != null ? jsonDecode(result.toString()) as Map<String, dynamic> : {};
+    } catch (e) {
+      print('Error benchmarking lookahead: $e');
+      return {};
+    }
+  }
+  
+  Future<int?> registerLoraAdapter(String adapterPath) async {
+    if (_modelId == null) return null;
+    
+    try {
+      final result = await _channel.invokeMethod('registerLoraAdapter', {
+        'modelId': _modelId,
+        'adapterPath': adapterPath,
+      });
+      
+      return result != null && result is int && result > 0 ? result : null;
+    } catch (e) {
+      print('Error registering LoRA adapter: $e');
+      return null;
+    }
+  }
+  
+  Future<bool> setLoraAdapter(int? adapterId, {double scale = 1.0}) async {
+    if (_contextId == null) return false;
+    
+    try {
+      final result = await _channel.invokeMethod('setLoraAdapter', {
+        'contextId': _contextId,
+        'adapterId': adapterId ?? 0,
+        'scale': scale,
+      });
+      
+      return result == true;
+    } catch (e) {
+      print('Error setting LoRA adapter: $e');
+      return false;
+    }
+  }
+  
+  Future<List<String>> generateParallel(
+    List<String> prompts,
+    List<int?> adapterIds, {
+    List<double>? scales,
+    int maxTokens = 100,
+  }) async {
+    if (_contextId == null || prompts.length != adapterIds.length) return [];
+    
+    try {
+      final result = await _channel.invokeMethod('generateParallel', {
+        'contextId': _contextId,
+        'inputTexts': prompts,
+        'adapterIds': adapterIds.map((id) => id ?? 0).toList(),
+        'scales': scales ?? List<double>.filled(prompts.length, 1.0),
+        'maxTokens': maxTokens,
+      });
+      
+      return result != null ? List<String>.from(result as List) : [];
+    } catch (e) {
+      print('Error generating in parallel: $e');
+      return [];
+    }
+  }
+  
+  Future<List<Float32List>> embedTexts(List<String> texts) async {
+    if (_modelId == null || texts.isEmpty) return [];
+    
+    try {
+      final result = await _channel.invokeMethod('embedTexts', {
+        'modelId': _modelId,
+        'inputTexts': texts,
+      });
+      
+      if (result == null) return [];
+      final int dim = result['dim'] as int;
+      final Float32List vectors = result['vectors'] as Float32List;
+      
+      // views into the single buffer returned by the plugin
+      return List<Float32List>.generate(
+        texts.length,
+        (i) => Float32List.sublistView(vectors, i * dim, (i + 1) * dim),
+      );
+    } catch (e) {
+      print('Error embedding texts: $e');
+      return [];
+    }
+  }
+  
+  Future<Map<String, dynamic>> getEmbeddingStats() async {
+    if (_modelId == null) return {};
+    
+    try {
+      final result = await _channel.invokeMethod('getEmbeddingStats', {
+        'modelId': _modelId,
+      });
+      
+      return result != null ? jsonDecode(result.toString()) as Map<String, dynamic> : {};
+    } catch (e) {
+      print('Error getting embedding stats: $e');
+      return {};
+    }
+  }
+  
+  Future<int?> openVectorIndex(String path, int dim, {bool f16 = false, int nLists = 0}) async {
+    try {
+      final result = await _channel.invokeMethod('openVectorIndex', {
+        'path': path,
+        'dim': dim,
+        'type': f16 ? 1 : 0,
+        'nLists': nLists,
+      });
+      
+      return result != null && result is int && result > 0 ? result : null;
+    } catch (e) {
+      print('Error opening vector index: $e');
+      return null;
+    }
+  }
+  
+  Future<int> addVectors(int indexId, List<Float32List> vectors) async {
+    if (vectors.isEmpty) return -1;
+    
+    try {
+      final flat = Float32List(vectors.length * vectors.first.length);
+      for (var i = 0; i < vectors.length; i++) {
+        flat.setAll(i * vectors.first.length, vectors[i]);
+      }
+      
+      final result = await _channel.invokeMethod('addVectors', {
+        'indexId': indexId,
+        'vectors': flat,
+      });
+      
+      return result is int ? result : -1;
+    } catch (e) {
+      print('Error adding vectors: $e');
+      return -1;
+    }
+  }
+  
+  Future<bool> trainVectorIndex(int indexId, {int nIter = 10}) async {
+    try {
+      final result = await _channel.invokeMethod('trainVectorIndex', {
+        'indexId': indexId,
+        'nIter': nIter,
+      });
+      
+      return result == true;
+    } catch (e) {
+      print('Error training vector index: $e');
+      return false;
+    }
+  }
+  
+  Future<Map<String, dynamic>> searchVectorIndex(
+    int indexId,
+    Float32List query, {
+    int k = 5,
+    int nProbe = 4,
+  }) async {
+    try {
+      final result = await _channel.invokeMethod('searchVectorIndex', {
+        'indexId': indexId,
+        'query': query,
+        'k': k,
+        'nProbe': nProbe,
+      });
+      
+      return result != null ? Map<String, dynamic>.from(result as Map) : {};
+    } catch (e) {
+      print('Error searching vector index: $e');
+      return {};
+    }
+  }
+  
+  Future<int> getVectorIndexSize(int indexId) async {
+    try {
+      final result = await _channel.invokeMethod('getVectorIndexSize', {
+        'indexId': indexId,
+      });
+      
+      return result is int ? result : 0;
+    } catch (e) {
+      print('Error getting vector index size: $e');
+      return 0;
+    }
+  }
+  
+  Future<void> closeVectorIndex(int indexId) async {
+    try {
+      await _channel.invokeMethod('closeVectorIndex', {
+        'indexId': indexId,
+      });
+    } catch (e) {
+      print('Error closing vector index: $e');
+    }
+  }
+  
+  Future<int?> startRequantization(String inputPath, String outputPath,
+      {int nThreads = 0, String imatrixPath = ''}) async {
+    await initBackend();
+    
+    try {
+      final result = await _channel.invokeMethod('startRequantization', {
+        'inputPath': inputPath,
+        'outputPath': outputPath,
+        'nThreads': nThreads,
+        'imatrixPath': imatrixPath,
+      });
+      
+      return result != null && result is int && result > 0 ? result : null;
+    } catch (e) {
+      print('Error starting requantization: $e');
+      return null;
+    }
+  }
+  
+  Future<Map<String, dynamic>> getRequantizationStatus(int jobId) async {
+    try {
+      final result = await _channel.invokeMethod('getRequantizationStatus', {
+        'jobId': jobId,
+      });
+      
+      return result != null ? jsonDecode(result.toString()) as Map<String, dynamic> : {};
+    } catch (e) {
+      print('Error getting requantization status: $e');
+      return {};
+    }
+  }
+  
+  Future<void> cancelRequantization(int jobId) async {
+    try {
+      await _channel.invokeMethod('cancelRequantization', {
+        'jobId': jobId,
+      });
+    } catch (e) {
+      print('Error cancelling requantization: $e');
+    }
+  }
+  
+  Future<Map<String, dynamic>> benchmarkQuantization(String cacheDir, {int nParams = 1000000000, int ftype = 2, bool pinThreads = false}) async {
+    await initBackend();
+    
+    try {
+      final result = await _channel.invokeMethod('benchmarkQuantization', {
+        'cacheDir': cacheDir,
+        'nParams': nParams,
+        'ftype': ftype,
+        'pinThreads': pinThreads,
+      });
+      
+      return result != null ? jsonDecode(result.toString()) as Map<String, dynamic> : {};
+    } catch (e) {
+      print('Error benchmarking quantization: $e');
+      return {};
+    }
+  }
+  
+  Future<bool> enableImatrixCollection({int minTokens = 2}) async {
+    if (_contextId == null) return false;
+    
+    try {
+      final result = await _channel.invokeMethod('enableImatrixCollection', {
+        'contextId': _contextId,
+        'minTokens': minTokens,
+      });
+      
+      return result == true;
+    } catch (e) {
+      print('Error enabling imatrix collection: $e');
+      return false;
+    }
+  }
+  
+  Future<bool> saveImatrix(String outputPath) async {
+    if (_modelId == null) return false;
+    
+    try {
+      final result = await _channel.invokeMethod('saveImatrix', {
+        'modelId': _modelId,
+        'outputPath': outputPath,
+      });
+      
+      return result == true;
+    } catch (e) {
+      print('Error saving imatrix: $e');
+      return false;
+    }
+  }
+  
+  Future<Map<String, dynamic>> getImatrixStats() async {
+    if (_modelId == null) return {};
+    
+    try {
+      final result = await _channel.invokeMethod('getImatrixStats', {
+        'modelId': _modelId,
+      });
+      
+      return result != null ? jsonDecode(result.toString()) as Map<String, dynamic> : {};
+    } catch (e) {
+      print('Error getting imatrix stats: $e');
+      return {};
+    }
+  }
+  
+  Future<bool> startConversation({String systemPrompt = '', int nKeep = 0, int nDiscard = 0}) async {
+    if (_contextId == null) return false;
+    
+    try {
+      final result = await _channel.invokeMethod('startConversation', {
+        'contextId': _contextId,
+        'systemPrompt': systemPrompt,
+        'nKeep': nKeep,
+        'nDiscard': nDiscard,
+      });
+      
+      return result == true;
+    } catch (e) {
+      print('Error starting conversation: $e');
+      return false;
+    }
+  }
+  
+  Future<void> endConversation() async {
+    if (_contextId == null) return;
+    
+    try {
+      await _channel.invokeMethod('endConversation', {
+        'contextId': _contextId,
+      });
+    } catch (e) {
+      print('Error ending conversation: $e');
+    }
+  }
+  
+  Future<Map<String, dynamic>> getConversationStats() async {
+    if (_contextId == null) return {};
+    
+    try {
+      final result = await _channel.invokeMethod('getConversationStats', {
+        'contextId': _contextId,
+      });
+      
+      return result != null ? jsonDecode(result.toString()) as Map<String, dynamic> : {};
+    } catch (e) {
+      print('Error getting conversation stats: $e');
+      return {};
+    }
+  }
+  
+  Future<String> regenerate({int maxTokens = 100}) async {
+    if (_contextId == null) return '';
+    
+    try {
+      final result = await _channel.invokeMethod('regenerate', {
+        'contextId': _contextId,
+        'maxTokens': maxTokens,
+      });
+      
+      return result?.toString() ?? '';
+    } catch (e) {
+      print('Error regenerating: $e');
+      return '';
+    }
+  }
+  
+  Future<bool> saveConversation(String outputPath) async {
+    if (_contextId == null) return false;
+    
+    try {
+      final result = await _channel.invokeMethod('saveConversation', {
+        'contextId': _contextId,
+        'outputPath': outputPath,
+      });
+      
+      return result == true;
+    } catch (e) {
+      print('Error saving conversation: $e');
+      return false;
+    }
+  }
+  
+  Future<bool> loadConversation(String inputPath, {int nKeep = 0, int nDiscard = 0}) async {
+    if (_contextId == null) return false;
+    
+    try {
+      final result = await _channel.invokeMethod('loadConversation', {
+        'contextId': _contextId,
+        'inputPath': inputPath,
+        'nKeep': nKeep,
+        'nDiscard': nDiscard,
+      });
+      
+      return result == true;
+    } catch (e) {
+      print('Error loading conversation: $e');
+      return false;
+    }
+  }
+  
+  Future<Map<String, dynamic>> benchmarkConversation({int nTurns = 16, int nTurnTokens = 256}) async {
+    if (_contextId == null) return {};
+    
+    try {
+      final result = await _channel.invokeMethod('benchmarkConversation', {
+        'contextId': _contextId,
+        'nTurns': nTurns,
+        'nTurnTokens': nTurnTokens,
+      });
+      
+      return result != null ? jsonDecode(result.toString()) as Map<String, dynamic> : {};
+    } catch (e) {
+      print('Error benchmarking conversation: $e');
+      return {};
+    }
+  }
+  
+  Future<bool> startChat({String chatTemplate = '', String systemPrompt = '', int nDiscard = 0}) async {
+    if (_contextId == null) return false;
+    
+    try {
+      final result = await _channel.invokeMethod('startChat', {
+        'contextId': _contextId,
+        'chatTemplate': chatTemplate,
+        'systemPrompt': systemPrompt,
+        'nDiscard': nDiscard,
+      });
+      
+      return result == true;
+    } catch (e) {
+      print('Error starting chat: $e');
+      return false;
+    }
+  }
+  
+  Future<String> chat(String message, {int maxTokens = 100}) async {
+    if (_contextId == null) return '';
+    
+    try {
+      final result = await _channel.invokeMethod('chat', {
+        'contextId': _contextId,
+        'message': message,
+        'maxTokens': maxTokens,
+      });
+      
+      return result?.toString() ?? '';
+    } catch (e) {
+      print('Error in chat: $e');
+      return '';
+    }
+  }
+  
+  Future<Map<String, dynamic>> getChatStats() async {
+    if (_contextId == null) return {};
+    
+    try {
+      final result = await _channel.invokeMethod('getChatStats', {
+        'contextId': _contextId,
+      });
+      
+      return result != null ? jsonDecode(result.toString()) as Map<String, dynamic> : {};
+    } catch (e) {
+      print('Error getting chat stats: $e');
+      return {};
+    }
+  }
+  
+  Future<Map<String, dynamic>> getGenerationStats() async {
+    if (_contextId == null) return {};
+    
+    try {
+      final result = await _channel.invokeMethod('getGenerationStats', {
+        'contextId': _contextId,
+      });
+      
+      return result != null ? jsonDecode(result.toString()) as Map<String, dynamic> : {};
+    } catch (e) {
+      print('Error getting generation stats: $e');
+      return {};
+    }
+  }
+  
   Stream<String> generateTextStream(String prompt, {int maxTokens = 20}) async* {
     if (!await startStreaming(prompt, maxTokens: maxTokens)) {
       yield 'Error: Failed to start streaming';